@@ -81,7 +81,7 @@ void DXAppBase::Render()
 	}
 	GpuTimestampEndAndResolve(m_commandList.Get(), m_frameIndex);
 
-	//  . Present · ȯ
+	// 렌더링 끝났음. Present 상태로 전환
 	m_commandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(CurrentBackbuffer(), D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT));
 
 	ThrowIfFailed(m_commandList->Close());
@@ -110,7 +110,7 @@ void DXAppBase::OnResize(uint32_t width, uint32_t height)
 
 	if (m_currentScene)
 	{
-		//  App ȭ ü  Ʈ ϹǷ x,y  0 
+		// 지금은 App 화면 전체를 씬 뷰포트로 사용하므로 x,y를 모두 0으로 세팅
 		m_currentScene->OnResize(0.0f, 0.0f, static_cast<float>(m_width), static_cast<float>(m_height));
 	}
 
@@ -118,7 +118,7 @@ void DXAppBase::OnResize(uint32_t width, uint32_t height)
 	ThrowIfFailed(m_swapChain->ResizeBuffers( kFrameCount, width, height, m_backbufferFormat, m_tearingSupported ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0));
 	m_frameIndex = m_swapChain->GetCurrentBackBufferIndex();
 	CreateBackbuffersAndDefaultDSV(width, height);
-	OnAfterSwapchainCreated(); // Ļ: ũ ҽ  
+	OnAfterSwapchainCreated(); // 파생: 오프스크린 리소스 재생성 등
 }
 
 void DXAppBase::StartTimer()
@@ -191,14 +191,14 @@ void DXAppBase::OnPlatformEvent(uint32_t msg, WPARAM wParam, LPARAM lParam)
 
 void DXAppBase::LoadScene(std::unique_ptr<Scene> newScene)
 {
-	//   
+	// 기존 씬 해제
 	if (m_currentScene)
 	{
 		m_currentScene->OnExit();
 		m_currentScene.reset();
 	}
 
-	//   ü
+	// 새 씬으로 교체
 	m_currentScene = std::move(newScene);
 	m_currentScene->OnResize(0.0f, 0.0f, static_cast<float>(m_width), static_cast<float>(m_height));
 	m_currentScene->Init();
@@ -215,7 +215,7 @@ void DXAppBase::InitUI(ID3D12GraphicsCommandList* cmd)
 
 void DXAppBase::RenderFrame(ID3D12GraphicsCommandList* cmd)
 {
-	//  Ÿ , Back Buffer RenderTarget · ȯ
+	// 렌더 타겟 생성됨, Back Buffer를 RenderTarget 상태로 전환
 	const auto rtvBarrier = CD3DX12_RESOURCE_BARRIER::Transition(CurrentBackbuffer(), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_RENDER_TARGET);
 	cmd->ResourceBarrier(1, &rtvBarrier);
 
@@ -223,7 +223,7 @@ void DXAppBase::RenderFrame(ID3D12GraphicsCommandList* cmd)
 	CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle(m_rtvHeap->GetCPUDescriptorHandleForHeapStart(), m_frameIndex, m_rtvDescriptorSize);
 	cmd->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
 
-	// RTV Clear  ߰.
+	// RTV Clear 명령 추가.
 	const float clearColor[] = { 0.0f, 0.0f, 0.2f, 1.0f };
 	cmd->ClearRenderTargetView(rtvHandle, clearColor, 0, nullptr);
 	cmd->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
@@ -273,7 +273,7 @@ void DXAppBase::OnAfterChainSwaped()
 
 	// GPU TimeStamp Readback
 	const double gpuMs = ComputeGpuFrameMsAfterCompleted(m_frameIndex);
-	// Timer GPU  ð(ms) ݿ  / FPS 꿡 
+	// Timer에 GPU 프레임 시간(ms) 반영 → 평균/즉시 FPS 계산에 사용
 	GetTimer().PushGpuFrameMs(gpuMs);
 }
 
@@ -398,14 +398,14 @@ void DXAppBase::CreateSwapChain(HWND hwnd, ID3D12CommandQueue* presentQueue)
 	ThrowIfFailed(m_factory->MakeWindowAssociation(Win32Application::GetHwnd(), DXGI_MWA_NO_ALT_ENTER));
 }
 
-// CommandAllocator, CommandList , ʱ FenceValue 
+// CommandAllocator, CommandList 생성, 초기 FenceValue 세팅
 void DXAppBase::CreateCommandObjects()
 {
 	m_nextFenceValue = m_swapChainFence->GetCompletedValue();
 	for (uint32_t n = 0; n < kFrameCount; n++)
 	{
 		m_fenceValues[n] = m_nextFenceValue;
-		//CommandAllocator 
+		//CommandAllocator 생성
 		ThrowIfFailed(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(m_commandAllocators[n].ReleaseAndGetAddressOf())));
 		NAME_D3D12_OBJECT_INDEXED(m_commandAllocators, n);
 	}
@@ -424,7 +424,7 @@ void DXAppBase::InitPipeline()
 
 void DXAppBase::CreateBackbuffersAndDefaultDSV(uint32_t width, uint32_t height)
 {
-	//Descriptor Heap 
+	//Descriptor Heap 생성
 	D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc{};
 	rtvHeapDesc.NumDescriptors = kFrameCount;
 	rtvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
@@ -452,7 +452,7 @@ void DXAppBase::CreateBackbuffersAndDefaultDSV(uint32_t width, uint32_t height)
 	NAME_D3D12_OBJECT(m_dsvHeap);
 	m_dsvDescriptorSize = m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
 
-	// DSV 
+	// DSV 생성
 	D3D12_CLEAR_VALUE clear{};
 	clear.Format = m_depthFormat;
 	clear.DepthStencil.Depth = 1.0f;
@@ -519,7 +519,7 @@ void DXAppBase::DestroyFenceAndEvent()
 
 void DXAppBase::PrepareRender()
 {
-	// ̹ ӿ Ҵ   üũ
+	// 이번 프레임에 할당 가능한 공간 체크
 	m_uploadContext->Reclaim(m_swapChainFence->GetCompletedValue());
 	m_gpuAllocator->Reclaim(m_swapChainFence->GetCompletedValue());
 	GpuTimestampBegin(m_commandList.Get(), m_frameIndex);
@@ -538,10 +538,10 @@ void DXAppBase::MoveToNextFrame()
 
 	m_uploadContext->TrackPendingAllocations(fenceToSignal);
 	m_fenceValues[prevIndex] = fenceToSignal;
-	// ü 
+	// 체인 스왑
 	m_frameIndex = m_swapChain->GetCurrentBackBufferIndex();
 	
-	// ü   Ϸ  ۾ 
+	// 체인 스왑 전에 완료하지 못한 작업은 대기
 	uint64_t lastFenceValue = m_fenceValues[m_frameIndex];
 	if (lastFenceValue > 0 && m_swapChainFence->GetCompletedValue() < lastFenceValue)
 	{
@@ -580,7 +580,7 @@ void DXAppBase::InitGpuTimeStampResources()
 {
 	ThrowIfFailed(GetPresentQueue()->GetTimestampFrequency(&m_tsFreq));
 
-	// Query heap: Ӵ 2(/) * kFrameCount
+	// Query heap: 프레임당 2(시작/끝) * kFrameCount
 	D3D12_QUERY_HEAP_DESC qh{};
 	qh.Count = kFrameCount * 2;
 	qh.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
@@ -632,7 +632,7 @@ void DXAppBase::GpuTimestampEndAndResolve(ID3D12GraphicsCommandList* cmd, uint32
 	const uint32_t q1 = q0 + 1;
 	cmd->EndQuery(m_tsQueryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, q1);
 
-	// / 2 readback ۿ  Resolve
+	// 시작/끝 2개를 readback 버퍼에 연속으로 Resolve
 	const uint64_t dstOffsetBytes = sizeof(uint64_t) * q0;
 	cmd->ResolveQueryData(m_tsQueryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, q0, 2, m_tsReadback.Get(), dstOffsetBytes);
 }
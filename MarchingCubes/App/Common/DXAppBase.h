@@ -40,11 +40,11 @@ public:
 
 protected:
     virtual void InitUI(ID3D12GraphicsCommandList* cmd);
-    virtual void OnUpload(ID3D12GraphicsCommandList* cmd) {};                           // ҽ  Ҵ
+    virtual void OnUpload(ID3D12GraphicsCommandList* cmd) {};                           // 리소스 버퍼 할당
     virtual void RenderFrame(ID3D12GraphicsCommandList* cmd);
     virtual void OnAfterSwapchainCreated() {}                                           
-    virtual void InitSubsystems();                                                      //  ý
-    virtual void OnBuildInitialScene(ID3D12GraphicsCommandList* initCommand) {}         // ʱ  
+    virtual void InitSubsystems();                                                      // 서브 시스템
+    virtual void OnBuildInitialScene(ID3D12GraphicsCommandList* initCommand) {}         // 초기 씬 구성
     virtual void OnAfterChainSwaped();
 
     virtual void CreateRootSignature() = 0;
@@ -90,7 +90,7 @@ private:
 
     void GpuTimestampBegin(ID3D12GraphicsCommandList* cmd, uint32_t frameIndex);
     void GpuTimestampEndAndResolve(ID3D12GraphicsCommandList* cmd, uint32_t frameIndex);
-    double ComputeGpuFrameMsAfterCompleted(uint32_t frameIndex); // fence Ϸ  ȣ
+    double ComputeGpuFrameMsAfterCompleted(uint32_t frameIndex); // fence 완료 후 호출
 
     static constexpr uint32_t QueryIndexStart(uint32_t frameIndex) { return frameIndex * 2; }
 
@@ -156,7 +156,7 @@ protected:
 
     // Profiler
     std::weak_ptr<Profiler> m_profiler;
-    std::shared_ptr<Profiler> m_profilerOwner; // TODO : ToolManager ϵ 
+    std::shared_ptr<Profiler> m_profilerOwner; // TODO : ToolManager에서 소유하도록 변경
 
     UI::FrameCallbackToken m_uiToken_Fps = 0;
     UI::FrameCallbackToken m_uiToken_Profiler = 0;
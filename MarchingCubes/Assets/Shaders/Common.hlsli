@@ -1,6 +1,6 @@
 // --------------------------------------
 // Common.hlsli
-// -   cbuffer,Light ü .
+// - 상수 및 cbuffer,Light 구조체 정의.
 // --------------------------------------
 #ifndef COMMON_HLSLI
 #define COMMON_HLSLI
@@ -1,7 +1,7 @@
 // LineShaders.hlsl
 #include "Common.hlsli"
 
-// Ǹ  VertexShader shaders.hlsl VSMain 
+//개발 편의를 위해 VertexShader는 shaders.hlsl의 VSMain을 사용
 
 // Vertex-to-pixel output structure
 struct PSInput
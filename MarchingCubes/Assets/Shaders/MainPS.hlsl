@@ -27,7 +27,7 @@ float4 PSMain(PSInput input) : SV_TARGET
     float3 F0;
     if (mat.shadingModel == EShadingModel::TRANSLUCENT)
     {
-        // ݼ,   ȯ  ó
+        // 금속, 유리 등의 환경 맵핑 처리
         float IOR = mat.IOR;
         float fd = pow((1.0f - IOR) / (1.0f + IOR), 2.0f);
         F0 = fd.xxx;
@@ -49,16 +49,16 @@ float4 PSMain(PSInput input) : SV_TARGET
     }
     else if (mat.shadingModel == EShadingModel::DIELECTRIC)
     {
-        // ü 
+        // 유전체 모델
         F0 = ComputeF0_Dielectric(mat.IOR, mat.metalic, mat.albedo);
     }
     else //EShadingModel::DEFAULT_LIT
     {
-        //⺻  : albedo x specularStrength 
+        //기본 모델 : albedo x specularStrength 조합
         F0 = ComputeF0_Default(mat.albedo, mat.specularStrength, mat.metalic);
     }
     
-    //  Ʈ ȸ
+    // 모든 라이트 순회
     float3 LoSum = float3(0, 0, 0);
     
     [loop]
@@ -87,7 +87,7 @@ float4 PSMain(PSInput input) : SV_TARGET
                 float3 spotDir = normalize(light.spotParam1);
                 float cosLA = dot(L, spotDir);
                 
-                // NOTE : outerCos  .
+                // NOTE : outerCos은 상수로 정의.
                 const float outerCos = 0.8f;
                 float innerCos = light.spotParam2;
                 
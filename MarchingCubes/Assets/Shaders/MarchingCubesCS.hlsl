@@ -25,7 +25,7 @@ struct Vertex
     float3 position;
     float3 normal;
     float4 tangent; // xyz: tangent, w: handedness(+1)
-    int2 id; //    Edge   ǥ. (A Ʈ ε - B Ʈ ε) 
+    int2 id; // 이 정점이 어떤 Edge 사이의 정점인지를 표현. (A 포인트 인덱스 - B 포인트 인덱스) 
 }; 
 
 struct Triangle 
@@ -41,13 +41,13 @@ Texture3D<float> gDensityTex : register(t1);
 
 AppendStructuredBuffer<Triangle> gTriangles : register(u0);
 
-// Chunk   ε <  1  -> [z][y][x] ε  >
+// Chunk 기준 고유 인덱스 <  1차원 벡터 -> [z][y][x] 인덱싱  >
 int IndexFromCoord(int3 coord)
 {
     return coord.z * (gridCells.x * gridCells.y) + coord.y * gridCells.x + coord.x;
 }
 
-// е ø (  Ŭ )
+// 밀도 샘플링 ( 경계 클램프 )
 float SampleDensity(int3 coord)
 {
     int3 lo = int3(0, 0, 0);
@@ -70,7 +70,7 @@ float3 CalculateNormal(int3 coord)
     return (dot(n, n) > 1e-20) ? -normalize(n) : float3(0, 1, 0);
 }
 
-// Edge   
+// Edge 보간 정점 생성
 Vertex CreateVertex(int3 coordA, int3 coordB)
 {
     float dA = SampleDensity(coordA);
@@ -109,12 +109,12 @@ void MCMainCS(uint3 groupId : SV_GroupID, uint3 groupThreadID : SV_GroupThreadID
     uint3 base = regionCellMin + groupId * 8 + groupThreadID;
     uint3 limit = min(regionCellMax, gridCells - uint3(1, 1, 1));
 
-    //  ̸ return
+    // 범위 밖이면 return
     if (any(base >= limit))
         return;
     
     uint3 chunkCoord = base / chunkCubes;
-    //  Edge  ϴ ť긦 
+    // 현재 Edge를 원점으로 하는 큐브를 형성
     int3 c[8];
     c[0] = base + int3(0, 0, 0);
     c[1] = base + int3(1, 0, 0);
@@ -125,13 +125,13 @@ void MCMainCS(uint3 groupId : SV_GroupID, uint3 groupThreadID : SV_GroupThreadID
     c[6] = base + int3(1, 1, 1);
     c[7] = base + int3(0, 1, 1);
 
-    // Marching Cubes ˰ 
+    // Marching Cubes 알고리즘 적용
     int cfg = 0;
     int i = 0;
     [unroll]
     for (i = 0; i < 8; ++i)
     {
-        // T/F 
+        // T/F 구분
         if(SampleDensity(c[i]) < isoValue)
             cfg |= (1u << i);
     }
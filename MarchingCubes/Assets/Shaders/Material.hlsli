@@ -1,6 +1,6 @@
 // --------------------------------------
 // Material.hlsli
-// - Material    Լ
+// - Material 정의 및 헬퍼 함수
 // --------------------------------------
 #ifndef MATERIAL_HLSLI
 #define MATERIAL_HLSLI
@@ -44,7 +44,7 @@ struct MaterialBuffer
     float specularStrength; // [0,1], default = 0.5
     float roughness; // [0,1]
     float ambientOcclusion; // [0,1]
-    float IOR; // Dielectric 
+    float IOR; // Dielectric 전용
     
     uint shadingModel; //0 - Default, 1 - Dielectric, 2 - Translucent    
     float opacity; // [0,1], Default - 1
@@ -68,7 +68,7 @@ struct EvaluatedMaterial
     float opacity;
 
     float3 emissive;
-    float3 normal; //   (normal map )
+    float3 normal; // 최종 노멀 (normal map 포함)
 };
 
 float3 SampleMaterialTexture(uint index, TextureParams tex, float2 uv, float3 worldPos, float3 worldNormal)
@@ -109,14 +109,14 @@ EvaluatedMaterial EvaluateMaterial(MaterialBuffer mat, float2 uv, float3 worldPo
 
     TextureParams tex = mat.baseTextures;
 
-    // Diffuse ؽó
+    // Diffuse 텍스처
     if (tex.diffuseIndex != INVALID_TEXTURE_INDEX)
     {
         float3 texAlbedo = SampleMaterialTexture(tex.diffuseIndex, tex, uv, worldPos, worldNormal);
         outMat.albedo *= texAlbedo;
     }
 
-    // ARM ؽ
+    // ARM 텍스쳐
     if (tex.armIndex != INVALID_TEXTURE_INDEX)
     {
         float3 arm = SampleMaterialTexture(tex.armIndex, tex, uv, worldPos, worldNormal);
@@ -139,7 +139,7 @@ EvaluatedMaterial EvaluateMaterial(MaterialBuffer mat, float2 uv, float3 worldPo
         outMat.emissive = SampleMaterialTexture(tex.emissiveIndex, tex, uv, worldPos, worldNormal);
     }
 
-    // Normal (normal map   )
+    // Normal (normal map 포함 최종 노멀)
     outMat.normal = SampleNormal(tex.normalIndex, tex, uv, worldPos, worldNormal, worldTan, tangentSign);
 
     return outMat;
@@ -20,10 +20,10 @@ void GSMain(triangle PSInput tri[3], inout LineStream<PSInput> outStream)
         PSInput v0 = tri[i];
         v0.Color = float4(0.0f, 1.0f, 0.0f, 1.0f);
 
-        // 忡 븻  gNormalLengthŭ ̵
+        // 월드에서 노말 방향으로 gNormalLength만큼 이동
         float3 endWorld = tri[i].WorldPos + normalize(tri[i].WorldNormal) * 1.0f;
 
-        // clip-space ȯ
+        // clip-space로 변환
         float4 endClip = mul(float4(endWorld, 1.0f), gViewProj);
 
         PSInput v1 = v0;
@@ -1,6 +1,6 @@
 // ---------------------------------------------
 // PBR.hlsli
-// - Cook-Torrance based PBR ƿ Լ
+// - Cook-Torrance based PBR 유틸 함수
 // ---------------------------------------------
 #ifndef PBR_HLSLI
 #define PBR_HLSLI
@@ -27,7 +27,7 @@ float GeometrySchlickGGX(float NdotV, float roughness)
     return NdotV / (NdotV * (1.0f - k) + k);
 }
 
-// Smiths method
+// Smith’s method
 float GeometrySmith(float3 N, float3 V, float3 L, float roughness)
 {
     float ggx1 = GeometrySchlickGGX(max(dot(N, V), 0.0f), roughness);
@@ -35,7 +35,7 @@ float GeometrySmith(float3 N, float3 V, float3 L, float roughness)
     return ggx1 * ggx2;
 }
 
-// Fresnel Schlick ٻ
+// Fresnel Schlick 근사
 float3 FresnelSchlick(float cosTheta, float3 F0)
 {
     return F0 + (1.0f - F0) * pow(1.0f - cosTheta, 5.0f);
@@ -1,6 +1,6 @@
 // --------------------------------------
 // Texture.hlsli
-// - Texture, Sampler    Լ
+// - Texture, Sampler 정의 및 헬퍼 함수
 // --------------------------------------
 #ifndef TEXTURE_HLSLI
 #define TEXTURE_HLSLI
@@ -13,6 +13,9 @@
 #include "Core/Scene/Object/PlayerController.h"
 #include "Core/Scene/Object/Pawn.h"
 #include "Core/Geometry/Mesh/Mesh.h"
+#include "Core/Geometry/MarchingCubes/SdfFieldOps.h"
+#include "Core/Geometry/MarchingCubes/SdfHeightmapImport.h"
+#include "Core/Assets/ResourceManager.h"
 #include <algorithm>
 
 Scene_Terraform::Scene_Terraform() :
@@ -39,7 +42,7 @@ void Scene_Terraform::Init()
 	XMFLOAT3 lightDir = m_directionalLight->GetTransformComponent()->GetForward();
 	m_lightDir = { lightDir.x, lightDir.y, lightDir.z };
 
-	// TerrainSystem ʱȭ
+	// TerrainSystem 초기화
 	{
 		GridDesc gridDesc{};
 		gridDesc.chunkSize = 50u;
@@ -56,7 +59,7 @@ void Scene_Terraform::Init()
 		m_terrain->requestRemesh(EngineCore::GetFrameIndex(), m_mcIso);
 	}
 
-	// Terrain Object 
+	// Terrain Object 생성
 	{
 		m_terrainRenderer = CreateObject<SceneObject>();
 		m_terrainRenderer->SetPosition(m_gridOrigin);
@@ -65,7 +68,7 @@ void Scene_Terraform::Init()
 		terrainComponent->SetMaterial(0);
 	}
 #ifdef _DEBUG	
-	// Debug Terrain Cell 
+	// Debug Terrain Cell 생성
 	{
 		GeometryData debugcellData;
 		m_terrain->MakeDebugCell(debugcellData, false);
@@ -75,7 +78,7 @@ void Scene_Terraform::Init()
 		m_editorMeshes.push_back(std::move(mesh));
 	}
 
-	// Debug Brush 
+	// Debug Brush 생성
 	{
 		GeometryData debugBrushData = MeshGenerator::CreateSphereMeshData(m_brushRadius, { 1.0f, 0.0f, 0.0f, 0.4f });
 		auto mesh = std::make_unique<Mesh>(EngineCore::GetUploadContext(), debugBrushData, "DebugBrush");
@@ -108,8 +111,14 @@ void Scene_Terraform::InitUI(IUIRenderer* ui)
 void Scene_Terraform::Update(float deltaTime)
 {
 	Scene::Update(deltaTime);
-	// 콺  ư (Terraform)
+	// 마우스 좌 버튼 (Terraform)
 	const bool terraformHeld = EngineCore::GetInputState()->m_leftBtnState == ActionKeyState::Pressed;
+	if (!terraformHeld && m_terraforming)
+	{
+		// 스트로크 종료 : brush 블렌딩으로 흐트러진 영역을 거리장으로 복원
+		m_terrain->endStroke(EngineCore::GetFrameIndex(), m_mcIso);
+	}
+	m_terraforming = terraformHeld;
 	if (terraformHeld)
 	{
 		MeshChunkRenderer* terrainRenderer = m_terrain->GetRenderer();
@@ -124,29 +133,57 @@ void Scene_Terraform::Update(float deltaTime)
 			m_mainCamera->GetViewProjMatrix(), 
 			rayOrigin, rayDir);
 
-		std::vector<PhysicsUtil::RaycastTarget> targets;
-		auto& terrainChunks = terrainRenderer->GetChunkSlots();
-		for (const auto& chunk : terrainChunks)
+		// 지형 로컬 공간으로 변환 후 피킹
+		const XMMATRIX terrainWorld = m_terrainRenderer->GetWorldMatrix();
+		const XMMATRIX invTerrainWorld = XMMatrixInverse(nullptr, terrainWorld);
+		XMFLOAT3 hitPos{};
+		XMFLOAT3 hitposLS{};
+		bool hit = false;
+
+		if (m_terrain->canRaycastField())
+		{
+			// CPU 필드 직접 레이 추적 : 메시 크기/청크 재메싱 대기와 무관
+			XMFLOAT3 rayOriginLS, rayDirLS;
+			XMStoreFloat3(&rayOriginLS, XMVector3TransformCoord(rayOrigin, invTerrainWorld));
+			XMStoreFloat3(&rayDirLS, XMVector3TransformNormal(rayDir, invTerrainWorld));
+
+			SdfRaycast::Hit fieldHit;
+			hit = m_terrain->raycast(rayOriginLS, rayDirLS, m_mcIso, fieldHit);
+			if (hit)
+			{
+				hitposLS = fieldHit.position;
+				XMStoreFloat3(&hitPos, XMVector3TransformCoord(XMLoadFloat3(&hitposLS), terrainWorld));
+			}
+		}
+		else
 		{
-			targets.push_back(PhysicsUtil::RaycastTarget{
-				.data = &chunk->meshData,
-				.bounds = chunk->bounds,
-				.worldMatrix = m_terrainRenderer->GetWorldMatrix()
-				});
+			// GPU 백엔드 : 필드가 GPU에만 있으므로 청크 메시 RayCast (청크별 BVH, 가까운 청크부터)
+			std::vector<PhysicsUtil::RaycastTarget> targets;
+			terrainRenderer->BuildMissingBVHs();
+			auto& terrainChunks = terrainRenderer->GetChunkSlots();
+			for (const auto& chunk : terrainChunks)
+			{
+				targets.push_back(PhysicsUtil::RaycastTarget{
+					.data = &chunk->meshData,
+					.bounds = chunk->bounds,
+					.worldMatrix = terrainWorld,
+					.bvh = chunk->bvh.get()
+					});
+			}
+
+			hit = PhysicsUtil::IsHit(targets, rayOrigin, rayDir, hitPos);
+			if (hit)
+			{
+				XMStoreFloat3(&hitposLS, XMVector3TransformCoord(XMLoadFloat3(&hitPos), invTerrainWorld));
+			}
 		}
 
-		// RayCast terrainMesh ŷ Ȯ
-		XMFLOAT3 hitPos{};
-		if (PhysicsUtil::IsHit(targets, rayOrigin, rayDir, hitPos))
+		if (hit)
 		{
 #ifdef _DEBUG
-			// Hit ߻ ġ  
+			// Hit가 발생한 위치에 원 세팅
 			m_debugBrush->SetPosition(hitPos);
 #endif // DEBUG
-			XMVECTOR vHitposLS = XMVector3TransformCoord(XMLoadFloat3(&hitPos), XMMatrixInverse(nullptr, m_terrainRenderer->GetWorldMatrix()));
-			XMFLOAT3 hitposLS;
-			XMStoreFloat3(&hitposLS, vHitposLS);
-
 			BrushRequest req_brush{
 				.hitpos = hitposLS,
 				.radius = m_brushRadius,
@@ -160,7 +197,7 @@ void Scene_Terraform::Update(float deltaTime)
 	m_terrain->tryFetch();
 }
 
-// SceneObject   Ÿֿ̹ ʿ ۾ 
+// SceneObject를 제외한 렌더 타이밍에 필요한 작업은 이쪽으로
 void Scene_Terraform::Render()
 {
 	Scene::Render();
@@ -226,20 +263,81 @@ void Scene_Terraform::RenderMarchingCubesUI()
 	ImGui::Text("Brush Strength");
 	ImGui::DragFloat("##Brush Strength", &m_brushStrength, 1.0f, 1.0f, 10.0f, "%.3f", ImGuiSliderFlags_AlwaysClamp);
 	ImGui::Separator();
+
+	ImGui::Text("Backend");
+	static const char* kModeNames[] = { "CPU MC33", "CPU MC", "GPU" };
+	int mode = static_cast<int>(m_terrain->getMode());
+	if (ImGui::Combo("##Backend", &mode, kModeNames, IM_ARRAYSIZE(kModeNames)))
+	{
+		m_terrain->setMode(EngineCore::GetDevice(), static_cast<TerrainMode>(mode));
+		m_terrain->requestRemesh(EngineCore::GetFrameIndex(), m_mcIso);
+	}
+
+	ImGui::Text("Iso Value");
+	if (ImGui::DragFloat("##Iso Value", &m_mcIso, 0.005f, -1.0f, 1.0f, "%.3f", ImGuiSliderFlags_AlwaysClamp))
+	{
+		m_terrain->requestRemesh(EngineCore::GetFrameIndex(), m_mcIso);
+	}
+
+	bool isoScrub = m_terrain->isIsoScrub();
+	if (ImGui::Checkbox("Iso Scrub (Active Cells Only)", &isoScrub))
+	{
+		m_terrain->setIsoScrub(isoScrub);
+	}
+
+	bool mipPyramid = m_terrain->isMipPyramid();
+	if (ImGui::Checkbox("Mip Pyramid (Raycast Skip)", &mipPyramid))
+	{
+		m_terrain->setMipPyramid(mipPyramid);
+	}
+	ImGui::Separator();
+	ImGui::Text("Field Layout");
+	static const char* kLayoutNames[] = { "Linear", "Brick 4^3", "Brick 8^3" };
+	ImGui::Combo("##Field Layout", &m_fieldLayout, kLayoutNames, IM_ARRAYSIZE(kLayoutNames));
 	if (ImGui::Button("Generate"))
 	{
 		GridDesc gridDesc{ .chunkSize = 50u };
-		auto newSdf = MakeSphereGrid(m_gridTiles, static_cast<float>(m_cellSize), 25.0f, m_gridOrigin, gridDesc);
+		auto newSdf = MakeSphereGrid(m_gridTiles, static_cast<float>(m_cellSize), 25.0f, m_gridOrigin, gridDesc, static_cast<SdfLayout>(m_fieldLayout));
 		m_terrain->setGridDesc(EngineCore::GetDevice(), gridDesc);
 		m_terrain->setField(EngineCore::GetDevice(), newSdf);
 		m_terrain->requestRemesh(EngineCore::GetFrameIndex(), m_mcIso);
 
 		m_debugCell->SetPosition(m_gridOrigin);
 	}
+
+	ImGui::Separator();
+	ImGui::Text("Heightmap (16-bit RAW / PGM)");
+	ImGui::InputText("##Heightmap Path", m_heightmapPath.data(), m_heightmapPath.size());
+	ImGui::DragFloat("Height Scale", &m_heightmapScale, 1.0f, 1.0f, 1000.0f, "%.1f", ImGuiSliderFlags_AlwaysClamp);
+	if (ImGui::Button("Import Heightmap"))
+	{
+		GridDesc gridDesc{ .chunkSize = 50u };
+		auto newSdf = MakeHeightmapGrid(m_heightmapPath.data(), m_gridTiles, static_cast<float>(m_cellSize), m_heightmapScale, m_gridOrigin, gridDesc, static_cast<SdfLayout>(m_fieldLayout));
+		if (newSdf)
+		{
+			m_terrain->setGridDesc(EngineCore::GetDevice(), gridDesc);
+			m_terrain->setField(EngineCore::GetDevice(), newSdf);
+			m_terrain->requestRemesh(EngineCore::GetFrameIndex(), m_mcIso);
+
+			m_debugCell->SetPosition(m_gridOrigin);
+		}
+	}
+
+	ImGui::Separator();
+	ImGui::Text("Mesh Stamp (FBX)");
+	ImGui::InputText("##Stamp Mesh Path", m_stampPath.data(), m_stampPath.size());
+	ImGui::DragFloat("Stamp Size", &m_stampSize, 1.0f, 1.0f, 500.0f, "%.1f", ImGuiSliderFlags_AlwaysClamp);
+	static const char* kStampOperationNames[] = { "Replace", "Union", "Subtract", "Intersect" };
+	ImGui::Combo("##Stamp Operation", &m_stampOperation, kStampOperationNames, IM_ARRAYSIZE(kStampOperationNames));
+	if (ImGui::Button("Stamp Mesh"))
+	{
+		const std::filesystem::path relativePath = m_stampPath[0] ? std::filesystem::path(m_stampPath.data()) : std::filesystem::path(L"Model/Killer-whale/killer-whale.FBX");
+		StampMeshAsset(GetFullPath(AssetType::Default, relativePath.c_str()));
+	}
 	ImGui::End();
 }
 
-std::shared_ptr<SdfField<float>> Scene_Terraform::MakeSphereGrid(unsigned int N, float cellSize, float radius, XMFLOAT3 center, GridDesc& OutGridDesc)
+std::shared_ptr<SdfField<float>> Scene_Terraform::MakeSphereGrid(unsigned int N, float cellSize, float radius, XMFLOAT3 center, GridDesc& OutGridDesc, SdfLayout layout)
 {
 	const float half = 0.5f * (float)N;
 	XMFLOAT3 origin = { center.x - half * cellSize, center.y - half * cellSize, center.z - half * cellSize };
@@ -248,27 +346,91 @@ std::shared_ptr<SdfField<float>> Scene_Terraform::MakeSphereGrid(unsigned int N,
 	OutGridDesc.cellsize = cellSize;
 	OutGridDesc.origin = origin;
 
-	//   = (N+1)^3
+	// 샘플 수 = (N+1)^3
+	const int SX = N + 1, SY = N + 1, SZ = N + 1;
+
+	auto gridData = new SdfField<float>(SX, SY, SZ, layout);
+
+	// 채우기: F = brushRadius - |p - center| (내부>0, 표면=0, 외부<0)
+	SdfFieldOps::ApplyRegion(*gridData, { 0, 0, 0 }, { SX, SY, SZ }, [&](int x, int y, int z, float& value) {
+		const float dx = (x - half) * cellSize;
+		const float dy = (y - half) * cellSize;
+		const float dz = (z - half) * cellSize;
+		const float dist = sqrtf(dx * dx + dy * dy + dz * dz);
+		value = std::clamp((radius - dist) / N, -1.0f, 1.0f);
+	});
+	m_mcIso = 0.0f;
+
+	return std::shared_ptr<SdfField<float>>(gridData);
+}
+
+std::shared_ptr<SdfField<float>> Scene_Terraform::MakeHeightmapGrid(const std::filesystem::path& path, unsigned int N, float cellSize, float heightScale, XMFLOAT3 center, GridDesc& OutGridDesc, SdfLayout layout)
+{
+	const float half = 0.5f * (float)N;
+	XMFLOAT3 origin = { center.x - half * cellSize, center.y - half * cellSize, center.z - half * cellSize };
+
+	GridDesc gridDesc = OutGridDesc;
+	gridDesc.cells = { N, N, N };
+	gridDesc.cellsize = cellSize;
+	gridDesc.origin = origin;
+
 	const int SX = N + 1, SY = N + 1, SZ = N + 1;
+	auto gridData = std::make_shared<SdfField<float>>(SX, SY, SZ, layout);
 
-	// ä: F = brushRadius - |p - center|
-	auto gridData = new SdfField<float>(SX, SY, SZ);
-	for (int z = 0; z < SZ; ++z)
+	// 바닥 한 셀 위부터 heightScale 만큼, 값 스케일은 구 필드와 같은 (거리 / N)
+	const SdfHeightmapImport::Desc desc{
+		.heightScale = std::min(heightScale, (N - 2) * cellSize),
+		.heightOffset = origin.y + cellSize,
+		.valueScale = 1.0f / N,
+		.clampValue = 1.0f
+	};
+	try
 	{
-		float dz = (z - half) * cellSize;
-		for (int y = 0; y < SY; ++y)
-		{
-			float dy = (y - half) * cellSize;
-			for (int x = 0; x < SX; ++x)
-			{
-				// >0, ǥ=0, ܺ<0
-				float dx = (x - half) * cellSize;
-				const float dist = sqrtf(dx * dx + dy * dy + dz * dz);
-				gridData->at(x, y, z) = std::clamp((radius - dist) / N, -1.0f, 1.0f);
-			}
-		}
+		SdfHeightmapImport::Import({ .path = path }, gridDesc, *gridData, desc);
+	}
+	catch (const std::exception& e)
+	{
+		Log::Print("Scene_Terraform", "Heightmap import failed: %s", e.what());
+		return nullptr;
 	}
+
+	OutGridDesc = gridDesc;
 	m_mcIso = 0.0f;
+	return gridData;
+}
 
-	return std::shared_ptr<SdfField<float>>(gridData);
+void Scene_Terraform::StampMeshAsset(const std::filesystem::path& path)
+{
+	ResourceManager* resourceManager = EngineCore::GetResourceManager();
+	if (!resourceManager || !m_terrain->canRaycastField()) return;
+
+	if (!resourceManager->GetMeshAsset(path) && !resourceManager->LoadMeshAsset(path, MeshImportOptions{})) return;
+	const MeshAsset* asset = resourceManager->GetMeshAsset(path);
+	if (!asset) return;
+
+	// 가장 긴 변이 m_stampSize 가 되도록 맞춰 격자 중심에 배치
+	TriangleBVH meshBVH;
+	SdfMeshVoxelizer::BuildBVH(*asset, XMMatrixIdentity(), meshBVH);
+	if (meshBVH.IsEmpty()) return;
+
+	const BoundingBox& bounds = meshBVH.GetBounds();
+	const float longest = 2.0f * std::max({ bounds.Extents.x, bounds.Extents.y, bounds.Extents.z });
+	const float scale = longest > 0.0f ? m_stampSize / longest : 1.0f;
+	const XMMATRIX meshToGrid = XMMatrixTranslation(-bounds.Center.x, -bounds.Center.y, -bounds.Center.z)
+		* XMMatrixScaling(scale, scale, scale)
+		* XMMatrixTranslation(m_gridOrigin.x, m_gridOrigin.y, m_gridOrigin.z);
+	SdfMeshVoxelizer::BuildBVH(*asset, meshToGrid, meshBVH);
+
+	// 값 스케일은 구 필드와 같은 (거리 / N)
+	const SdfMeshVoxelizer::Desc desc{
+		.operation = static_cast<SdfMeshVoxelizer::Operation>(m_stampOperation),
+		.valueScale = 1.0f / m_gridTiles,
+		.isoValue = m_mcIso
+	};
+	SdfMeshVoxelizer::Stats stats;
+	if (m_terrain->stampMesh(EngineCore::GetFrameIndex(), meshBVH, desc, &stats))
+	{
+		Log::Print("Scene_Terraform", "Mesh stamp: %zu triangles, %u bricks (%u near surface), %llu winding queries",
+			meshBVH.GetTriangleCount(), stats.bricks, stats.nearBricks, static_cast<unsigned long long>(stats.windingQueries));
+	}
 }
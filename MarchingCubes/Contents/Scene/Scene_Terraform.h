@@ -23,7 +23,9 @@ private:
     void RenderMarchingCubesUI();
 
     //Marching Cubes
-    std::shared_ptr<SdfField<float>> MakeSphereGrid(unsigned int N, float cellSize, float radius, XMFLOAT3 center, GridDesc& OutGridDesc);
+    std::shared_ptr<SdfField<float>> MakeSphereGrid(unsigned int N, float cellSize, float radius, XMFLOAT3 center, GridDesc& OutGridDesc, SdfLayout layout = SdfLayout::Linear);
+    std::shared_ptr<SdfField<float>> MakeHeightmapGrid(const std::filesystem::path& path, unsigned int N, float cellSize, float heightScale, XMFLOAT3 center, GridDesc& OutGridDesc, SdfLayout layout = SdfLayout::Linear);
+    void StampMeshAsset(const std::filesystem::path& path);
 
 private:
     // Marching Cubes
@@ -42,7 +44,14 @@ private:
     int m_cellSize = 1;
     float m_brushRadius = 3.0f;
     float m_brushStrength = 5.0f;
+    bool m_terraforming = false;
     float m_mcIso = 0.0f;
+    int m_fieldLayout = 0; // SdfLayout
+    std::array<char, 260> m_heightmapPath{};
+    float m_heightmapScale = 40.0f;
+    std::array<char, 260> m_stampPath{};  // Assets 기준 상대 경로, 비어 있으면 killer-whale
+    float m_stampSize = 40.0f;
+    int m_stampOperation = 1; // SdfMeshVoxelizer::Operation
     std::array<float, 3> m_lightDir = { -1.0f, -1.0f, -1.0f };
     float m_cameraSpeed = 100.0f;
 
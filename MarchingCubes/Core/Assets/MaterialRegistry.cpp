@@ -69,7 +69,7 @@ uint32_t MaterialRegistry::AddMaterial(const Material& data)
 
 uint32_t MaterialRegistry::LoadMaterial(const std::wstring& path)
 {
-	// TODO : .mat  ε 
+	// TODO : .mat 파일 로드 구현
 	return UINT32_MAX;
 }
 
@@ -3,15 +3,15 @@
 
 struct ImportedMaterialDesc
 {
-    uint32_t internalMaterialIndex = 0;     //    material index
-    std::string name;                  // material ̸
+    uint32_t internalMaterialIndex = 0;     // 에셋 파일 내부 material index
+    std::string name;                  // material 이름
 
-    // ؽ  ε (FBX    Ǵ ʵ )
-    std::wstring diffusePath;          // ˺/̽÷
-    std::wstring normalPath;           // 
-    std::wstring roughnessPath;        // Ͻ
-    std::wstring metallicPath;         // Ż
-    std::wstring emissivePath;         // ̽ú
+    // 텍스쳐 파일 경로들 (FBX에서 가져온 원본 경로 또는 리맵된 경로)
+    std::wstring diffusePath;          // 알베도/베이스컬러
+    std::wstring normalPath;           // 노멀
+    std::wstring roughnessPath;        // 러프니스
+    std::wstring metallicPath;         // 메탈릭
+    std::wstring emissivePath;         // 에미시브
 
     DirectX::XMFLOAT3 diffuseColor = { 1,1,1 };
 
@@ -37,9 +37,9 @@ public:
 
 private:
     std::filesystem::path m_sourcePath;
-    //std::filesystem::path m_cachePath;   //TODO : Ϳ DDC(Derived Data Cache)   Ȱȭ
+    //std::filesystem::path m_cachePath;   //TODO : 에디터용 DDC(Derived Data Cache) 사용 시 활성화
     GeometryData m_data;
-    std::vector<MeshSubmesh> m_subMeshes; // Material Slot   ǵ ߰ 
+    std::vector<MeshSubmesh> m_subMeshes; // Material Slot 등 사전 정의된 추가 정보들
     std::vector<ImportedMaterialDesc> m_materialDescs;
 };
 
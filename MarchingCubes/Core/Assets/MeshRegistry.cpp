@@ -16,11 +16,11 @@ void MeshRegistry::RegisterAsset(std::string_view key, std::unique_ptr<MeshAsset
 
 std::shared_ptr<Mesh> MeshRegistry::CreateMeshFromAsset(std::string_view key)
 {
-	// ̹ GPU ҽ  ȯ
+	// 이미 GPU 리소스가 있으면 반환
 	auto resIt = m_resourceCache.find(key.data());
 	if (resIt != m_resourceCache.end()) return resIt->second;
 
-	// Asset  ã
+	// Asset 데이터 찾기
 	auto assetIt = m_assetCache.find(key.data());
 	if (assetIt == m_assetCache.end()) return nullptr;
 
@@ -46,7 +46,7 @@ void ResourceManager::BuildTables(ID3D12GraphicsCommandList* cmd)
 	m_materialRegistry->BuildTable(cmd);
 }
 
-// ؽ ε (  ִ    ҽ ٲ ʴ´ٰ )
+// 텍스쳐 로드 (엔진이 켜져 있는 동안 동일한 경로의 리소스는 바뀌지 않는다고 가정)
 uint32_t ResourceManager::LoadTexture(const std::filesystem::path& path)
 {
 	return m_textureRegistry->LoadTexture(path);
@@ -121,7 +121,7 @@ void ResourceManager::ProcessMaterials(const std::filesystem::path& basePath, co
 			return m_textureRegistry->LoadTexture(finalPath);
 		};
 
-		// ؽó ε -> Material ε
+		// 텍스처 로드 -> Material에 바인딩
 		if (!desc.diffusePath.empty())   matCpu.SetDiffuseTex(loadTex(desc.diffusePath));
 		if (!desc.normalPath.empty())    matCpu.SetNormalTex(loadTex(desc.normalPath));
 		if (!desc.roughnessPath.empty()) matCpu.SetRoughTex(loadTex(desc.roughnessPath));
@@ -136,25 +136,25 @@ std::filesystem::path ResourceManager::ResolveTexturePath(const std::filesystem:
 {
 	if (texRelativePath.empty()) return "";
 
-	// ״ ϸ  (  )
+	// 그대로 존재하면 사용 (절대 경로 등)
 	if (std::filesystem::exists(texRelativePath)) return texRelativePath;
 
-	// FBX ϰ   Ȯ
+	// FBX 파일과 같은 폴더 확인
 	auto fileName = texRelativePath.filename();
 	std::filesystem::path siblingPath = fbxPath.parent_path() / fileName;
 	if (std::filesystem::exists(siblingPath)) return siblingPath;
 
-	// DDS ؽ Ȯ(Contents/Textures/...)
+	// DDS 텍스쳐 확인(Contents/Textures/...)
 	auto parentDir = fbxPath.parent_path().filename();
 	auto contentsRelativePath = parentDir / fileName;
 	auto ddsPath = GetFullPath(AssetType::Texture, contentsRelativePath.c_str());
 	if (std::filesystem::exists(ddsPath)) return ddsPath;
 
-	// PNG  WIC ؽ Ȯ(Assets/Textures/...)
+	// PNG 등 WIC 텍스쳐 확인(Assets/Textures/...)
 	auto assetDir = fbxPath.parent_path().parent_path().parent_path();
 	auto wicPath = assetDir / "Textures" / parentDir / fileName;
 	if (std::filesystem::exists(wicPath)) return wicPath;
 
-	//  ã  ̸  (TextureRegistry  óϰų ⺻ ؽó )
+	// 못 찾았으면 원본 이름만 리턴 (TextureRegistry가 실패 처리하거나 기본 텍스처 사용)
 	return fileName;
 }
@@ -11,12 +11,12 @@
 * - OwnerShip : Engine
 * - Access : Engine::GetResourceManager()
 * - Responsibility : 
-* 	- GeometryData : .obj  εϿ / 
-* 	- AnimData : .anim  εϿ / 
-* 	- SoundData : .wav    εϿ / 
-* 	- Texture : .dds, .png  ؽ  εϿ D3D12_SUBRESOURCE_DATA / 
-* 	- SceneData : .scene   ͷ ۾   + εϿ SceneData / 
-* 	- DataAsset : .xml, .tex  raw ͸ / 
+* 	- GeometryData : .obj 파일을 로드하여 소유/참조 전달
+* 	- AnimData : .anim 파일을 로드하여 소유/참조 전달
+* 	- SoundData : .wav 등 사운드 파일을 로드하여 소유/참조 전달
+* 	- Texture : .dds, .png 등 텍스쳐 파일을 로드하여 D3D12_SUBRESOURCE_DATA를 소유/참조 전달
+* 	- SceneData : .scene 과 같이 에디터로 작업한 내역을 저장 + 로드하여 SceneData를 소유/참조 전달
+* 	- DataAsset : .xml, .tex 등 raw 데이터를 관리/참조 전달
 */
 
 // Forward Declaration
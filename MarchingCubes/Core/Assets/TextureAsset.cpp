@@ -2,7 +2,7 @@
 #include "TextureAsset.h"
 #include <algorithm>
 
-// TODO : Ÿ// и  TexImporter ؽ   ű
+// TODO : 런타임/에디터/툴 분리 시 TexImporter를 텍스쳐 임포터 툴로 옮기기
 namespace TexImporter
 {
     bool IsDDSPath(const std::filesystem::path& path)
@@ -43,7 +43,7 @@ namespace TexImporter
 
     TextureSemantic DetectSemanticFromName(const std::filesystem::path& path)
     {
-        // ϸ(Ȯ )  ǹ ߷
+        // 파일명(확장자 제거) 기준으로 의미 추론
         std::wstring stem = ToLowerCopy(path.stem().wstring()); // e.g. "rock_albedo"
 
         auto hasSuffix = [&](std::wstring_view suffix)
@@ -100,12 +100,12 @@ namespace TexImporter
             case TS::Roughness:
             case TS::Metalness:
             case TS::AO:
-                p.targetFormat = DXGI_FORMAT_BC4_UNORM; //  ä ⺻
+                p.targetFormat = DXGI_FORMAT_BC4_UNORM; // 단일 채널 기본
                 p.bSRGB = false;
                 p.bMip = true;
                 break;
             case TS::ARM: // packed rough/metal/ao
-                p.targetFormat = DXGI_FORMAT_BC7_UNORM; // ä ŷ
+                p.targetFormat = DXGI_FORMAT_BC7_UNORM; // 채널 패킹용
                 p.bSRGB = false;
                 p.bMip = true;
                 break;
@@ -132,7 +132,7 @@ namespace TexImporter
                 break;
             case TS::Unknown:
             default:
-                p.targetFormat = DXGI_FORMAT_UNKNOWN; // meta.format ״ 
+                p.targetFormat = DXGI_FORMAT_UNKNOWN; // meta.format 그대로 사용
                 p.bSRGB = true;
                 p.bMip = true;
                 break;
@@ -151,7 +151,7 @@ TextureAsset::TextureAsset(const std::filesystem::path& sourcePath, const std::f
 
     if (TexImporter::IsDDSPath(fullPath))
     {
-        // DDS  ε
+        // DDS 파일 로드
         ThrowIfFailed(DirectX::LoadFromDDSFile(fullPath.c_str(), DirectX::DDS_FLAGS_NONE, nullptr, *m_image));
     }
     else if (TexImporter::IsWICPath(fullPath))
@@ -159,7 +159,7 @@ TextureAsset::TextureAsset(const std::filesystem::path& sourcePath, const std::f
         DirectX::ScratchImage tempImage;
         ThrowIfFailed(DirectX::LoadFromWICFile(fullPath.c_str(), DirectX::WIC_FLAGS_NONE, nullptr, tempImage));
 
-        // Ӹ 
+        // 밉맵 생성
         DirectX::ScratchImage mipChain;
         HRESULT hr = DirectX::GenerateMipMaps(
             tempImage.GetImages(),
@@ -176,13 +176,13 @@ TextureAsset::TextureAsset(const std::filesystem::path& sourcePath, const std::f
         }
         else
         {
-            // Ӹ   (Ȥ 2D ƴ )  ״ 
+            // 밉맵 생성 실패 시(혹은 2D가 아닐 경우) 원본 그대로 사용
             *m_image = std::move(tempImage);
         }
     }
     else
     {
-        // Ȯڰ ų  ʴ ,  ó  .dds ٿ õϰų  ó
+        // 확장자가 없거나 지원하지 않는 경우, 기존 로직처럼 강제로 .dds를 붙여서 시도하거나 에러 처리
         std::filesystem::path ddsPath = fullPath;
         ddsPath.replace_extension(L".dds");
         ThrowIfFailed(DirectX::LoadFromDDSFile(ddsPath.c_str(), DirectX::DDS_FLAGS_NONE, nullptr, *m_image));
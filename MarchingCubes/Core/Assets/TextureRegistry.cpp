@@ -40,7 +40,7 @@ void TextureRegistry::BindDescriptorTable(ID3D12GraphicsCommandList* cmd)
 
 uint32_t TextureRegistry::LoadTexture(const std::filesystem::path& logicalPath)
 {
-	// ̹ εǾ ִ Ȯ
+	// 이미 로드되어 있는지 확인
 	for (uint32_t i = 0; i < static_cast<uint32_t>(m_textures.size()); ++i)
 	{
 		if (m_textures[i].path == logicalPath) return i;
@@ -50,7 +50,7 @@ uint32_t TextureRegistry::LoadTexture(const std::filesystem::path& logicalPath)
 	const auto& img = asset.GetImage();
 	const auto& meta = asset.GetMetadata();
 
-	// GPU ҽ 
+	// GPU 리소스 생성
 	ComPtr<ID3D12Resource> res;
 	ThrowIfFailed(DirectX::CreateTexture(m_device, meta, &res));
 
@@ -68,7 +68,7 @@ uint32_t TextureRegistry::LoadTexture(const std::filesystem::path& logicalPath)
 	}
 	else
 	{
-		// TODO: 1D/3D/Array  ʿ   Ȯ
+		// TODO: 1D/3D/Array 대응 필요 시 여기 확장
 	}
 
 	auto cpuHandle = m_descriptorAllocator->GetStaticCpu(bindlessSlot);
@@ -1,5 +1,6 @@
 #pragma once
 #include <vector>
+#include <algorithm>
 #include <d3dcommon.h>
 #include <DirectXMath.h>
 #include <cstdint>
@@ -20,6 +21,33 @@ struct GeometryData
 	D3D_PRIMITIVE_TOPOLOGY topology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 };
 
+// GeometryData 안의 부분 구간 (부분 업로드용, 정점/인덱스 개수 단위)
+struct GeometryRange
+{
+	uint32_t vertexOffset = 0;
+	uint32_t vertexCount = 0;
+	uint32_t indexOffset = 0;
+	uint32_t indexCount = 0;
+};
+
+// ranges 순서대로 이어 붙인 patch(정점/인덱스)를 target의 각 구간에 덮어쓴다. 구간이 target을 벗어나면 false
+inline bool ApplyGeometryPatch(GeometryData& target, const GeometryData& patch, const std::vector<GeometryRange>& ranges)
+{
+	size_t vertexCursor = 0;
+	size_t indexCursor = 0;
+	for (const GeometryRange& r : ranges)
+	{
+		if (size_t(r.vertexOffset) + r.vertexCount > target.vertices.size() || vertexCursor + r.vertexCount > patch.vertices.size()) return false;
+		if (size_t(r.indexOffset) + r.indexCount > target.indices.size() || indexCursor + r.indexCount > patch.indices.size()) return false;
+
+		std::copy_n(patch.vertices.begin() + vertexCursor, r.vertexCount, target.vertices.begin() + r.vertexOffset);
+		std::copy_n(patch.indices.begin() + indexCursor, r.indexCount, target.indices.begin() + r.indexOffset);
+		vertexCursor += r.vertexCount;
+		indexCursor += r.indexCount;
+	}
+	return true;
+}
+
 struct MeshSubmesh
 {
 	uint32_t indexCount = 0;
@@ -54,15 +54,15 @@ struct alignas(16) TextureParams
 
 struct alignas(16) MaterialConstants
 {
-	XMFLOAT3 albedo;    // albedo  (RGB)
+	XMFLOAT3 albedo;    // albedo 색상 (RGB)
 	float metallic;				 // [0,1]
 
-	float specularStrength;		 // ݼ ݻ  [0,0.08]
+	float specularStrength;		 // 비금속 반사 강도 [0,0.08]
 	float roughness;			 // [0,1]
 	float ao;					 // AmbientOcclusion
-	float ior;					 // Dielectric   
+	float ior;					 // Dielectric 모델 전용 굴절률
 
-	EShadingModel shadingModel = EShadingModel::DefaultLit;	 // ݻ 𵨸 Ÿ
+	EShadingModel shadingModel = EShadingModel::DefaultLit;	 // 반사 모델링 타입
 	float opacity = 1.0f;
 	uint32_t _padding[2];
 
@@ -77,8 +77,8 @@ enum class ELightType : uint32_t
 };
 
 /*
-* LightType  ʿ 
-* ⺻ : type, radiance
+* LightType 별 필요한 데이터
+* 기본 : type, radiance
 * Directional : dir
 * Point : pos, range
 * Spot : pos, range, spotDir, spotInnerCos
@@ -100,7 +100,7 @@ struct alignas(16) LightConstants
 {
 	uint32_t lightCounts;
 	uint32_t _padding[3];
-	Light lights[1]; // ũ ҴϿ 
+	Light lights[1]; //가변 크기로 할당하여 사용
 };
 
 struct alignas(16) LightConstantsHeader
@@ -29,13 +29,13 @@ public:
     static void SetFrameIndex(uint32_t frameIndex) { s_frameIndex = frameIndex; }
 
 private:
-    //    
+    // 실제 정적 포인터 변수들
     static ID3D12Device* s_device;
     static RenderSystem* s_renderSystem;
     static ResourceManager* s_resourceManager;
-    static InputState* s_inputState; // Scene Ȥ GameMode Input ޵ ϴ°?
+    static InputState* s_inputState; // Scene 혹은 GameMode에서 Input을 받도록 하는게?
     static UploadContext* s_uploadContext;
-    static DescriptorAllocator* s_descriptorAllocator; // Scene PrepareRender ʿ
+    static DescriptorAllocator* s_descriptorAllocator; // Scene의 PrepareRender에서만 필요
     static uint32_t s_frameIndex;
 };
 
@@ -0,0 +1,296 @@
+#include "pch.h"
+#include "FluidBenchmark.h"
+#include "Core/Utils/ThreadPool.h"
+#include "Core/Utils/Timer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <nlohmann/json.hpp>
+using json = nlohmann::ordered_json;
+
+namespace
+{
+	constexpr float kJitter = 0.05f;	// 격자 간격 대비 흔들림
+
+	struct Scene
+	{
+		XMFLOAT3 domain;
+		std::vector<XMFLOAT3> positions;
+	};
+
+	// [-1, 1) 균등. mt19937 원시 출력 상위 24비트만 써서 표준 라이브러리와 무관
+	inline float Jitter(std::mt19937& rng)
+	{
+		return static_cast<float>(rng() >> 8) * (2.0f / 16777216.0f) - 1.0f;
+	}
+
+	// [lo, hi) 상자를 간격 s 격자 (셀 중심) 로 채운다. inside 가 false 인 점은 건너뜀
+	template <typename Inside>
+	void FillBox(Scene& scene, const XMFLOAT3& lo, const XMFLOAT3& hi, float s, std::mt19937& rng, Inside&& inside)
+	{
+		// 반올림 : 마지막 칸 중심은 hi 안쪽 (입자 수가 부피 / s^3 에 가깝게)
+		const int nx = std::max(static_cast<int>(std::lround((hi.x - lo.x) / s)), 1);
+		const int ny = std::max(static_cast<int>(std::lround((hi.y - lo.y) / s)), 1);
+		const int nz = std::max(static_cast<int>(std::lround((hi.z - lo.z) / s)), 1);
+		const float amplitude = kJitter * s;
+		for (int k = 0; k < nz; ++k)
+			for (int j = 0; j < ny; ++j)
+				for (int i = 0; i < nx; ++i) {
+					const XMFLOAT3 p = { lo.x + (i + 0.5f) * s, lo.y + (j + 0.5f) * s, lo.z + (k + 0.5f) * s };
+					// 건너뛰는 점도 같은 난수를 소비해 채운 점의 흔들림이 모양과 무관하게 격자 위치로 정해지게
+					const XMFLOAT3 d = { Jitter(rng) * amplitude, Jitter(rng) * amplitude, Jitter(rng) * amplitude };
+					if (!inside(p)) continue;
+					scene.positions.push_back({ p.x + d.x, p.y + d.y, p.z + d.z });
+				}
+	}
+
+	void FillBox(Scene& scene, const XMFLOAT3& lo, const XMFLOAT3& hi, float s, std::mt19937& rng)
+	{
+		FillBox(scene, lo, hi, s, rng, [](const XMFLOAT3&) { return true; });
+	}
+
+	// 유체 부피 volume 에 맞춘 장면
+	Scene BuildScene(FluidBenchmark::Scenario scenario, float volume, float s, uint32_t seed)
+	{
+		std::mt19937 rng(seed);
+		Scene scene;
+		switch (scenario)
+		{
+		case FluidBenchmark::Scenario::DamBreak:
+		{
+			// 물기둥 a x 2a x a
+			const float a = std::cbrt(0.5f * volume);
+			scene.domain = { 4.0f * a, 2.5f * a, a };
+			FillBox(scene, { 0.0f, 0.0f, 0.0f }, { a, 2.0f * a, a }, s, rng);
+			break;
+		}
+		case FluidBenchmark::Scenario::DropletIntoPool:
+		{
+			// 수조 W x W/4 x W (부피 90%) + 반지름 r 구 (10%)
+			const float w = std::cbrt(4.0f * 0.9f * volume);
+			const float r = std::cbrt(0.1f * volume * 3.0f / (4.0f * 3.14159265358979323846f));
+			scene.domain = { w, w, w };
+			FillBox(scene, { 0.0f, 0.0f, 0.0f }, { w, 0.25f * w, w }, s, rng);
+			const XMFLOAT3 c = { 0.5f * w, 0.7f * w, 0.5f * w };
+			FillBox(scene, { c.x - r, c.y - r, c.z - r }, { c.x + r, c.y + r, c.z + r }, s, rng, [&](const XMFLOAT3& p) {
+				const float dx = p.x - c.x, dy = p.y - c.y, dz = p.z - c.z;
+				return dx * dx + dy * dy + dz * dz < r * r;
+			});
+			break;
+		}
+		case FluidBenchmark::Scenario::RestingTank:
+		default:
+		{
+			// W x W/3 x W, 위로 여유 W/6
+			const float w = std::cbrt(3.0f * volume);
+			scene.domain = { w, 0.5f * w, w };
+			FillBox(scene, { 0.0f, 0.0f, 0.0f }, { w, w / 3.0f, w }, s, rng);
+			break;
+		}
+		}
+		return scene;
+	}
+
+	json ToJson(const FluidParams& p)
+	{
+		return {
+			{ "solver", p.solver == FluidSolver::PCISPH ? "PCISPH" : "EquationOfState" },
+			{ "smoothingLength", p.smoothingLength },
+			{ "mass", p.defaultMass },
+			{ "restDensity", p.density_zero },
+			{ "stiffness", p.stiffness },
+			{ "viscosity", p.viscocityFactor },
+			{ "neighborSkinFactor", p.neighborSkinFactor },
+			{ "maxDensityError", p.maxDensityError },
+			{ "cflNumber", p.cflNumber },
+			{ "forceCflNumber", p.solver == FluidSolver::PCISPH ? p.incompressibleForceCflNumber : p.forceCflNumber },
+			{ "maxSubsteps", p.maxSubsteps },
+			{ "enableSleeping", p.enableSleeping },
+		};
+	}
+
+	json ToJson(const FluidBenchmark::Result& r)
+	{
+		return {
+			{ "scenario", FluidBenchmark::ToString(r.scenario) },
+			{ "requestedParticles", r.requestedParticles },
+			{ "particles", r.particles },
+			{ "domain", { r.domainSize.x, r.domainSize.y, r.domainSize.z } },
+			{ "frames", r.frames },
+			{ "steps", r.steps },
+			{ "simulatedTime", r.simulatedTime },
+			{ "droppedTime", r.droppedTime },
+			{ "wallMs", r.wallMs },
+			{ "maxFrameMs", r.maxFrameMs },
+			{ "stepsPerSecond", r.stepsPerSecond },
+			{ "particleUpdatesPerSecond", r.particleUpdatesPerSecond },
+			{ "activeUpdatesPerSecond", r.activeUpdatesPerSecond },
+			{ "neighbors", {
+				{ "averageList", r.averageListNeighbors },
+				{ "averageActive", r.averageActiveNeighbors },
+				{ "maxActive", r.maxActiveNeighbors } } },
+			{ "peakMemoryBytes", r.peakMemoryBytes },
+			{ "lastStep", {
+				{ "averageDensity", r.lastStep.averageDensity },
+				{ "maxSpeed", r.lastStep.maxSpeed },
+				{ "densityError", r.lastStep.densityError },
+				{ "pressureIterations", r.lastStep.pressureIterations },
+				{ "activeParticles", r.lastStep.activeParticles },
+				{ "timeStep", r.lastStep.timeStep } } },
+		};
+	}
+}
+
+namespace FluidBenchmark
+{
+	const char* ToString(Scenario scenario)
+	{
+		switch (scenario)
+		{
+		case Scenario::DamBreak:		return "DamBreak";
+		case Scenario::DropletIntoPool:	return "DropletIntoPool";
+		case Scenario::RestingTank:		return "RestingTank";
+		default:						return "Unknown";
+		}
+	}
+
+	Result RunScenario(Scenario scenario, uint32_t particleCount, const Desc& desc)
+	{
+		const FluidParams& params = desc.params;
+		const float spacing = std::cbrt(params.defaultMass / params.density_zero);
+		const Scene scene = BuildScene(scenario, particleCount * spacing * spacing * spacing, spacing, desc.seed);
+
+		Result result;
+		result.scenario = scenario;
+		result.requestedParticles = particleCount;
+		result.particles = static_cast<uint32_t>(scene.positions.size());
+		result.domainSize = scene.domain;
+
+		FluidSystem fluid({ 0.0f, 0.0f, 0.0f }, scene.domain, params);
+		for (const XMFLOAT3& p : scene.positions) fluid.AddParticle(p);
+
+		double listNeighbors = 0.0, activeNeighbors = 0.0, activeUpdates = 0.0;
+		for (uint32_t f = 0; f < desc.frames; ++f)
+		{
+			FluidFrameStats frame;
+			const double ms = Timer::MeasureMs([&] { frame = fluid.Advance(desc.frameTime); });
+			result.wallMs += ms;
+			result.maxFrameMs = std::max(result.maxFrameMs, ms);
+			result.steps += frame.substeps;
+			result.simulatedTime += frame.simulatedTime;
+			result.droppedTime += frame.droppedTime;
+			activeUpdates += static_cast<double>(fluid.GetStepStats().activeParticles) * frame.substeps;
+
+			const FluidNeighborStats neighbors = fluid.GetNeighborStats();
+			if (result.particles > 0)
+			{
+				listNeighbors += static_cast<double>(neighbors.listEntries) / result.particles;
+				activeNeighbors += static_cast<double>(neighbors.activeEntries) / result.particles;
+			}
+			result.maxActiveNeighbors = std::max(result.maxActiveNeighbors, neighbors.maxActive);
+			result.peakMemoryBytes = std::max(result.peakMemoryBytes, fluid.GetMemoryBytes());
+		}
+
+		result.frames = desc.frames;
+		result.lastStep = fluid.GetStepStats();
+		if (desc.frames > 0)
+		{
+			result.averageListNeighbors = listNeighbors / desc.frames;
+			result.averageActiveNeighbors = activeNeighbors / desc.frames;
+		}
+		if (result.wallMs > 0.0)
+		{
+			const double seconds = result.wallMs / 1000.0;
+			result.stepsPerSecond = result.steps / seconds;
+			result.particleUpdatesPerSecond = static_cast<double>(result.steps) * result.particles / seconds;
+			result.activeUpdatesPerSecond = activeUpdates / seconds;
+		}
+		return result;
+	}
+
+	std::vector<Result> Run(const Desc& desc)
+	{
+		std::vector<Result> results;
+		for (Scenario scenario : desc.scenarios)
+		{
+			for (uint32_t count : desc.particleCounts)
+			{
+				results.push_back(RunScenario(scenario, count, desc));
+				const Result& r = results.back();
+				Log::Print("FluidBench", "%s %u particles : %.1f steps/s, %.3g particle updates/s, %.1f neighbors, %.1f MB",
+					ToString(scenario), r.particles, r.stepsPerSecond, r.particleUpdatesPerSecond,
+					r.averageActiveNeighbors, r.peakMemoryBytes / (1024.0 * 1024.0));
+			}
+		}
+		return results;
+	}
+
+	bool WriteJson(const std::wstring& path, const Desc& desc, const std::vector<Result>& results)
+	{
+		json root = {
+			{ "seed", desc.seed },
+			{ "frameTime", desc.frameTime },
+			{ "frames", desc.frames },
+			{ "threads", ThreadPool::Get().GetThreadCount() },
+#if defined(__AVX2__)
+			{ "avx2", true },
+#else
+			{ "avx2", false },
+#endif
+			{ "params", ToJson(desc.params) },
+		};
+		json& runs = root["results"] = json::array();
+		for (const Result& r : results) runs.push_back(ToJson(r));
+
+		FILE* fp = nullptr;
+		if (_wfopen_s(&fp, path.c_str(), L"wb") != 0 || fp == nullptr)
+		{
+			Log::Print("FluidBench", "Cannot open: %s", UTF16ToUTF8(path.c_str()).c_str());
+			return false;
+		}
+		const std::string text = root.dump(2);
+		const bool ok = std::fwrite(text.data(), 1, text.size(), fp) == text.size();
+		fclose(fp);
+		return ok;
+	}
+
+	bool RunFromCommandLine(int& outExitCode)
+	{
+		int argc = 0;
+		LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+		if (!argv) return false;
+
+		bool enabled = false;
+		std::wstring path = L"FluidBench.json";
+		Desc desc;
+		for (int i = 1; i < argc; ++i)
+		{
+			const bool hasValue = i + 1 < argc && argv[i + 1][0] != L'-';
+			if (_wcsicmp(argv[i], L"-fluidbench") == 0)
+			{
+				enabled = true;
+				if (hasValue) path = argv[++i];
+			}
+			else if (_wcsicmp(argv[i], L"-fluidbench-seed") == 0 && hasValue)
+			{
+				desc.seed = static_cast<uint32_t>(wcstoul(argv[++i], nullptr, 10));
+			}
+			else if (_wcsicmp(argv[i], L"-fluidbench-frames") == 0 && hasValue)
+			{
+				desc.frames = static_cast<uint32_t>(wcstoul(argv[++i], nullptr, 10));
+			}
+			else if (_wcsicmp(argv[i], L"-fluidbench-sleep") == 0)
+			{
+				desc.params.enableSleeping = true;
+			}
+		}
+		//CommandLineToArgvW를 통해 얻은 argv 객체는 LocalFree로 해제해야함.
+		LocalFree(argv);
+		if (!enabled) return false;
+
+		const std::vector<Result> results = Run(desc);
+		outExitCode = WriteJson(path, desc, results) ? 0 : 1;
+		return true;
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include "Core/Geometry/FluidSystem.h"
+#include <string>
+#include <vector>
+
+/*
+* FluidSystem 처리량 벤치마크 (렌더링/창 없이 CPU 시뮬레이션만)
+* - 시나리오 x 입자 수 조합마다 새 FluidSystem 을 만들어 frames 번 Advance(frameTime)
+*   도메인은 요청 입자 수의 유체 부피 (입자 수 * (mass / rho_0)) 에 맞춰 키우므로 입자 수만 바꿔 같은 장면을 비교
+*   입자 수는 격자 칸 수를 반올림해 맞추므로 요청값과 조금 다르다 (Result::particles)
+*   DamBreak        : 4a x 2.5a x a 탱크의 한쪽 끝 a x 2a x a 물기둥이 무너짐
+*   DropletIntoPool : 정사각 바닥 수조 (깊이 W / 4) 에 부피 10% 물방울을 높이 0.7W 에서 떨어뜨림
+*   RestingTank     : 넓은 수조 (깊이 W / 3) 가 가만히 있음 (잠자기 / 정지 상태 비용)
+* - 입자는 간격 (mass / rho_0)^(1/3) 격자에 간격 5% 의 흔들림. 흔들림은 seed 로 시작한 mt19937 의 원시 출력만 쓰므로
+*   (표준 분포 클래스는 표준 라이브러리마다 다름) 같은 seed 면 빌드/컴파일러와 무관하게 같은 초기 상태.
+*   Step 통계도 스레드 수와 무관하게 결정적이라 시간 외 값 (substep 수, 밀도 등) 은 실행마다 같다
+* - 측정 : Advance 벽시계 시간, steps/s, 입자 갱신/s (입자 수 * Step 수 / 초), 입자별 평균/최대 이웃 수 (Verlet 목록, r < h),
+*   FluidSystem::GetMemoryBytes 최대값. WriteJson 으로 추적용 JSON 저장
+* - 실행 : MarchingCubes.exe -fluidbench [out.json] [-fluidbench-seed N] [-fluidbench-frames N] [-fluidbench-sleep]
+*   (창을 만들지 않고 종료)
+*/
+namespace FluidBenchmark
+{
+	enum class Scenario : uint8_t
+	{
+		DamBreak,
+		DropletIntoPool,
+		RestingTank,
+	};
+
+	// PCISPH + 수조가 가라앉는 점성 (기본 점성 0.1 은 정지 수조도 벽에서 계속 튄다)
+	inline FluidParams DefaultParams()
+	{
+		FluidParams params;
+		params.solver = FluidSolver::PCISPH;
+		params.viscocityFactor = 3.5f;
+		return params;
+	}
+
+	struct Desc
+	{
+		std::vector<Scenario> scenarios = { Scenario::DamBreak, Scenario::DropletIntoPool, Scenario::RestingTank };
+		std::vector<uint32_t> particleCounts = { 4096, 16384, 65536 };
+		FluidParams params = DefaultParams();	// 시나리오 공통 (solver, 잠자기 등)
+		float frameTime = 1.0f / 60.0f;
+		uint32_t frames = 120;
+		uint32_t seed = 1;
+	};
+
+	struct Result
+	{
+		Scenario scenario = Scenario::DamBreak;
+		uint32_t requestedParticles = 0;
+		uint32_t particles = 0;			// 격자로 채운 실제 입자 수
+		XMFLOAT3 domainSize = { 0.0f, 0.0f, 0.0f };
+
+		uint32_t frames = 0;
+		uint64_t steps = 0;
+		float simulatedTime = 0.0f;
+		float droppedTime = 0.0f;		// maxSubsteps 로 버린 시간 합
+		double wallMs = 0.0;			// Advance 합
+		double maxFrameMs = 0.0;
+		double stepsPerSecond = 0.0;
+		double particleUpdatesPerSecond = 0.0;
+		double activeUpdatesPerSecond = 0.0;	// 잠든 입자 제외 (프레임 마지막 Step 의 깨어 있는 입자 수 기준)
+
+		double averageListNeighbors = 0.0;		// 입자별 Verlet 목록 길이 (프레임 평균)
+		double averageActiveNeighbors = 0.0;	// 입자별 r < h 이웃 수 (프레임 평균)
+		uint32_t maxActiveNeighbors = 0;
+		size_t peakMemoryBytes = 0;
+
+		FluidStepStats lastStep;		// 마지막 Step 상태 (밀도, 속력 등 재현성 확인용)
+	};
+
+	const char* ToString(Scenario scenario);
+
+	Result RunScenario(Scenario scenario, uint32_t particleCount, const Desc& desc);
+	std::vector<Result> Run(const Desc& desc);
+	bool WriteJson(const std::wstring& path, const Desc& desc, const std::vector<Result>& results);
+
+	// 명령줄에 -fluidbench 가 있으면 벤치마크를 돌리고 true (outExitCode : JSON 저장 실패 시 1)
+	bool RunFromCommandLine(int& outExitCode);
+}
@@ -1,41 +1,290 @@
 #include "pch.h"
 #include "FluidSystem.h"
+#include "Core/Geometry/MarchingCubes/SdfRaycast.h"
+#include "Core/Utils/ThreadPool.h"
+#include "Core/Utils/Timer.h"
+#include <bit>
+#include <climits>
 #include <cmath>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	// ThreadPool 분배 단위 겸 결정적 리덕션 블록 크기 (입자 수)
+	constexpr size_t kParticleGrain = 256;
+	constexpr size_t kBoundaryCellGrain = 64;
+	// 잠자기 : 입자별 기록 셀 인덱스의 최상위 비트 = 주변 26 셀까지 깨움
+	constexpr uint32_t kWakeNeighbors = 0x80000000u;
+
+	template <typename T>
+	size_t CapacityBytes(const std::vector<T>& v) { return v.capacity() * sizeof(T); }
+
+	size_t CapacityBytes(const FluidParticleArrays& a)
+	{
+		size_t bytes = 0;
+		for (const std::vector<float>* v : { &a.x, &a.y, &a.z, &a.vx, &a.vy, &a.vz, &a.fx, &a.fy, &a.fz, &a.mass, &a.density, &a.pressure })
+			bytes += CapacityBytes(*v);
+		return bytes;
+	}
+
+#if defined(__AVX2__)
+	inline float HorizontalSum(__m256 v)
+	{
+		__m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+		s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+		s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+		return _mm_cvtss_f32(s);
+	}
+
+	// 이웃 8개 묶음용 커널 (FluidSystem::Kernel_* 의 8레인 판). r2 >= h2 인 레인은 0
+	struct SphKernels8
+	{
+		__m256 h, h2, poly6, spiky, viscLaplacian;
+
+		__m256 Poly6(__m256 r2) const
+		{
+			const __m256 t = _mm256_max_ps(_mm256_sub_ps(h2, r2), _mm256_setzero_ps());
+			return _mm256_mul_ps(poly6, _mm256_mul_ps(t, _mm256_mul_ps(t, t)));
+		}
+		// 기울기 = rij * SpikyGrad(r) (r <= 1e-7 또는 r >= h 인 레인은 0)
+		__m256 SpikyGrad(__m256 r) const
+		{
+			const __m256 hr = _mm256_sub_ps(h, r);
+			const __m256 valid = _mm256_and_ps(_mm256_cmp_ps(r, _mm256_set1_ps(1e-7f), _CMP_GT_OQ), _mm256_cmp_ps(r, h, _CMP_LT_OQ));
+			const __m256 coef = _mm256_div_ps(_mm256_mul_ps(spiky, _mm256_mul_ps(hr, hr)), r);
+			return _mm256_and_ps(valid, _mm256_sub_ps(_mm256_setzero_ps(), coef));
+		}
+		__m256 ViscLaplacian(__m256 r) const
+		{
+			return _mm256_and_ps(_mm256_cmp_ps(r, h, _CMP_LT_OQ), _mm256_mul_ps(viscLaplacian, _mm256_sub_ps(h, r)));
+		}
+	};
+
+	// [k, k + 8) 중 end 보다 앞인 레인만 켠 마스크
+	inline __m256i LaneMask(size_t k, size_t end)
+	{
+		const __m256i laneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+		return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(std::min<size_t>(end - k, 8))), laneIndex);
+	}
+
+	// 셀 정렬된 연속 구간 [k, k + 8) 을 그대로 로드 (end 를 넘는 레인은 0)
+	inline __m256 LoadRange(const float* base, size_t k, __m256i laneMask)
+	{
+		return _mm256_maskload_ps(base + k, laneMask);
+	}
+
+	// 이웃 목록 [k, k + 8) 을 레인으로 : count 를 넘는 레인은 mask = 0, 인덱스 0
+	inline __m256i LoadNeighborIndices(const int* neighbors, size_t k, size_t count, __m256& outMask)
+	{
+		const __m256i laneMask = LaneMask(k, count);
+		outMask = _mm256_castsi256_ps(laneMask);
+		return _mm256_maskload_epi32(neighbors + k, laneMask);
+	}
+
+	inline __m256 Gather(const float* base, __m256i index, __m256 mask, __m256 fallback)
+	{
+		return _mm256_mask_i32gather_ps(fallback, base, index, mask, 4);
+	}
+
+	// movemask -> 켜진 레인을 앞으로 모으는 permute 인덱스 (레인당 1바이트)
+	struct CompactTable
+	{
+		uint64_t lanes[256];
+
+		constexpr CompactTable() : lanes{}
+		{
+			for (int bits = 0; bits < 256; ++bits) {
+				int count = 0;
+				for (int lane = 0; lane < 8; ++lane)
+					if (bits & (1 << lane)) lanes[bits] |= uint64_t(lane) << (8 * count++);
+			}
+		}
+	};
+	constexpr CompactTable kCompactTable;
+
+	// values 중 bits 레인만 out 앞쪽에 연속으로 쓴다 (분기 없이, 쓴 개수만큼만 마스크 저장). 반환 : 쓴 개수
+	inline int CompactStore(int* out, __m256i values, int bits)
+	{
+		const int count = std::popcount(static_cast<unsigned>(bits));
+		const __m256i permute = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(kCompactTable.lanes[bits])));
+		_mm256_maskstore_epi32(out, LaneMask(0, count), _mm256_permutevar8x32_epi32(values, permute));
+		return count;
+	}
+#endif
+}
+
+void FluidParticleArrays::resize(size_t n)
+{
+	for (std::vector<float>* a : { &x, &y, &z, &vx, &vy, &vz, &fx, &fy, &fz, &mass, &density, &pressure })
+		a->resize(n, 0.0f);
+}
+
 FluidSystem::FluidSystem(const XMFLOAT3& min, const XMFLOAT3& max, const FluidParams& params) :
 	m_domainMin(min),
 	m_domainMax(max),
 	m_params(params)
 {
 	SetSmoothingLength(m_params.smoothingLength);
-	BuildGrid();
 }
 
 void FluidSystem::AddParticle(const XMFLOAT3& pos, const XMVECTOR& vel, float mass)
 {
-	Particle p;
-	p.pos = pos;
-	p.vel = vel;
-	p.mass = (mass > 0.0f) ? mass : m_params.defaultMass;
-	m_particles.push_back(p);
+	SyncFromParticleView();
+	m_neighborListsDirty = true;
+	m_wakeAll = true;
+
+	XMFLOAT3 v;
+	XMStoreFloat3(&v, vel);
+	m_store.x.push_back(pos.x);
+	m_store.y.push_back(pos.y);
+	m_store.z.push_back(pos.z);
+	m_store.vx.push_back(v.x);
+	m_store.vy.push_back(v.y);
+	m_store.vz.push_back(v.z);
+	m_store.fx.push_back(0.0f);
+	m_store.fy.push_back(0.0f);
+	m_store.fz.push_back(0.0f);
+	m_store.mass.push_back((mass > 0.0f) ? mass : m_params.defaultMass);
+	m_store.density.push_back(0.0f);
+	m_store.pressure.push_back(0.0f);
+}
+
+std::vector<Particle>& FluidSystem::GetParticles()
+{
+	CopyToParticleView();
+	m_particleViewOut = true;
+	return m_particles;
+}
+
+const std::vector<Particle>& FluidSystem::GetParticlesReadOnly()
+{
+	CopyToParticleView();
+	return m_particles;
+}
+
+void FluidSystem::CopyToParticleView()
+{
+	// 새로 추가된 입자는 기본 color/normal, 기존 입자는 AoS 쪽 값을 유지
+	SyncFromParticleView();
+	const size_t count = m_store.size();
+	m_particles.resize(count);
+	for (size_t i = 0; i < count; ++i) {
+		Particle& p = m_particles[i];
+		p.pos = { m_store.x[i], m_store.y[i], m_store.z[i] };
+		p.vel = XMVectorSet(m_store.vx[i], m_store.vy[i], m_store.vz[i], 0.0f);
+		p.force = XMVectorSet(m_store.fx[i], m_store.fy[i], m_store.fz[i], 0.0f);
+		p.mass = m_store.mass[i];
+		p.density = m_store.density[i];
+		p.pressure = m_store.pressure[i];
+	}
+}
+
+void FluidSystem::SyncFromParticleView()
+{
+	// GetParticles() 로 내준 배열에서 사용자가 바꿀 수 있는 상태 (pos, vel, mass) 만 되돌린다
+	if (!m_particleViewOut) return;
+	m_particleViewOut = false;
+
+	// 실제로 바뀐 값이 있을 때만 : 위치 -> 다음 Step에서 이웃 목록 재구성, pos/vel/mass -> 잠든 셀도 깨운다
+	bool posChanged = false;
+	bool stateChanged = false;
+	const size_t count = std::min(m_particles.size(), m_store.size());
+	for (size_t i = 0; i < count; ++i) {
+		const Particle& p = m_particles[i];
+		XMFLOAT3 v;
+		XMStoreFloat3(&v, p.vel);
+		const bool pos = p.pos.x != m_store.x[i] || p.pos.y != m_store.y[i] || p.pos.z != m_store.z[i];
+		const bool vel = v.x != m_store.vx[i] || v.y != m_store.vy[i] || v.z != m_store.vz[i];
+		const bool mass = p.mass != m_store.mass[i];
+		if (!(pos || vel || mass)) continue;
+
+		posChanged |= pos;
+		stateChanged = true;
+		m_store.x[i] = p.pos.x;
+		m_store.y[i] = p.pos.y;
+		m_store.z[i] = p.pos.z;
+		m_store.vx[i] = v.x;
+		m_store.vy[i] = v.y;
+		m_store.vz[i] = v.z;
+		m_store.mass[i] = p.mass;
+	}
+	if (posChanged) m_neighborListsDirty = true;
+	if (stateChanged) m_wakeAll = true;
 }
 
 void FluidSystem::Step(float dt)
 {
 	if (dt <= 0.0f) return;
-	if (dt > m_params.timeStepLimit) dt = m_params.timeStepLimit;
+	const bool pcisph = m_params.solver == FluidSolver::PCISPH;
+	dt = std::min(dt, pcisph ? m_params.incompressibleTimeStepLimit : m_params.timeStepLimit);
+	SyncFromParticleView();
 
-	BuildGrid();
-	ClearGridBuckets();
-	InsertParticlesToGrid();
+	UpdateNeighborLists();
+	UpdateParticleActivity(); // 정렬 뒤 (입자 순서가 바뀔 수 있음)
 
 	ComputePressure();
 	ComputeForces();
+	m_stepStats.pressureIterations = 0;
+	m_stepStats.densityError = 0.0f;
+	if (pcisph) SolvePressurePCISPH(dt);
 	Integrate(dt);
 
 	ApplyBoundaryConditions();
+	ReduceStepStats();
+	UpdateSleepState();
+	m_stepStats.timeStep = dt;
 
-	// RasterizeToGrid()
+	// 표면 : 유체 표면 전용 TerrainSystem (InitInfo::particleSurface) 의 rasterizeParticles 로 GetParticleArrays() 를 래스터화
+}
+
+float FluidSystem::ComputeStableTimeStep() const
+{
+	const bool pcisph = m_params.solver == FluidSolver::PCISPH;
+	float dt = pcisph ? m_params.incompressibleTimeStepLimit : m_params.timeStepLimit;
+	// 압축성 상태 방정식은 압력파가 음속 sqrt(dp/drho) 로 퍼지므로 속력에 더한다
+	const float soundSpeed = pcisph ? 0.0f : std::sqrtf(std::max(m_params.stiffness, 0.0f));
+	const float speed = m_stepStats.maxSpeed + soundSpeed;
+	if (speed > 0.0f) dt = std::min(dt, m_params.cflNumber * m_h / speed);
+	const float forceCfl = pcisph ? m_params.incompressibleForceCflNumber : m_params.forceCflNumber;
+	if (m_stepStats.maxAcceleration > 0.0f) dt = std::min(dt, forceCfl * std::sqrtf(m_h / m_stepStats.maxAcceleration));
+	return std::max(dt, m_params.minTimeStep);
+}
+
+const FluidFrameStats& FluidSystem::Advance(float frameTime)
+{
+	m_frameStats = FluidFrameStats{};
+	if (frameTime <= 0.0f) return m_frameStats;
+
+	const int maxSubsteps = std::max(m_params.maxSubsteps, 1);
+	const double budgetMs = m_params.frameBudgetMs;
+	float remaining = frameTime;
+	// 부동소수 누적 오차로 남는 아주 작은 시간은 무시
+	while (remaining > 1e-6f * frameTime && m_frameStats.substeps < static_cast<uint32_t>(maxSubsteps)) {
+		if (budgetMs > 0.0 && m_frameStats.substeps > 0 && m_frameStats.computeMs + m_stepCostMs > budgetMs) {
+			m_frameStats.budgetLimited = true;
+			break;
+		}
+
+		// 남은 시간을 CFL dt 이하의 같은 크기로 나눠 마지막 substep 이 아주 작아지지 않게
+		float dt = ComputeStableTimeStep();
+		if (dt < remaining) dt = remaining / std::ceil(remaining / dt);
+		else dt = remaining;
+
+		const double ms = Timer::MeasureMs([&] { Step(dt); });
+		m_stepCostMs = m_stepCostMs > 0.0 ? 0.8 * m_stepCostMs + 0.2 * ms : ms;
+
+		dt = m_stepStats.timeStep; // Step 이 solver 상한으로 줄였을 수 있다
+		remaining -= dt;
+		m_frameStats.simulatedTime += dt;
+		m_frameStats.lastTimeStep = dt;
+		m_frameStats.computeMs += ms;
+		++m_frameStats.substeps;
+	}
+	m_frameStats.droppedTime = std::max(remaining, 0.0f);
+	return m_frameStats;
 }
 
 void FluidSystem::SetSmoothingLength(float h)
@@ -47,222 +296,1019 @@ void FluidSystem::SetSmoothingLength(float h)
 	m_poly6Coeff = 315.0f / (64.0f * pi * std::powf(h, 9));
 	m_spikyCoeff = 15.0f / (pi * std::powf(h, 6));
 	m_viscoLaplacianCoeff = 45.0f / (pi * std::powf(h, 6));
-	m_cellSize = h;
+	ComputePCISPHDelta();
+	BuildGrid();
 }
 
 void FluidSystem::ClearParticles()
 {
+	m_store.clear();
 	m_particles.clear();
+	m_particleViewOut = false;
+	m_neighborListsDirty = true;
+	m_wakeAll = true;
+}
+
+void FluidSystem::SetBoundaryVolume(const SdfCollision::Volume* volume)
+{
+	m_hasBoundaryVolume = volume && SdfCollision::IsValid(*volume);
+	if (m_hasBoundaryVolume) m_boundaryVolume = *volume;
+	InvalidateBoundaryCache();
+}
+
+void FluidSystem::InvalidateBoundaryCache(const XMINT3& sampleMin, const XMINT3& sampleMax)
+{
+	if (!m_boundaryCacheDirty) {
+		m_boundaryDirtyMin = sampleMin;
+		m_boundaryDirtyMax = sampleMax;
+	}
+	else {
+		m_boundaryDirtyMin = { std::min(m_boundaryDirtyMin.x, sampleMin.x), std::min(m_boundaryDirtyMin.y, sampleMin.y), std::min(m_boundaryDirtyMin.z, sampleMin.z) };
+		m_boundaryDirtyMax = { std::max(m_boundaryDirtyMax.x, sampleMax.x), std::max(m_boundaryDirtyMax.y, sampleMax.y), std::max(m_boundaryDirtyMax.z, sampleMax.z) };
+	}
+	m_boundaryCacheDirty = true;
+}
+
+void FluidSystem::InvalidateBoundaryCache()
+{
+	InvalidateBoundaryCache({ INT_MIN, INT_MIN, INT_MIN }, { INT_MAX, INT_MAX, INT_MAX });
+	m_boundaryCellNear.clear(); // 셀 수/반경이 바뀌었을 수 있으므로 전부 다시
 }
 
 void FluidSystem::BuildGrid()
 {
-	m_cellSize = m_params.smoothingLength; // cell size = h
+	// 격자 크기는 h, skin, 도메인으로만 정해지므로 h 가 바뀔 때만 다시 만든다
+	m_skin = std::max(m_params.neighborSkinFactor, 0.0f) * m_params.smoothingLength;
+	m_cellSize = m_params.smoothingLength + m_skin; // cell size = 이웃 목록 반경 (h + skin)
 	for (int i = 0; i < 3; ++i) {
 		float span = (i == 0 ? m_domainMax.x - m_domainMin.x : (i == 1 ? m_domainMax.y - m_domainMin.y : m_domainMax.z - m_domainMin.z));
 		int n = std::max(1, int(std::ceil(span / m_cellSize)));
 		m_gridDim[i] = n;
 	}
 	m_numCells = size_t(m_gridDim[0]) * size_t(m_gridDim[1]) * size_t(m_gridDim[2]);
-	m_buckets.clear();
-	m_buckets.resize(m_numCells);
+	// 마지막 슬롯 (m_numCells) 은 도메인 밖 입자, +1 은 끝 경계
+	m_cellStart.assign(m_numCells + 2, 0);
+	m_neighborListsDirty = true;
+	m_wakeAll = true;
+	InvalidateBoundaryCache();
 }
 
-void FluidSystem::ClearGridBuckets()
+void FluidSystem::SortParticlesByCell()
 {
-	for (auto& b : m_buckets) 
-		b.clear();
+	const size_t count = m_store.size();
+	const uint32_t outside = static_cast<uint32_t>(m_numCells);
+
+	// 1. 입자별 셀 (병렬)
+	m_particleCell.resize(count);
+	ThreadPool::Get().ParallelFor(0, count, kParticleGrain, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			int ix, iy, iz;
+			PositionToCell(m_store.x[i], m_store.y[i], m_store.z[i], ix, iy, iz);
+			const int cell = CellIndexFromCoord(ix, iy, iz);
+			// 도메인 밖 입자는 마지막 슬롯 : 다음 경계 처리에서 안으로 들어온다
+			m_particleCell[i] = cell >= 0 ? static_cast<uint32_t>(cell) : outside;
+		}
+	});
+
+	// 2. 카운팅 정렬 (안정 정렬 : 셀 안 순서는 이전 순서 유지 -> 합산 순서가 스레드 수와 무관)
+	std::fill(m_cellStart.begin(), m_cellStart.end(), 0u);
+	for (size_t i = 0; i < count; ++i) ++m_cellStart[m_particleCell[i] + 1];
+	for (size_t c = 1; c < m_cellStart.size(); ++c) m_cellStart[c] += m_cellStart[c - 1];
+
+	m_sortOrder.resize(count);
+	m_sortCursor.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+	for (size_t i = 0; i < count; ++i) m_sortOrder[m_sortCursor[m_particleCell[i]]++] = static_cast<uint32_t>(i);
+
+	// 3. 셀 순서로 재배치 (병렬 gather 후 swap, scratch 용량은 Step 간 재사용)
+	m_sortScratch.resize(count);
+	const bool permuteView = m_particles.size() == count;
+	if (permuteView) m_particleScratch.resize(count);
+
+	std::vector<float> FluidParticleArrays::* const fields[] = {
+		&FluidParticleArrays::x, &FluidParticleArrays::y, &FluidParticleArrays::z,
+		&FluidParticleArrays::vx, &FluidParticleArrays::vy, &FluidParticleArrays::vz,
+		&FluidParticleArrays::fx, &FluidParticleArrays::fy, &FluidParticleArrays::fz,
+		&FluidParticleArrays::mass, &FluidParticleArrays::density, &FluidParticleArrays::pressure
+	};
+	ThreadPool::Get().ParallelFor(0, count, kParticleGrain, [&](size_t begin, size_t end) {
+		for (auto field : fields) {
+			const float* src = (m_store.*field).data();
+			float* dst = (m_sortScratch.*field).data();
+			for (size_t k = begin; k < end; ++k) dst[k] = src[m_sortOrder[k]];
+		}
+		// GetParticles() 어댑터의 color/normal 도 같은 순서로
+		if (permuteView)
+			for (size_t k = begin; k < end; ++k) m_particleScratch[k] = m_particles[m_sortOrder[k]];
+	});
+	std::swap(m_store, m_sortScratch);
+	if (permuteView) std::swap(m_particles, m_particleScratch);
 }
 
-void FluidSystem::InsertParticlesToGrid()
+void FluidSystem::UpdateNeighborLists()
 {
-	for (size_t i = 0; i < m_particles.size(); ++i) {
-		int ix, iy, iz;
-		PositionToCell(m_particles[i].pos, ix, iy, iz);
-		int idx = CellIndexFromCoord(ix, iy, iz);
-		if (idx >= 0) m_buckets[idx].push_back(int(i));
-		// else particle out of domain -> we'll clamp in boundary step
-	}
+	// Verlet 목록 : 반경 h + skin 으로 만든 목록은 모든 입자가 skin / 2 미만으로 움직이는 동안 r < h 이웃을 모두 포함
+	const float halfSkin = 0.5f * m_skin;
+	const bool rebuild = m_neighborListsDirty || m_skin <= 0.0f || m_maxDisplacement2 >= halfSkin * halfSkin;
+	m_stepStats.neighborListsRebuilt = rebuild;
+	if (!rebuild) return;
+
+	SortParticlesByCell();
+	BuildNeighborLists();
+
+	// 재구성 시점 위치 (이후 이동량 기준)
+	m_listX = m_store.x;
+	m_listY = m_store.y;
+	m_listZ = m_store.z;
+	m_maxDisplacement2 = 0.0f;
+	m_neighborListsDirty = false;
 }
 
-void FluidSystem::ComputePressure()
+int FluidSystem::CollectNeighbors(int pi, float radius2, std::vector<int>& buffer, size_t offset) const
 {
-	// 3.1.Pressure 
-	std::vector<int> neighbors;
-	for (size_t i = 0; i < m_particles.size(); ++i) 
+	// 셀 구간에서 r^2 < radius2 인 이웃 (자기 자신 제외) 을 buffer[offset..] 에 쓴다. buffer 는 후보 수만큼만 늘리고 줄이지 않음
+	const FluidParticleArrays& P = m_store;
+	NeighborRange ranges[9];
+	const int rangeCount = GetNeighborRanges(pi, ranges);
+	size_t candidates = 0;
+	for (int r = 0; r < rangeCount; ++r) candidates += ranges[r].end - ranges[r].begin;
+	if (buffer.size() < offset + candidates) buffer.resize(offset + candidates);
+	int* outNeighbors = buffer.data() + offset;
+	int count = 0;
+
+#if defined(__AVX2__)
+	const __m256i self = _mm256_set1_epi32(pi);
+	const __m256i laneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	const __m256 xi = _mm256_set1_ps(P.x[pi]), yi = _mm256_set1_ps(P.y[pi]), zi = _mm256_set1_ps(P.z[pi]);
+	const __m256 limit = _mm256_set1_ps(radius2);
+	for (int r = 0; r < rangeCount; ++r)
 	{
-		Particle& pi = m_particles[i];
-		XMVECTOR i_pos = XMLoadFloat3(&pi.pos);
-		float density = 0.0f;
-		GetNeighbors(int(i), neighbors);
-		for (int j : neighbors) 
+		for (size_t k = ranges[r].begin; k < ranges[r].end; k += 8)
 		{
-			const Particle& pj = m_particles[j];
-
-			//  (3)
-			XMVECTOR j_pos = XMLoadFloat3(&pj.pos);
-			XMVECTOR rij = i_pos - j_pos;
-			XMVECTOR r_pow = XMVector3Dot(rij, rij);
+			const __m256i mask = LaneMask(k, ranges[r].end);
+			const __m256 dx = _mm256_sub_ps(xi, LoadRange(P.x.data(), k, mask));
+			const __m256 dy = _mm256_sub_ps(yi, LoadRange(P.y.data(), k, mask));
+			const __m256 dz = _mm256_sub_ps(zi, LoadRange(P.z.data(), k, mask));
+			const __m256 r2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
 
-			// е  Poly6 Ŀ  <  (20)>
-			density += pj.mass * Kernel_Poly6(XMVectorGetX(r_pow));
+			// 유효 레인 : 구간 안, 자기 자신 아님, r < radius
+			const __m256i j = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(k)), laneIndex);
+			__m256 valid = _mm256_castsi256_ps(_mm256_andnot_si256(_mm256_cmpeq_epi32(j, self), mask));
+			valid = _mm256_and_ps(valid, _mm256_cmp_ps(r2, limit, _CMP_LT_OQ));
+			count += CompactStore(outNeighbors + count, j, _mm256_movemask_ps(valid));
 		}
-		// avoid zero density
-		pi.density = std::max(density, 1e-6f);
-		//  (12)
-		pi.pressure = m_params.stiffness * (pi.density - m_params.density_zero);
 	}
+#else
+	for (int r = 0; r < rangeCount; ++r)
+	{
+		for (int j = int(ranges[r].begin); j < int(ranges[r].end); ++j)
+		{
+			if (j == pi) continue;
+			const float dx = P.x[pi] - P.x[j], dy = P.y[pi] - P.y[j], dz = P.z[pi] - P.z[j];
+			if (dx * dx + dy * dy + dz * dz >= radius2) continue;
+			outNeighbors[count++] = j;
+		}
+	}
+#endif
+	return count;
+}
+
+void FluidSystem::BuildNeighborLists()
+{
+	// CSR : 입자 i 이웃 = m_neighborIndices[m_neighborOffsets[i] .. m_neighborOffsets[i + 1])
+	// 입자 블록별로 한 번만 탐색해 블록 버퍼에 모은 뒤, 개수 prefix sum 위치로 이어 붙인다 (버퍼 용량은 재구성 간 재사용)
+	const size_t count = m_store.size();
+	const size_t blockCount = (count + kParticleGrain - 1) / kParticleGrain;
+	const float radius = m_h + m_skin;
+	const float radius2 = radius * radius;
+
+	if (m_blockNeighbors.size() < blockCount) m_blockNeighbors.resize(blockCount);
+	m_neighborOffsets.resize(count + 1);
+	m_neighborOffsets[0] = 0;
+	ThreadPool::Get().ParallelFor(0, blockCount, 1, [&](size_t blockBegin, size_t blockEnd) {
+		for (size_t block = blockBegin; block < blockEnd; ++block) {
+			std::vector<int>& buffer = m_blockNeighbors[block];
+			size_t used = 0;
+			const size_t end = std::min(count, (block + 1) * kParticleGrain);
+			for (size_t i = block * kParticleGrain; i < end; ++i) {
+				const int n = CollectNeighbors(int(i), radius2, buffer, used);
+				m_neighborOffsets[i + 1] = static_cast<uint32_t>(n);
+				used += n;
+			}
+		}
+	});
+	for (size_t i = 0; i < count; ++i) m_neighborOffsets[i + 1] += m_neighborOffsets[i];
+
+	m_neighborIndices.resize(m_neighborOffsets[count]);
+	ThreadPool::Get().ParallelFor(0, blockCount, 1, [&](size_t blockBegin, size_t blockEnd) {
+		for (size_t block = blockBegin; block < blockEnd; ++block) {
+			const uint32_t first = m_neighborOffsets[block * kParticleGrain];
+			const uint32_t last = m_neighborOffsets[std::min(count, (block + 1) * kParticleGrain)];
+			std::copy_n(m_blockNeighbors[block].data(), last - first, m_neighborIndices.data() + first);
+		}
+	});
+}
+
+void FluidSystem::ComputePressure()
+{
+	//논문 3.1.Pressure 참고
+	FluidParticleArrays& P = m_store;
+	const float selfKernel = Kernel_Poly6(0.0f);	// 목록에 자기 자신은 없으므로 따로 더한다
+	const bool equationOfState = m_params.solver == FluidSolver::EquationOfState;
+	// 이번 Step r < h 이웃 : Verlet 목록과 같은 오프셋에 앞쪽부터 압축해 두고 힘 계산에서 그대로 쓴다
+	m_activeNeighborIndices.resize(m_neighborIndices.size());
+	m_activeNeighborCounts.resize(P.size());
+#if defined(__AVX2__)
+	const SphKernels8 kernels{ _mm256_set1_ps(m_h), _mm256_set1_ps(m_h2), _mm256_set1_ps(m_poly6Coeff), _mm256_set1_ps(m_spikyCoeff), _mm256_set1_ps(m_viscoLaplacianCoeff) };
+#endif
+	ThreadPool::Get().ParallelFor(0, P.size(), kParticleGrain, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+		{
+			// 깨어 있는 입자와 떨어진 잠든 입자는 밀도/압력을 마지막 값으로 둔다
+			if (!NeedsPressure(i)) continue;
+			const uint32_t listBegin = m_neighborOffsets[i], listEnd = m_neighborOffsets[i + 1];
+			int* active = m_activeNeighborIndices.data() + listBegin;
+			int activeCount = 0;
+			float density = P.mass[i] * selfKernel;
+#if defined(__AVX2__)
+			// 이웃 8개씩 : 논문 식(3), 밀도는 Poly6 커널 <논문 식 (20)> (h 밖 레인은 커널 0)
+			const __m256 xi = _mm256_set1_ps(P.x[i]), yi = _mm256_set1_ps(P.y[i]), zi = _mm256_set1_ps(P.z[i]);
+			const __m256 zero = _mm256_setzero_ps();
+			__m256 acc = zero;
+			for (size_t k = listBegin; k < listEnd; k += 8)
+			{
+				__m256 mask;
+				const __m256i j = LoadNeighborIndices(m_neighborIndices.data(), k, listEnd, mask);
+				const __m256 dx = _mm256_sub_ps(xi, Gather(P.x.data(), j, mask, zero));
+				const __m256 dy = _mm256_sub_ps(yi, Gather(P.y.data(), j, mask, zero));
+				const __m256 dz = _mm256_sub_ps(zi, Gather(P.z.data(), j, mask, zero));
+				const __m256 r2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+				const __m256 inside = _mm256_and_ps(mask, _mm256_cmp_ps(r2, kernels.h2, _CMP_LT_OQ));
+				activeCount += CompactStore(active + activeCount, j, _mm256_movemask_ps(inside));
+				// 빈 레인은 질량 0
+				acc = _mm256_add_ps(acc, _mm256_mul_ps(Gather(P.mass.data(), j, mask, zero), kernels.Poly6(r2)));
+			}
+			density += HorizontalSum(acc);
+#else
+			for (uint32_t k = listBegin; k < listEnd; ++k)
+			{
+				const int j = m_neighborIndices[k];
+				// 논문 식(3)
+				const float dx = P.x[i] - P.x[j], dy = P.y[i] - P.y[j], dz = P.z[i] - P.z[j];
+				const float r2 = dx * dx + dy * dy + dz * dz;
+				if (r2 >= m_h2) continue;
+				active[activeCount++] = j;
+
+				// 밀도 계산은 Poly6 커널 사용 <논문 식 (20)>
+				density += P.mass[j] * Kernel_Poly6(r2);
+			}
+#endif
+			m_activeNeighborCounts[i] = static_cast<uint32_t>(activeCount);
+			// avoid zero density
+			P.density[i] = std::max(density, 1e-6f);
+			// 논문 식(12). PCISPH 는 압력 외 힘만 먼저 구하고 압력은 SolvePressurePCISPH 에서
+			P.pressure[i] = equationOfState ? m_params.stiffness * (P.density[i] - m_params.density_zero) : 0.0f;
+		}
+	});
 
 }
 
 void FluidSystem::ComputeForces()
 {
-	std::vector<int> neighbors;
+	FluidParticleArrays& P = m_store;
 	const float mu = m_params.viscocityFactor;
-	const XMVECTOR gravityVec = XMLoadFloat3(&m_params.gravity);
+	const bool surfaceTension = m_params.enableSurfaceTension && m_params.surfaceTension > 0.0f;
+#if defined(__AVX2__)
+	const SphKernels8 kernels{ _mm256_set1_ps(m_h), _mm256_set1_ps(m_h2), _mm256_set1_ps(m_poly6Coeff), _mm256_set1_ps(m_spikyCoeff), _mm256_set1_ps(m_viscoLaplacianCoeff) };
+#endif
+
+	// 입자 i의 힘만 쓰고 이웃은 읽기만 하므로 구간별 병렬
+	ThreadPool::Get().ParallelFor(0, P.size(), kParticleGrain, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			if (!IsParticleActive(i)) continue;
+			const int* neighbors = m_activeNeighborIndices.data() + m_neighborOffsets[i];
+			const uint32_t neighborCount = m_activeNeighborCounts[i];
 
-	// reuse neighbors vector (allocated outside)
-	for (size_t i = 0; i < m_particles.size(); ++i) {
-		Particle& pi = m_particles[i];
-		pi.force = XMVectorZero();
+			const float pressure_i = P.pressure[i];
+			float fPressure[3] = {}, fVisc[3] = {};
+			// for surface tension: accumulate color ci, normal ni, laplacian of color lapc
+			float ci = 0.0f, ni[3] = {}, lapc = 0.0f;
 
-		GetNeighbors(int(i), neighbors);
+#if defined(__AVX2__)
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256 one = _mm256_set1_ps(1.0f);
+			const __m256 xi = _mm256_set1_ps(P.x[i]), yi = _mm256_set1_ps(P.y[i]), zi = _mm256_set1_ps(P.z[i]);
+			const __m256 vxi = _mm256_set1_ps(P.vx[i]), vyi = _mm256_set1_ps(P.vy[i]), vzi = _mm256_set1_ps(P.vz[i]);
+			const __m256 pi8 = _mm256_set1_ps(pressure_i);
+			const __m256 mu8 = _mm256_set1_ps(mu);
 
-		XMVECTOR fPressure = XMVectorZero();
-		XMVECTOR fVisc = XMVectorZero();
+			__m256 fpx = zero, fpy = zero, fpz = zero;
+			__m256 fvx = zero, fvy = zero, fvz = zero;
+			__m256 ci8 = zero, nx8 = zero, ny8 = zero, nz8 = zero, lapc8 = zero;
 
-		// for surface tension: accumulate color ci, normal ni, laplacian of color lapc
-		float ci = 0.0f;
-		XMVECTOR ni = XMVectorZero();
-		float lapc = 0.0f;
+			// 이웃 (r < h) 8개씩 압력, 점성, 표면 장력 누적
+			for (size_t k = 0; k < neighborCount; k += 8)
+			{
+				__m256 valid;
+				const __m256i j = LoadNeighborIndices(neighbors, k, neighborCount, valid);
+				const __m256 rx = _mm256_sub_ps(xi, Gather(P.x.data(), j, valid, zero));
+				const __m256 ry = _mm256_sub_ps(yi, Gather(P.y.data(), j, valid, zero));
+				const __m256 rz = _mm256_sub_ps(zi, Gather(P.z.data(), j, valid, zero));
+				const __m256 r2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(rx, rx), _mm256_mul_ps(ry, ry)), _mm256_mul_ps(rz, rz));
 
-		XMVECTOR pos_i = XMLoadFloat3(&pi.pos);
+				const __m256 r = _mm256_sqrt_ps(r2);
+				const __m256 massJ = Gather(P.mass.data(), j, valid, zero);
+				const __m256 densityJ = Gather(P.density.data(), j, valid, one);
+				const __m256 pressureJ = Gather(P.pressure.data(), j, valid, zero);
+				const __m256 volumeJ = _mm256_div_ps(massJ, densityJ);	// m_j / rho_j (빈 레인 0)
 
-		// single neighbor loop: compute pressure, viscous, and surface-related accumulators
-		for (int j : neighbors) {
-			if (j == int(i)) continue;
+				const __m256 grad = _mm256_and_ps(valid, kernels.SpikyGrad(r));
+				const __m256 lapW = _mm256_and_ps(valid, kernels.ViscLaplacian(r));
 
-			const Particle& pj = m_particles[j];
+				// 압력 (식 10) : -m_j (p_i + p_j) / (2 rho_j) * gradW
+				const __m256 pressureCoef = _mm256_mul_ps(_mm256_mul_ps(volumeJ, _mm256_mul_ps(_mm256_set1_ps(-0.5f), _mm256_add_ps(pi8, pressureJ))), grad);
+				fpx = _mm256_add_ps(fpx, _mm256_mul_ps(rx, pressureCoef));
+				fpy = _mm256_add_ps(fpy, _mm256_mul_ps(ry, pressureCoef));
+				fpz = _mm256_add_ps(fpz, _mm256_mul_ps(rz, pressureCoef));
 
-			// load neighbor pos/vel once
-			XMVECTOR pos_j = XMLoadFloat3(&pj.pos);
+				// 전달 응력 (식 14) : mu m_j / rho_j * lapW * (v_j - v_i)
+				const __m256 viscCoef = _mm256_mul_ps(mu8, _mm256_mul_ps(volumeJ, lapW));
+				fvx = _mm256_add_ps(fvx, _mm256_mul_ps(_mm256_sub_ps(Gather(P.vx.data(), j, valid, zero), vxi), viscCoef));
+				fvy = _mm256_add_ps(fvy, _mm256_mul_ps(_mm256_sub_ps(Gather(P.vy.data(), j, valid, zero), vyi), viscCoef));
+				fvz = _mm256_add_ps(fvz, _mm256_mul_ps(_mm256_sub_ps(Gather(P.vz.data(), j, valid, zero), vzi), viscCoef));
 
-			XMVECTOR rij = pos_i - pos_j;
+				// 표면 장력 (식 15, 16)
+				if (surfaceTension) {
+					ci8 = _mm256_add_ps(ci8, _mm256_mul_ps(volumeJ, _mm256_and_ps(valid, kernels.Poly6(r2))));
+					const __m256 normalCoef = _mm256_mul_ps(volumeJ, grad);
+					nx8 = _mm256_add_ps(nx8, _mm256_mul_ps(rx, normalCoef));
+					ny8 = _mm256_add_ps(ny8, _mm256_mul_ps(ry, normalCoef));
+					nz8 = _mm256_add_ps(nz8, _mm256_mul_ps(rz, normalCoef));
+					lapc8 = _mm256_add_ps(lapc8, _mm256_mul_ps(volumeJ, lapW));
+				}
+			}
 
-			float rSq = XMVectorGetX(XMVector3LengthSq(rij));
-			if (rSq >= m_h * m_h) continue;
-			float r = std::sqrtf(rSq);
+			fPressure[0] = HorizontalSum(fpx); fPressure[1] = HorizontalSum(fpy); fPressure[2] = HorizontalSum(fpz);
+			fVisc[0] = HorizontalSum(fvx); fVisc[1] = HorizontalSum(fvy); fVisc[2] = HorizontalSum(fvz);
+			if (surfaceTension) {
+				ci = HorizontalSum(ci8);
+				ni[0] = HorizontalSum(nx8); ni[1] = HorizontalSum(ny8); ni[2] = HorizontalSum(nz8);
+				lapc = HorizontalSum(lapc8);
+			}
+#else
+			// single neighbor loop: compute pressure, viscous, and surface-related accumulators
+			for (uint32_t k = 0; k < neighborCount; ++k) {
+				const int j = neighbors[k];
 
-			// kernel evaluations (compute once)
-			float w_poly6 = Kernel_Poly6(rSq);    
-			XMVECTOR gradW = Kernel_Spiky_Grad(rij);
-			float lapW = Kernel_Visc_Laplacian(r); 
+				const float rij[3] = { P.x[i] - P.x[j], P.y[i] - P.y[j], P.z[i] - P.z[j] };
+				const float rSq = rij[0] * rij[0] + rij[1] * rij[1] + rij[2] * rij[2];
+				const float r = std::sqrtf(rSq);
 
-			// з ( 10)
-			float pij = (pi.pressure + pj.pressure) / (2.0f * pj.density);
-			XMVECTOR termPressure = XMVectorScale(gradW, -pj.mass * pij);
-			fPressure = fPressure + termPressure;
+				// kernel evaluations (compute once)
+				const float gradW = Kernel_Spiky_Grad(r);
+				const float lapW = Kernel_Visc_Laplacian(r);
+				const float volumeJ = P.mass[j] / P.density[j];
 
-			//   ( 14)
-			XMVECTOR velDiff = pj.vel - pi.vel;
-			XMVECTOR viscTerm = XMVectorScale(velDiff, mu * pj.mass * (lapW / pj.density));
-			fVisc = fVisc + viscTerm;
+				// 압력 (식 10)
+				const float pressureCoef = -volumeJ * 0.5f * (pressure_i + P.pressure[j]) * gradW;
+				// 전달 응력 (식 14)
+				const float viscCoef = mu * volumeJ * lapW;
+				const float velDiff[3] = { P.vx[j] - P.vx[i], P.vy[j] - P.vy[i], P.vz[j] - P.vz[i] };
+				for (int a = 0; a < 3; ++a) {
+					fPressure[a] += rij[a] * pressureCoef;
+					fVisc[a] += velDiff[a] * viscCoef;
+				}
 
-			// ǥ  ( 15)
-			if (m_params.enableSurfaceTension && m_params.surfaceTension > 0.0f) {
-				ci += (pj.mass / pj.density) * w_poly6;
-				// ǥ 븻  ( 16)
-				ni += XMVectorScale(gradW, (pj.mass / pj.density));
+				// 표면 장력 (식 15)
+				if (surfaceTension) {
+					ci += volumeJ * Kernel_Poly6(rSq);
+					// 표면 노말 축적 (식 16)
+					for (int a = 0; a < 3; ++a) ni[a] += rij[a] * gradW * volumeJ;
+					// laplacian of color uses same lapW (visc laplacian)
+					lapc += volumeJ * lapW;
+				}
+			} // end neighbor loop
+#endif
 
-				// laplacian of color uses same lapW (visc laplacian)
-				lapc += (pj.mass / pj.density) * lapW;
+			// external gravity force (as force-density: rho * g)
+			const float rho = P.density[i];
+			float force[3] = {
+				fPressure[0] + fVisc[0] + m_params.gravity.x * rho,
+				fPressure[1] + fVisc[1] + m_params.gravity.y * rho,
+				fPressure[2] + fVisc[2] + m_params.gravity.z * rho
+			};
+
+			// surface tension finalization (if enabled)
+			if (surfaceTension) {
+				const float nlen = std::sqrtf(ni[0] * ni[0] + ni[1] * ni[1] + ni[2] * ni[2]);
+				const float N_THRESHOLD = 1e-4f;
+				const float EPS = 1e-6f;
+				if (nlen > N_THRESHOLD) {
+					const float kappa = -lapc / (nlen + EPS);
+					// fSurf = - sigma * kappa * n_hat
+					const float scale = -m_params.surfaceTension * kappa / (nlen + EPS);
+					for (int a = 0; a < 3; ++a) force[a] += ni[a] * scale;
+				}
 			}
-		} // end neighbor loop
-
-		// external gravity force (as force-density: rho * g)
-		XMVECTOR fExt = XMVectorScale(gravityVec, pi.density);
-
-		// surface tension finalization (if enabled)
-		XMVECTOR fSurf = XMVectorZero();
-		if (m_params.enableSurfaceTension && m_params.surfaceTension > 0.0f) {
-			float nlen = XMVectorGetX(XMVector3Length(ni));
-			const float N_THRESHOLD = 1e-4f;
-			const float EPS = 1e-6f;
-			if (nlen > N_THRESHOLD) {
-				float kappa = -lapc / (nlen + EPS);
-				XMVECTOR n_hat = XMVectorScale(ni, 1.0f / (nlen + EPS));
-				// fSurf = - sigma * kappa * n_hat
-				fSurf = XMVectorScale(n_hat, (-m_params.surfaceTension * kappa));
+
+			// accumulate all forces and store
+			P.fx[i] = force[0];
+			P.fy[i] = force[1];
+			P.fz[i] = force[2];
+		}
+	});
+}
+
+void FluidSystem::ComputePCISPHDelta()
+{
+	// 기준 입자 : 간격 (m / rho_0)^(1/3) 정육면체 격자 한가운데 (이웃이 꽉 참)
+	// 밀도는 Poly6, 압력은 Spiky 기울기라 밀도 변화 = sum m gradW_poly6 . (압력 변위) 에서
+	// delta = 1 / (beta * (sum gradP . sum gradS + sum gradP . gradS)), beta = 2 (dt m / rho_0)^2 -> dt^2 을 뺀 값만 저장
+	const float volume = m_params.defaultMass / m_params.density_zero;
+	const float spacing = std::cbrt(volume);
+	const int extent = static_cast<int>(std::ceil(m_h / spacing));
+	float sumPoly6[3] = {}, sumSpiky[3] = {}, sumProduct = 0.0f;
+	for (int z = -extent; z <= extent; ++z) {
+		for (int y = -extent; y <= extent; ++y) {
+			for (int x = -extent; x <= extent; ++x) {
+				const float rij[3] = { -x * spacing, -y * spacing, -z * spacing };
+				const float r2 = rij[0] * rij[0] + rij[1] * rij[1] + rij[2] * rij[2];
+				if (r2 >= m_h2) continue;
+				const float t = m_h2 - r2;
+				const float poly6 = -6.0f * m_poly6Coeff * t * t;	// Poly6 기울기 = rij * poly6
+				const float spiky = Kernel_Spiky_Grad(std::sqrtf(r2));
+				for (int a = 0; a < 3; ++a) {
+					sumPoly6[a] += rij[a] * poly6;
+					sumSpiky[a] += rij[a] * spiky;
+				}
+				sumProduct += r2 * poly6 * spiky;
 			}
 		}
+	}
+	const float denominator = 2.0f * volume * volume *
+		(sumPoly6[0] * sumSpiky[0] + sumPoly6[1] * sumSpiky[1] + sumPoly6[2] * sumSpiky[2] + sumProduct);
+	m_pcisphDeltaDt2 = denominator > 0.0f ? 1.0f / denominator : 0.0f;
+}
 
-		// accumulate all forces and store
-		pi.force = fPressure + fVisc + fExt + fSurf;
+void FluidSystem::SolvePressurePCISPH(float dt)
+{
+	FluidParticleArrays& P = m_store;
+	const size_t count = P.size();
+	if (count == 0) return;
+
+	const float rho0 = m_params.density_zero;
+	// 기준 입자보다 이웃이 많은 곳 (벽, 뭉친 입자) 은 delta 가 과보정되므로 이완 계수를 곱한다
+	const float delta = m_params.pressureRelaxation * m_pcisphDeltaDt2 / (dt * dt);
+	const float invRho02 = 1.0f / (rho0 * rho0);
+	const float selfKernel = Kernel_Poly6(0.0f);
+	const size_t blockCount = (count + kParticleGrain - 1) / kParticleGrain;
+	for (std::vector<float>* a : { &m_predX, &m_predY, &m_predZ, &m_pressureAx, &m_pressureAy, &m_pressureAz })
+		a->resize(count);
+	m_blockDensityError.assign(blockCount, 0.0f);
+#if defined(__AVX2__)
+	const SphKernels8 kernels{ _mm256_set1_ps(m_h), _mm256_set1_ps(m_h2), _mm256_set1_ps(m_poly6Coeff), _mm256_set1_ps(m_spikyCoeff), _mm256_set1_ps(m_viscoLaplacianCoeff) };
+#endif
+
+	// 압력 가속도 a 로 속도/위치 예측 : v* = v + dt (f / rho + a), x* = x + dt v*
+	// 도메인 AABB 는 예측에도 적용 (벽 밖으로 예측되면 벽 쪽 밀도를 과소평가해 압력이 모자라다)
+	// 잠든 입자는 제자리 (경계 입자는 압력만 보정, 나머지는 마지막 값 유지)
+	auto predict = [&](size_t i) {
+		if (!IsParticleActive(i)) {
+			m_predX[i] = P.x[i];
+			m_predY[i] = P.y[i];
+			m_predZ[i] = P.z[i];
+			return;
+		}
+		const float invDensity = 1.0f / P.density[i];
+		m_predX[i] = std::clamp(P.x[i] + dt * (P.vx[i] + dt * (P.fx[i] * invDensity + m_pressureAx[i])), m_domainMin.x, m_domainMax.x);
+		m_predY[i] = std::clamp(P.y[i] + dt * (P.vy[i] + dt * (P.fy[i] * invDensity + m_pressureAy[i])), m_domainMin.y, m_domainMax.y);
+		m_predZ[i] = std::clamp(P.z[i] + dt * (P.vz[i] + dt * (P.fz[i] * invDensity + m_pressureAz[i])), m_domainMin.z, m_domainMax.z);
+	};
+
+	ThreadPool::Get().ParallelFor(0, count, kParticleGrain, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			m_pressureAx[i] = m_pressureAy[i] = m_pressureAz[i] = 0.0f;
+			if (NeedsPressure(i)) P.pressure[i] = 0.0f;
+			predict(i);
+		}
+	});
+
+	const int minIterations = std::max(m_params.minPressureIterations, 1);
+	const int maxIterations = std::max(m_params.maxPressureIterations, minIterations);
+	int iteration = 0;
+	float densityError = 0.0f;
+	while (iteration < maxIterations) {
+		// 예측 밀도 -> 압력 보정 (Verlet 목록 이웃을 예측 위치로 다시 거른다)
+		ThreadPool::Get().ParallelForIndexed(0, count, kParticleGrain, [&](uint32_t, size_t begin, size_t end) {
+			float blockError = 0.0f;
+			for (size_t i = begin; i < end; ++i) {
+				if (!NeedsPressure(i)) continue;
+				const uint32_t listBegin = m_neighborOffsets[i], listEnd = m_neighborOffsets[i + 1];
+				float density = P.mass[i] * selfKernel;
+#if defined(__AVX2__)
+				const __m256 xi = _mm256_set1_ps(m_predX[i]), yi = _mm256_set1_ps(m_predY[i]), zi = _mm256_set1_ps(m_predZ[i]);
+				const __m256 zero = _mm256_setzero_ps();
+				__m256 acc = zero;
+				for (size_t k = listBegin; k < listEnd; k += 8)
+				{
+					__m256 mask;
+					const __m256i j = LoadNeighborIndices(m_neighborIndices.data(), k, listEnd, mask);
+					const __m256 dx = _mm256_sub_ps(xi, Gather(m_predX.data(), j, mask, zero));
+					const __m256 dy = _mm256_sub_ps(yi, Gather(m_predY.data(), j, mask, zero));
+					const __m256 dz = _mm256_sub_ps(zi, Gather(m_predZ.data(), j, mask, zero));
+					const __m256 r2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+					acc = _mm256_add_ps(acc, _mm256_mul_ps(Gather(P.mass.data(), j, mask, zero), kernels.Poly6(r2)));
+				}
+				density += HorizontalSum(acc);
+#else
+				for (uint32_t k = listBegin; k < listEnd; ++k)
+				{
+					const int j = m_neighborIndices[k];
+					const float dx = m_predX[i] - m_predX[j], dy = m_predY[i] - m_predY[j], dz = m_predZ[i] - m_predZ[j];
+					density += P.mass[j] * Kernel_Poly6(dx * dx + dy * dy + dz * dz);
+				}
+#endif
+				// 인장 (음수 압력) 은 두지 않는다 : 자유 표면 입자는 이웃이 모자라 항상 밀도가 낮다
+				const float error = density - rho0;
+				P.pressure[i] = std::max(P.pressure[i] + delta * error, 0.0f);
+				blockError = std::max(blockError, error);
+			}
+			m_blockDensityError[begin / kParticleGrain] = blockError / rho0;
+		});
+
+		// 압력 가속도 (현재 위치, r < h 이웃) : a_i = -sum m_j (p_i + p_j) / rho_0^2 gradW_ij. 다음 반복의 예측 위치까지
+		ThreadPool::Get().ParallelFor(0, count, kParticleGrain, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				if (!IsParticleActive(i)) continue;
+				const int* neighbors = m_activeNeighborIndices.data() + m_neighborOffsets[i];
+				const uint32_t neighborCount = m_activeNeighborCounts[i];
+				const float pressure_i = P.pressure[i];
+				float accel[3] = {};
+#if defined(__AVX2__)
+				const __m256 zero = _mm256_setzero_ps();
+				const __m256 xi = _mm256_set1_ps(P.x[i]), yi = _mm256_set1_ps(P.y[i]), zi = _mm256_set1_ps(P.z[i]);
+				const __m256 pi8 = _mm256_set1_ps(pressure_i);
+				__m256 ax = zero, ay = zero, az = zero;
+				for (size_t k = 0; k < neighborCount; k += 8)
+				{
+					__m256 valid;
+					const __m256i j = LoadNeighborIndices(neighbors, k, neighborCount, valid);
+					const __m256 rx = _mm256_sub_ps(xi, Gather(P.x.data(), j, valid, zero));
+					const __m256 ry = _mm256_sub_ps(yi, Gather(P.y.data(), j, valid, zero));
+					const __m256 rz = _mm256_sub_ps(zi, Gather(P.z.data(), j, valid, zero));
+					const __m256 r = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(rx, rx), _mm256_mul_ps(ry, ry)), _mm256_mul_ps(rz, rz)));
+					const __m256 grad = _mm256_and_ps(valid, kernels.SpikyGrad(r));
+					// 빈 레인은 질량 0
+					const __m256 coef = _mm256_mul_ps(_mm256_mul_ps(Gather(P.mass.data(), j, valid, zero), _mm256_add_ps(pi8, Gather(P.pressure.data(), j, valid, zero))), grad);
+					ax = _mm256_add_ps(ax, _mm256_mul_ps(rx, coef));
+					ay = _mm256_add_ps(ay, _mm256_mul_ps(ry, coef));
+					az = _mm256_add_ps(az, _mm256_mul_ps(rz, coef));
+				}
+				accel[0] = HorizontalSum(ax); accel[1] = HorizontalSum(ay); accel[2] = HorizontalSum(az);
+#else
+				for (uint32_t k = 0; k < neighborCount; ++k) {
+					const int j = neighbors[k];
+					const float rij[3] = { P.x[i] - P.x[j], P.y[i] - P.y[j], P.z[i] - P.z[j] };
+					const float coef = P.mass[j] * (pressure_i + P.pressure[j]) * Kernel_Spiky_Grad(std::sqrtf(rij[0] * rij[0] + rij[1] * rij[1] + rij[2] * rij[2]));
+					for (int a = 0; a < 3; ++a) accel[a] += rij[a] * coef;
+				}
+#endif
+				m_pressureAx[i] = -accel[0] * invRho02;
+				m_pressureAy[i] = -accel[1] * invRho02;
+				m_pressureAz[i] = -accel[2] * invRho02;
+				predict(i);
+			}
+		});
+
+		++iteration;
+		// 블록 순서 리덕션 (max 라 순서와 무관하지만 스레드 수와 무관한 반복 횟수를 보장)
+		densityError = 0.0f;
+		for (float e : m_blockDensityError) densityError = std::max(densityError, e);
+		if (iteration >= minIterations && densityError <= m_params.maxDensityError) break;
 	}
+
+	// 압력 가속도를 힘 밀도로 합쳐 Integrate 가 그대로 적분
+	ThreadPool::Get().ParallelFor(0, count, kParticleGrain, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			P.fx[i] += P.density[i] * m_pressureAx[i];
+			P.fy[i] += P.density[i] * m_pressureAy[i];
+			P.fz[i] += P.density[i] * m_pressureAz[i];
+		}
+	});
+
+	m_stepStats.pressureIterations = static_cast<uint32_t>(iteration);
+	m_stepStats.densityError = densityError;
 }
+
 void FluidSystem::Integrate(float dt)
 {
-	for (auto& p : m_particles) {
-		// acceleration = force / rho
-		XMVECTOR acc = p.force / p.density;
-		// semi-implicit Euler (symplectic)
-		p.vel += acc * dt;
-		XMVECTOR pos = XMLoadFloat3(&p.pos);
-		pos += p.vel * dt;
-		XMStoreFloat3(&p.pos, pos);
+	FluidParticleArrays& P = m_store;
+	// 블록별 부분값은 여기서 초기화 : 적분 (최대 가속도) -> 경계 처리 (속력, 밀도, 이동량) 순으로 채운다
+	m_blockStats.assign((P.size() + kParticleGrain - 1) / kParticleGrain, StepBlockStats{});
+	ThreadPool::Get().ParallelForIndexed(0, P.size(), kParticleGrain, [&](uint32_t, size_t begin, size_t end) {
+		float maxAcceleration2 = 0.0f;
+		for (size_t i = begin; i < end; ++i) {
+			if (!IsParticleActive(i)) {
+				P.vx[i] = P.vy[i] = P.vz[i] = 0.0f;
+				continue;
+			}
+			// acceleration = force / rho, semi-implicit Euler (symplectic)
+			const float invDensity = 1.0f / P.density[i];
+			const float ax = P.fx[i] * invDensity, ay = P.fy[i] * invDensity, az = P.fz[i] * invDensity;
+			maxAcceleration2 = std::max(maxAcceleration2, ax * ax + ay * ay + az * az);
+			P.vx[i] += ax * dt;
+			P.vy[i] += ay * dt;
+			P.vz[i] += az * dt;
+			P.x[i] += P.vx[i] * dt;
+			P.y[i] += P.vy[i] * dt;
+			P.z[i] += P.vz[i] * dt;
+		}
+		m_blockStats[begin / kParticleGrain].maxAcceleration2 = maxAcceleration2;
+	});
+}
+
+void FluidSystem::BuildBoundaryCache()
+{
+	const SdfCollision::Volume& volume = m_boundaryVolume;
+	const SdfField<float>& field = *volume.field;
+	const float radius = m_params.boundaryRadius > 0.0f ? m_params.boundaryRadius : 0.5f * m_h;
+	const bool full = m_boundaryCellNear.size() != m_numCells || radius != m_boundaryRadius;
+	if (full) {
+		m_boundaryCellNear.assign(m_numCells, 0);
+		m_boundaryCellNormal.assign(m_numCells, XMFLOAT3{ 0.0f, 1.0f, 0.0f });
+		m_boundaryRadius = radius;
 	}
+
+	const float invCell = 1.0f / volume.cellsize;
+	const float domainMin[3] = { m_domainMin.x, m_domainMin.y, m_domainMin.z };
+	const float origin[3] = { volume.origin.x, volume.origin.y, volume.origin.z };
+	const int size[3] = { field.sx(), field.sy(), field.sz() };
+	const int dirtyMin[3] = { m_boundaryDirtyMin.x, m_boundaryDirtyMin.y, m_boundaryDirtyMin.z };
+	const int dirtyMax[3] = { m_boundaryDirtyMax.x, m_boundaryDirtyMax.y, m_boundaryDirtyMax.z };
+
+	ThreadPool::Get().ParallelFor(0, m_numCells, kBoundaryCellGrain, [&](size_t begin, size_t end) {
+		for (size_t c = begin; c < end; ++c) {
+			const int cell[3] = {
+				static_cast<int>(c % m_gridDim[0]),
+				static_cast<int>((c / m_gridDim[0]) % m_gridDim[1]),
+				static_cast<int>(c / (size_t(m_gridDim[0]) * m_gridDim[1]))
+			};
+
+			// 셀을 반경만큼 넓힌 상자를 덮는 샘플 범위 (필드 밖은 샘플링과 같이 경계로 클램프)
+			int lo[3], hi[3];
+			bool dirty = full;
+			for (int a = 0; a < 3; ++a) {
+				const float cellLo = domainMin[a] + cell[a] * m_cellSize;
+				lo[a] = std::clamp(int(std::floor((cellLo - radius - origin[a]) * invCell)), 0, size[a] - 1);
+				hi[a] = std::clamp(int(std::ceil((cellLo + m_cellSize + radius - origin[a]) * invCell)), 0, size[a] - 1);
+			}
+			if (!dirty)
+				dirty = lo[0] <= dirtyMax[0] && hi[0] >= dirtyMin[0] && lo[1] <= dirtyMax[1] && hi[1] >= dirtyMin[1] && lo[2] <= dirtyMax[2] && hi[2] >= dirtyMin[2];
+			if (!dirty) continue;
+			// 지형이 바뀐 셀은 잠든 입자도 다시 경계 처리를 받도록 깨운다
+			if (c < m_cellQuietSteps.size()) m_cellQuietSteps[c] = 0;
+
+			// 상자 안 trilinear 값은 이 샘플들의 범위 안 : 모두 iso 미만이면 반경 안에 표면/내부가 없다
+			bool nearSurface = false;
+			for (int z = lo[2]; z <= hi[2] && !nearSurface; ++z)
+				for (int y = lo[1]; y <= hi[1] && !nearSurface; ++y)
+					for (int x = lo[0]; x <= hi[0]; ++x)
+						if (field.at(x, y, z) >= volume.isoValue) { nearSurface = true; break; }
+			m_boundaryCellNear[c] = nearSurface ? 1 : 0;
+
+			XMFLOAT3 grad;
+			SdfRaycast::SampleTrilinearGradient(field,
+				(domainMin[0] + (cell[0] + 0.5f) * m_cellSize - origin[0]) * invCell,
+				(domainMin[1] + (cell[1] + 0.5f) * m_cellSize - origin[1]) * invCell,
+				(domainMin[2] + (cell[2] + 0.5f) * m_cellSize - origin[2]) * invCell, grad);
+			const float gradLen = std::sqrt(grad.x * grad.x + grad.y * grad.y + grad.z * grad.z);
+			m_boundaryCellNormal[c] = gradLen > 1e-12f ? XMFLOAT3{ -grad.x / gradLen, -grad.y / gradLen, -grad.z / gradLen } : XMFLOAT3{ 0.0f, 1.0f, 0.0f };
+		}
+	});
+
+	m_boundaryCacheDirty = false;
 }
 
-//  Boundary ü Ѿ ʵ AABB ó
+// 지형 SdfField (설정 시) 와 도메인 AABB 를 유체가 넘어가지 않도록 처리
 void FluidSystem::ApplyBoundaryConditions()
 {
+	FluidParticleArrays& P = m_store;
+	const float damping = m_params.boundaryDamping;
+	const float friction = std::clamp(m_params.boundaryFriction, 0.0f, 1.0f);
+
+	// 경계 처리 후 최종 상태로 블록별 부분값 (속력 최대, 밀도 합, 목록 재구성 후 이동량 최대) 을 같이 구한다 (m_blockStats 는 Integrate 에서 초기화)
+
+	const bool useVolume = m_hasBoundaryVolume;
+	if (useVolume && m_boundaryCacheDirty) BuildBoundaryCache();
+	const SdfCollision::Volume& volume = m_boundaryVolume;
+	const float invCell = 1.0f / volume.cellsize;
+	const float radius = m_boundaryRadius;
+	// 1차 근사 거리는 표면에서 1셀 정도까지만 믿을 수 있으므로 한 Step 에 밀어내는 깊이를 제한 (깊이 박힌 입자는 여러 Step 에 걸쳐 빠짐)
+	const float maxPush = radius + volume.cellsize;
+
+	// SDF 경계 : 관통 깊이만큼 외부 방향으로 밀고, 표면으로 들어가는 법선 속도는 damping 으로 반사, 접선 속도는 friction 만큼 감쇠
+	auto collide = [&](size_t i, const XMFLOAT3& cellNormal) -> bool {
+		XMFLOAT3 grad;
+		const float f = SdfRaycast::SampleTrilinearGradient(*volume.field,
+			(P.x[i] - volume.origin.x) * invCell, (P.y[i] - volume.origin.y) * invCell, (P.z[i] - volume.origin.z) * invCell, grad);
+		const float gradLen = std::sqrt(grad.x * grad.x + grad.y * grad.y + grad.z * grad.z) * invCell;
+
+		float distance, nx, ny, nz;
+		if (gradLen > 1e-12f) {
+			distance = (volume.isoValue - f) / gradLen;
+			const float inv = -invCell / gradLen;
+			nx = grad.x * inv; ny = grad.y * inv; nz = grad.z * inv;
+		}
+		else {
+			if (f < volume.isoValue) return false;
+			// 포화된 내부 (gradient 0) : 셀 캐시 방향으로 최대 깊이만큼
+			distance = -volume.cellsize;
+			nx = cellNormal.x; ny = cellNormal.y; nz = cellNormal.z;
+		}
+		if (distance >= radius) return false;
+
+		const float push = std::min(radius - distance, maxPush);
+		P.x[i] += nx * push;
+		P.y[i] += ny * push;
+		P.z[i] += nz * push;
+
+		const float vn = P.vx[i] * nx + P.vy[i] * ny + P.vz[i] * nz;
+		if (vn < 0.0f) {
+			const float tx = P.vx[i] - vn * nx, ty = P.vy[i] - vn * ny, tz = P.vz[i] - vn * nz;
+			const float keep = 1.0f - friction;
+			P.vx[i] = tx * keep - vn * damping * nx;
+			P.vy[i] = ty * keep - vn * damping * ny;
+			P.vz[i] = tz * keep - vn * damping * nz;
+		}
+		return true;
+	};
+
+	const bool sleeping = m_params.enableSleeping;
+	const float sleepSpeed2 = m_params.sleepVelocity * m_params.sleepVelocity;
+	const float sleepDensity = m_params.density_zero * (1.0f + m_params.sleepDensityError);
+	const float wakeDensity = m_params.density_zero * (1.0f + 2.0f * m_params.sleepDensityError);
+	if (sleeping) m_particleDisturbedCell.resize(P.size());
+
 	// simple AABB bounce with damping
-	for (auto& p : m_particles) {
-		// X
-		if (p.pos.x < m_domainMin.x) {
-			p.pos.x = m_domainMin.x;
-			p.vel *= XMVECTOR{ -m_params.boundaryDamping, 1.0f, 1.0f };
+	auto bounce = [damping](float& pos, float& vel, float lo, float hi) {
+		if (pos < lo) {
+			pos = lo;
+			vel *= -damping;
 		}
-		else if (p.pos.x > m_domainMax.x) {
-			p.pos.x = m_domainMax.x;
-			p.vel *= XMVECTOR{ -m_params.boundaryDamping, 1.0f, 1.0f };
+		else if (pos > hi) {
+			pos = hi;
+			vel *= -damping;
 		}
-		// Y
-		if (p.pos.y < m_domainMin.y) {
-			p.pos.y = m_domainMin.y;
-			p.vel *= XMVECTOR{ 1.0f, -m_params.boundaryDamping, 1.0f };
+	};
+	ThreadPool::Get().ParallelForIndexed(0, P.size(), kParticleGrain, [&](uint32_t, size_t begin, size_t end) {
+		StepBlockStats& block = m_blockStats[begin / kParticleGrain];
+
+		if (useVolume) {
+			// 블록 안에서 경계 근처 셀의 입자만 모아 필드를 샘플 (먼 셀 입자는 필드를 읽지 않음)
+			uint32_t candidates[kParticleGrain];
+			uint32_t candidateCells[kParticleGrain];
+			uint32_t count = 0;
+			for (size_t i = begin; i < end; ++i) {
+				if (!IsParticleActive(i)) continue;
+				int ic, jc, kc;
+				PositionToCell(P.x[i], P.y[i], P.z[i], ic, jc, kc);
+				const int c = CellIndexFromCoord(ic, jc, kc);
+				// 도메인 밖 입자 (AABB 처리 전) 는 캐시가 없으므로 항상 샘플
+				if (c >= 0 && !m_boundaryCellNear[c]) continue;
+				candidates[count] = static_cast<uint32_t>(i);
+				candidateCells[count++] = static_cast<uint32_t>(c);
+			}
+
+			const XMFLOAT3 up = { 0.0f, 1.0f, 0.0f };
+			for (uint32_t k = 0; k < count; ++k) {
+				const uint32_t c = candidateCells[k];
+				if (collide(candidates[k], c == UINT32_MAX ? up : m_boundaryCellNormal[c])) ++block.boundaryContacts;
+			}
+			block.boundaryCandidates = count;
 		}
-		else if (p.pos.y > m_domainMax.y) {
-			p.pos.y = m_domainMax.y;
-			p.vel *= XMVECTOR{ 1.0f, -m_params.boundaryDamping, 1.0f };
+
+		for (size_t i = begin; i < end; ++i) {
+			bounce(P.x[i], P.vx[i], m_domainMin.x, m_domainMax.x);
+			bounce(P.y[i], P.vy[i], m_domainMin.y, m_domainMax.y);
+			bounce(P.z[i], P.vz[i], m_domainMin.z, m_domainMax.z);
+
+			const float speed2 = P.vx[i] * P.vx[i] + P.vy[i] * P.vy[i] + P.vz[i] * P.vz[i];
+			if (sleeping) {
+				// 잠자기 임계값을 넘은 깨어 있는 입자의 셀 (도메인 밖은 기록 안 함). 깨우기 임계값 (2배) 을 넘으면 kWakeNeighbors 비트
+				uint32_t disturbedCell = UINT32_MAX;
+				if (IsParticleActive(i) && (speed2 > sleepSpeed2 || P.density[i] > sleepDensity)) {
+					int ic, jc, kc;
+					PositionToCell(P.x[i], P.y[i], P.z[i], ic, jc, kc);
+					const int c = CellIndexFromCoord(ic, jc, kc);
+					if (c >= 0) {
+						const bool wake = speed2 > 4.0f * sleepSpeed2 || P.density[i] > wakeDensity;
+						disturbedCell = static_cast<uint32_t>(c) | (wake ? kWakeNeighbors : 0u);
+					}
+				}
+				m_particleDisturbedCell[i] = disturbedCell;
+			}
+			block.maxSpeed = std::max(block.maxSpeed, std::sqrtf(speed2));
+			block.densitySum += P.density[i];
+
+			const float dx = P.x[i] - m_listX[i], dy = P.y[i] - m_listY[i], dz = P.z[i] - m_listZ[i];
+			block.maxDisplacement2 = std::max(block.maxDisplacement2, dx * dx + dy * dy + dz * dz);
 		}
-		// Z
-		if (p.pos.z < m_domainMin.z) {
-			p.pos.z = m_domainMin.z;
-			p.vel *= XMVECTOR{ 1.0f, 1.0f, -m_params.boundaryDamping };
+	});
+}
+
+void FluidSystem::UpdateParticleActivity()
+{
+	if (!m_params.enableSleeping) {
+		m_sleeping = false;
+		return;
+	}
+	if (m_wakeAll || m_cellQuietSteps.size() != m_numCells) {
+		m_cellQuietSteps.assign(m_numCells, 0);
+		m_cellWakeStamp.assign(m_numCells, 0);
+		m_sleepingCells = 0;
+		m_wakeAll = false;
+	}
+	m_sleeping = m_sleepingCells > 0;
+	if (!m_sleeping) return;
+
+	FluidParticleArrays& P = m_store;
+	const uint16_t sleepSteps = static_cast<uint16_t>(std::clamp(m_params.sleepSteps, 1, UINT16_MAX));
+	// 잠든 셀로 들어온 입자도 아직 움직이고 있으면 계산 (잠든 입자는 속도 0). 그 셀은 이번 Step 끝에 다시 깨어남
+	const float sleepSpeed2 = m_params.sleepVelocity * m_params.sleepVelocity;
+	m_particleState.resize(P.size());
+	ThreadPool::Get().ParallelFor(0, P.size(), kParticleGrain, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			int ic, jc, kc;
+			PositionToCell(P.x[i], P.y[i], P.z[i], ic, jc, kc);
+			const int c = CellIndexFromCoord(ic, jc, kc);
+			const float speed2 = P.vx[i] * P.vx[i] + P.vy[i] * P.vy[i] + P.vz[i] * P.vz[i];
+			const bool active = c < 0 || m_cellQuietSteps[c] < sleepSteps || speed2 > sleepSpeed2;
+			m_particleState[i] = active ? kParticleActive : kParticleAsleep;
 		}
-		else if (p.pos.z > m_domainMax.z) {
-			p.pos.z = m_domainMax.z;
-			p.vel *= XMVECTOR{ 1.0f, 1.0f, -m_params.boundaryDamping };
+	});
+
+	// 깨어 있는 입자가 있는 셀의 27 이웃 셀 안 잠든 입자 -> 경계 입자 (h 이웃은 셀 하나 건너까지)
+	m_cellHasActive.assign(m_numCells, 0);
+	for (size_t i = 0; i < P.size(); ++i) {
+		if (m_particleState[i] != kParticleActive) continue;
+		int ic, jc, kc;
+		PositionToCell(P.x[i], P.y[i], P.z[i], ic, jc, kc);
+		const int c = CellIndexFromCoord(ic, jc, kc);
+		if (c >= 0) m_cellHasActive[c] = 1;
+	}
+	ThreadPool::Get().ParallelFor(0, P.size(), kParticleGrain, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			if (m_particleState[i] != kParticleAsleep) continue;
+			int ic, jc, kc;
+			PositionToCell(P.x[i], P.y[i], P.z[i], ic, jc, kc);
+			bool border = false;
+			for (int dz = -1; dz <= 1 && !border; ++dz)
+				for (int dy = -1; dy <= 1 && !border; ++dy)
+					for (int dx = -1; dx <= 1 && !border; ++dx) {
+						const int n = CellIndexFromCoord(ic + dx, jc + dy, kc + dz);
+						border = n >= 0 && m_cellHasActive[n];
+					}
+			if (border) m_particleState[i] = kParticleBorder;
 		}
+	});
+}
+
+void FluidSystem::UpdateSleepState()
+{
+	const size_t count = m_store.size();
+	m_stepStats.activeParticles = static_cast<uint32_t>(count);
+	m_stepStats.sleepingCells = 0;
+	if (!m_params.enableSleeping) return;
+
+	if (m_sleeping) {
+		uint32_t active = 0;
+		for (size_t i = 0; i < count; ++i) active += m_particleState[i] == kParticleActive;
+		m_stepStats.activeParticles = active;
+	}
+
+	// Step 끝 위치 기준으로 깨어 있는 입자가 있는 셀만 한 Step 조용했다고 세고, 빈 셀은 0 (잠든 셀로 치지 않아 그리 들어간 입자가 멈추지 않음),
+	// 잠든 입자만 있는 셀은 그대로 둔다. 그 뒤 잠자기 임계값을 넘은 입자의 셀은 0 으로.
+	// 깨우기 임계값 (2배) 을 넘은 입자는 26 이웃 셀도 0 으로 (다음 Step 에 깨어 있음). 두 임계값 사이 입자는 잠든 이웃을 깨우지 않는다 (떨림 히스테리시스)
+	const uint16_t sleepSteps = static_cast<uint16_t>(std::clamp(m_params.sleepSteps, 1, UINT16_MAX));
+	const FluidParticleArrays& P = m_store;
+	m_cellOccupancy.assign(m_numCells, kCellEmpty);
+	for (size_t i = 0; i < count; ++i) {
+		int ic, jc, kc;
+		PositionToCell(P.x[i], P.y[i], P.z[i], ic, jc, kc);
+		const int c = CellIndexFromCoord(ic, jc, kc);
+		if (c < 0) continue;
+		const uint8_t occupancy = (!m_sleeping || m_particleState[i] == kParticleActive) ? kCellActive : kCellAsleep;
+		m_cellOccupancy[c] = std::max(m_cellOccupancy[c], occupancy);
+	}
+	for (size_t c = 0; c < m_cellQuietSteps.size(); ++c) {
+		uint16_t& quiet = m_cellQuietSteps[c];
+		if (m_cellOccupancy[c] == kCellEmpty) quiet = 0;
+		else if (m_cellOccupancy[c] == kCellActive && quiet < sleepSteps) ++quiet;
+	}
+
+	if (++m_sleepStamp == 0) {
+		std::fill(m_cellWakeStamp.begin(), m_cellWakeStamp.end(), 0u);
+		m_sleepStamp = 1;
+	}
+	for (size_t i = 0; i < count; ++i) {
+		const uint32_t disturbed = m_particleDisturbedCell[i];
+		if (disturbed == UINT32_MAX) continue;
+		const uint32_t c = disturbed & ~kWakeNeighbors;
+		m_cellQuietSteps[c] = 0;
+		if (!(disturbed & kWakeNeighbors) || m_cellWakeStamp[c] == m_sleepStamp) continue;
+		m_cellWakeStamp[c] = m_sleepStamp;
+
+		const int ic = static_cast<int>(c % m_gridDim[0]);
+		const int jc = static_cast<int>((c / m_gridDim[0]) % m_gridDim[1]);
+		const int kc = static_cast<int>(c / (size_t(m_gridDim[0]) * m_gridDim[1]));
+		for (int dz = -1; dz <= 1; ++dz)
+			for (int dy = -1; dy <= 1; ++dy)
+				for (int dx = -1; dx <= 1; ++dx) {
+					const int n = CellIndexFromCoord(ic + dx, jc + dy, kc + dz);
+					if (n >= 0) m_cellQuietSteps[n] = 0;
+				}
+	}
+
+	uint32_t sleepingCells = 0;
+	for (uint16_t quiet : m_cellQuietSteps) sleepingCells += quiet >= sleepSteps;
+	m_sleepingCells = sleepingCells;
+	m_stepStats.sleepingCells = sleepingCells;
+}
+
+void FluidSystem::ReduceStepStats()
+{
+	// 블록 순서대로 합산 : 스레드 수와 무관하게 같은 결과
+	FluidStepStats stats;
+	stats.particleCount = static_cast<uint32_t>(m_store.size());
+	stats.neighborListsRebuilt = m_stepStats.neighborListsRebuilt;
+	stats.pressureIterations = m_stepStats.pressureIterations;
+	stats.densityError = m_stepStats.densityError;
+	double densitySum = 0.0;
+	m_maxDisplacement2 = 0.0f;
+	float maxAcceleration2 = 0.0f;
+	for (const StepBlockStats& block : m_blockStats) {
+		maxAcceleration2 = std::max(maxAcceleration2, block.maxAcceleration2);
+		stats.maxSpeed = std::max(stats.maxSpeed, block.maxSpeed);
+		densitySum += block.densitySum;
+		m_maxDisplacement2 = std::max(m_maxDisplacement2, block.maxDisplacement2);
+		stats.boundaryCandidates += block.boundaryCandidates;
+		stats.boundaryContacts += block.boundaryContacts;
 	}
+	stats.maxAcceleration = std::sqrtf(maxAcceleration2);
+	stats.averageDensity = m_store.size() == 0 ? 0.0f : static_cast<float>(densitySum / m_store.size());
+	m_stepStats = stats;
 }
 
-void FluidSystem::GetNeighbors(int pi, std::vector<int>& outNeighbors) const
+FluidNeighborStats FluidSystem::GetNeighborStats() const
 {
-	outNeighbors.clear();
-	const XMFLOAT3& p = m_particles[pi].pos;
+	// 마지막 Step 이후 입자를 추가했으면 목록이 입자 수보다 짧다 (목록이 있는 입자만 센다)
+	FluidNeighborStats stats;
+	if (!m_neighborOffsets.empty()) stats.listEntries = m_neighborOffsets.back();
+	const size_t count = std::min(m_activeNeighborCounts.size(), m_store.size());
+	for (size_t i = 0; i < count; ++i) {
+		stats.activeEntries += m_activeNeighborCounts[i];
+		stats.maxActive = std::max(stats.maxActive, m_activeNeighborCounts[i]);
+	}
+	return stats;
+}
+
+size_t FluidSystem::GetMemoryBytes() const
+{
+	size_t bytes = CapacityBytes(m_store) + CapacityBytes(m_sortScratch)
+		+ CapacityBytes(m_particles) + CapacityBytes(m_particleScratch);
+	// 격자
+	bytes += CapacityBytes(m_cellStart) + CapacityBytes(m_particleCell) + CapacityBytes(m_sortCursor) + CapacityBytes(m_sortOrder);
+	// 이웃 목록
+	bytes += CapacityBytes(m_neighborOffsets) + CapacityBytes(m_neighborIndices) + CapacityBytes(m_blockNeighbors)
+		+ CapacityBytes(m_activeNeighborIndices) + CapacityBytes(m_activeNeighborCounts)
+		+ CapacityBytes(m_listX) + CapacityBytes(m_listY) + CapacityBytes(m_listZ);
+	for (const std::vector<int>& block : m_blockNeighbors) bytes += CapacityBytes(block);
+	// 경계 캐시, PCISPH, 잠자기, 블록 통계
+	bytes += CapacityBytes(m_boundaryCellNear) + CapacityBytes(m_boundaryCellNormal);
+	bytes += CapacityBytes(m_predX) + CapacityBytes(m_predY) + CapacityBytes(m_predZ)
+		+ CapacityBytes(m_pressureAx) + CapacityBytes(m_pressureAy) + CapacityBytes(m_pressureAz) + CapacityBytes(m_blockDensityError);
+	bytes += CapacityBytes(m_cellQuietSteps) + CapacityBytes(m_cellWakeStamp) + CapacityBytes(m_particleState)
+		+ CapacityBytes(m_cellHasActive) + CapacityBytes(m_cellOccupancy) + CapacityBytes(m_particleDisturbedCell);
+	bytes += CapacityBytes(m_blockStats);
+	return bytes;
+}
+
+int FluidSystem::GetNeighborRanges(int pi, NeighborRange (&outRanges)[9]) const
+{
+	// 셀 인덱스는 x 가 가장 빠르므로 (dy, dz) 마다 x-1..x+1 세 셀이 하나의 연속 구간
 	int ic, jc, kc;
-	PositionToCell(p, ic, jc, kc);
+	PositionToCell(m_store.x[pi], m_store.y[pi], m_store.z[pi], ic, jc, kc);
+	const int x0 = std::max(ic - 1, 0), x1 = std::min(ic + 1, m_gridDim[0] - 1);
+	if (x0 > x1) return 0;
+
+	int count = 0;
 	for (int dz = -1; dz <= 1; ++dz) {
 		for (int dy = -1; dy <= 1; ++dy) {
-			for (int dx = -1; dx <= 1; ++dx) {
-				int ix = ic + dx, iy = jc + dy, iz = kc + dz;
-				int idx = CellIndexFromCoord(ix, iy, iz);
-				if (idx < 0) continue;
-				const auto& bucket = m_buckets[idx];
-				for (int j : bucket) outNeighbors.push_back(j);
-			}
+			const int first = CellIndexFromCoord(x0, jc + dy, kc + dz);
+			if (first < 0) continue;
+			const int last = first + (x1 - x0);
+			const uint32_t begin = m_cellStart[first], end = m_cellStart[last + 1];
+			if (begin < end) outRanges[count++] = { begin, end };
 		}
 	}
+	return count;
 }
@@ -1,5 +1,7 @@
 #pragma once
+#include "Core/Geometry/MarchingCubes/SdfCollision.h"
 #include <array>
+#include <vector>
 
 struct Particle
 {
@@ -16,44 +18,188 @@ struct Particle
 	Particle(const XMFLOAT3& p, const XMVECTOR& v, float m = 1.0f) : pos(p), vel(v), mass(m) {}
 };
 
+// 압력 계산 방식
+enum class FluidSolver : uint8_t
+{
+	EquationOfState,	// p = stiffness * (rho - rho_0), 압축성이라 작은 dt 필요
+	PCISPH,				// 예측-보정 반복으로 밀도 오차를 maxDensityError 이하로 (Solenthaler & Pajarola 2009)
+};
+
 struct FluidParams 
 {
-	float density_zero = 1000.0f; //_0 ( е)
-	float stiffness = 2000.0f; //  (̻ü  )
-	float viscocityFactor = 0.1f; //  ( )
-	float surfaceTension = 0.0f; //  (ǥ )
+	float density_zero = 1000.0f; //ρ_0 (기준 밀도)
+	float stiffness = 2000.0f; // κ (이상기체 방정식 참고)
+	float viscocityFactor = 0.1f; // μ (점성힘 계수)
+	float surfaceTension = 0.0f; // σ (표면장력힘 계수)
 	float smoothingLength = 0.045f; // h
 	XMFLOAT3 gravity = { 0.0f, -9.8f, 0.0f };
 	float defaultMass = 0.02f; 
 	float boundaryDamping = 0.5f;
+	float boundaryRadius = 0.0f; // SDF 경계 표면과 입자 중심 최소 거리, 0 이하면 0.5 * h
+	float boundaryFriction = 0.0f; // SDF 경계 충돌 시 접선 속도 감쇠 (0..1)
 	float timeStepLimit = 0.005f;
+	float neighborSkinFactor = 0.2f; // Verlet 이웃 목록 여유 반경 = factor * h (0 이면 매 Step 재구성)
+	FluidSolver solver = FluidSolver::EquationOfState;
+	float incompressibleTimeStepLimit = 0.005f; // PCISPH 일 때 dt 상한 (보통은 힘 CFL 이 먼저 걸림)
+	float maxDensityError = 0.01f; // PCISPH 수렴 조건 : 최대 (rho* - rho_0) / rho_0
+	float pressureRelaxation = 0.75f; // PCISPH 압력 보정 (delta) 이완 계수 (0..1]
+	int minPressureIterations = 3;
+	int maxPressureIterations = 20;
+	// Advance : 프레임 시간을 CFL 로 정한 substep 으로 나눠 진행
+	float cflNumber = 0.4f; // dt <= cfl * h / (최대 속력 + 음속), 음속 = sqrt(stiffness) (EquationOfState 만)
+	float forceCflNumber = 0.25f; // dt <= f * sqrt(h / 최대 가속도)
+	float incompressibleForceCflNumber = 0.4f; // PCISPH 일 때 forceCflNumber 대신 사용 (압력 반복이 큰 dt 를 받쳐 줌)
+	float minTimeStep = 1e-5f;
+	int maxSubsteps = 32;
+	float frameBudgetMs = 0.0f; // Advance 한 번의 계산 시간 예산, 0 이하면 maxSubsteps 만 제한
 	bool enableSurfaceTension = false;
-	//float restitution = 0.3f;   // (ݻ ) 0..1,  
-	//float friction = 0.85f;  //  ()     0..1
-	//float penEps = 1e-4f;  //   оִ  
-	//float velEps = 1e-3f;  // ʹ    Ӱ谪
+	// 잠자기 : 셀 안 깨어 있는 입자가 모두 속력 < sleepVelocity, 압축 오차 < sleepDensityError 인 Step 이
+	// sleepSteps 번 이어지면 셀을 재운다 (그 셀 입자는 밀도/힘/적분/경계를 건너뜀)
+	bool enableSleeping = false;
+	float sleepVelocity = 0.1f;
+	float sleepDensityError = 0.02f; // max(rho - rho_0, 0) / rho_0
+	int sleepSteps = 30;
+	//float restitution = 0.3f;   // 복원계수(반사 강도) 0..1, 물은 낮게
+	//float friction = 0.85f;  // 접선 감쇠(마찰)     0..1
+	//float penEps = 1e-4f;  // 경계 안쪽으로 밀어넣는 보정 오프셋
+	//float velEps = 1e-3f;  // 너무 작은 진동 제거 임계값
+};
+
+// 입자 SoA 저장소. Step 내부 연산은 이 배열만 읽고 쓴다 (이웃 묶음은 AVX2 gather, 입자 단위 루프는 연속 접근)
+struct FluidParticleArrays
+{
+	std::vector<float> x, y, z;
+	std::vector<float> vx, vy, vz;
+	std::vector<float> fx, fy, fz;
+	std::vector<float> mass, density, pressure;
+
+	size_t size() const { return x.size(); }
+	void resize(size_t n);
+	void clear() { resize(0); }
+};
+
+// Step 마지막 상태 요약. 고정 크기 입자 블록별 부분값을 블록 순서대로 합치므로 스레드 수/스케줄과 무관하게 같은 값
+struct FluidStepStats
+{
+	uint32_t particleCount = 0;
+	float maxSpeed = 0.0f;
+	float averageDensity = 0.0f;
+	bool neighborListsRebuilt = false;	// 이번 Step에서 이웃 목록을 다시 만들었는지
+	uint32_t boundaryCandidates = 0;	// SDF 경계 근처 셀이라 필드를 샘플한 입자 수
+	uint32_t boundaryContacts = 0;		// 그중 표면 안쪽으로 들어가 밀어낸 입자 수
+	uint32_t pressureIterations = 0;	// PCISPH 예측-보정 반복 횟수
+	float densityError = 0.0f;			// PCISPH 마지막 반복의 최대 상대 밀도 오차
+	float maxAcceleration = 0.0f;		// 적분에 쓴 최대 가속도 (경계 처리 전)
+	float timeStep = 0.0f;				// 실제로 쓴 dt
+	uint32_t activeParticles = 0;		// 이번 Step 에서 계산한 (깨어 있는) 입자 수
+	uint32_t sleepingCells = 0;			// Step 이 끝난 뒤 잠든 셀 수 (입자가 있는 셀만)
+};
+
+// Advance 한 번 (프레임) 요약
+struct FluidFrameStats
+{
+	uint32_t substeps = 0;
+	float simulatedTime = 0.0f;
+	float droppedTime = 0.0f;		// 예산/maxSubsteps 로 진행하지 못하고 버린 시간 (> 0 이면 시뮬레이션이 실시간보다 느림)
+	float lastTimeStep = 0.0f;
+	double computeMs = 0.0;
+	bool budgetLimited = false;		// frameBudgetMs 때문에 멈춤
 };
 
+// 이웃 목록 요약 (GetNeighborStats 호출 시 계산)
+struct FluidNeighborStats
+{
+	uint64_t listEntries = 0;		// Verlet 목록 (h + skin) 항목 수
+	uint64_t activeEntries = 0;		// r < h 이웃 수 (잠든 입자는 마지막으로 구한 값)
+	uint32_t maxActive = 0;			// 입자별 최대 r < h 이웃 수
+};
+
+/*
+* SPH 유체 (Muller et al. 2003, 주석의 "논문 식" 번호 기준)
+* - Step의 각 단계(격자 삽입, 밀도/압력, 힘, 적분, 경계)는 입자 구간 단위로 공용 ThreadPool에 분배
+*   (kParticleGrain 단위로 먼저 끝난 스레드가 다음 구간을 가져감)
+* - 밀도/힘은 입자 i가 이웃을 읽어 자기 값만 쓰는 gather 방식이라 쓰기 충돌이 없고,
+*   셀 안 입자 순서는 안정 정렬로 고정되어 합산 순서(결과)가 스레드 수와 무관
+* - 이웃 격자 : 입자를 셀 인덱스로 카운팅 정렬해 SoA 자체를 셀 순서로 재배치 (m_cellStart[c] ~ m_cellStart[c + 1])
+*   셀 인덱스는 x 가 가장 빠르므로 3x3x3 이웃은 (dy, dz) 별 연속 구간 9개로 읽는다. 격자/scratch 는 h 가 바뀔 때만 재할당
+* - Verlet 이웃 목록 : 셀 크기 = h + skin, 반경 h + skin 안 이웃을 CSR (m_neighborOffsets / m_neighborIndices) 로 저장
+*   재구성 시점 이후 어떤 입자든 skin / 2 이상 움직였거나 입자 집합이 바뀌었을 때만 정렬 + 목록을 다시 만든다
+*   (이동량 최대값은 경계 처리 패스에서 같이 구함). 그 외 Step은 이웃 탐색 없이 목록만 읽는다
+* - 입자 상태는 SoA(FluidParticleArrays). 밀도/힘의 이웃 루프는 목록을 8개씩 gather해 AVX2 커널로 계산
+*   밀도 패스가 r < h 이웃을 같은 CSR 자리에 압축해 두면 힘 패스는 skin 분량 없이 그것만 읽는다
+* - GetParticles() 는 AoS 어댑터 : 호출 시 SoA -> Particle 배열로 복사해 내주고, 다음 Step/AddParticle 전에
+*   그 배열의 수정 사항(pos, vel, mass)을 SoA로 되돌린다. color/normal은 AoS 쪽에만 있다
+*   되돌릴 때 SoA 값과 비교해 위치가 바뀐 경우만 이웃 목록을 다시 만들고, pos/vel/mass 중 하나라도 바뀐 경우만 잠든 셀을 깨운다.
+*   읽기만 할 때는 GetParticleArrays() (SoA, 복사 없음) 나 GetParticlesReadOnly() (AoS 사본, 되돌리지 않음) 를 쓴다
+* - 입자 인덱스는 이웃 목록을 다시 만드는 Step 마다 셀 순서로 바뀐다 (AoS 어댑터의 color/normal 도 같이 재배치)
+* - 압력 : FluidParams::solver. EquationOfState 는 밀도 패스에서 바로 압력, PCISPH 는 압력 외 힘을 구한 뒤
+*   (속도, 위치 예측 -> 예측 밀도 -> 압력 += delta * 오차 -> 압력 가속도) 를 오차가 maxDensityError 이하가 될 때까지 반복
+*   예측 밀도는 Verlet 목록 (h + skin) 을 예측 위치로 다시 걸러 계산, 압력 가속도는 현재 위치의 r < h 이웃
+*   delta 는 이웃이 꽉 찬 기준 입자 (간격 (m / rho_0)^(1/3) 격자) 의 Poly6/Spiky 기울기로 h 가 바뀔 때 구해 두고 dt^2 로 나눈다
+* - Advance(frameTime) : 직전 Step 의 최대 속력/가속도로 CFL dt 를 구해 frameTime 을 고르게 나눈 substep 으로 진행
+*   substep 비용 (지수 평균) 으로 frameBudgetMs 를 넘기 전에 멈추고 남은 시간은 버린다 (최소 1 substep).
+*   장면이 느리면 dt 가 커져 substep 이 줄고, 예산이 모자라면 시뮬레이션 속도가 느려지는 쪽으로 저하
+* - 잠자기 (enableSleeping) : 셀별로 조용한 Step 수를 세어 sleepSteps 이상이면 잠든 셀 (빈 셀은 0 이라 잠들지 않음). 잠든 셀의 입자는 움직이지 않고
+*   힘/적분/경계에서 빠진다. 깨어 있는 입자 옆의 잠든 입자는 밀도/압력만 계속 구해 (정적 경계처럼) 이웃이 지난 압력을 읽지 않게 하고,
+*   나머지는 마지막 값을 둔 채 밀도 계산에서도 빠진다. 잠든 셀에 들어온 입자도 sleepVelocity 보다 빠르면 계산한다.
+*   임계값을 넘은 입자가 있는 셀은 다시 세고, 임계값 2배를 넘은 입자가 있으면 그 26 이웃도 다음 Step 에 깨어난다 (CFL 상 한 Step 이동은 셀 하나 미만, 두 임계값 사이는 떨림으로 보고 무시)
+*   지형 편집 영역 (InvalidateBoundaryCache) 과 입자 추가/삭제/AoS 수정도 셀을 깨운다
+* - 경계 : 도메인 AABB + (SetBoundaryVolume 시) 지형 SdfField. 입자 좌표는 필드 로컬 공간과 같다고 본다
+*   셀별 경계 캐시 : 셀을 경계 반경만큼 넓힌 상자를 덮는 필드 샘플이 모두 iso 미만이면 "먼 셀" (trilinear 값은 코너 범위 안)
+*   + 셀 중심의 외부 방향 (gradient 가 0 인 포화 영역의 대체 방향). 지형을 편집하면 InvalidateBoundaryCache(편집 범위)
+*   경계 패스는 블록마다 가까운 셀의 입자만 모아 한 번에 값/gradient 를 샘플하고, 관통했으면 밖으로 밀고 법선 속도를 반사
+*/
 class FluidSystem
 {
 public:
 	FluidSystem(const XMFLOAT3& min, const XMFLOAT3& max, const FluidParams& params = FluidParams());
 	void AddParticle(const XMFLOAT3& pos, const XMVECTOR& vel = { 0.0f,0.0f,0.0f }, float mass = -1.0f);
-	void Step(float dt);
+	void Step(float dt);	// dt 한 번 (solver 별 dt 상한으로 클램프)
+	const FluidFrameStats& Advance(float frameTime);
+	float ComputeStableTimeStep() const;	// 직전 Step 상태 기준 CFL dt
 	void SetSmoothingLength(float h);
 	void ClearParticles();
+	// 지형 필드를 경계로 사용 (nullptr 면 AABB 만). 필드는 다음 Step 들에서 계속 읽으므로 살아 있어야 한다
+	void SetBoundaryVolume(const SdfCollision::Volume* volume);
+	// 경계 필드를 편집한 뒤 호출 : 바뀐 샘플 범위 (양 끝 포함, notifyFieldEdited 와 같은 범위) 가 닿는 셀만 다시 계산
+	void InvalidateBoundaryCache(const XMINT3& sampleMin, const XMINT3& sampleMax);
+	void InvalidateBoundaryCache();	// 전체
+	void WakeAll() { m_wakeAll = true; }	// 외부에서 입자 상태를 바꿨을 때 (잠든 셀을 모두 깨움)
 
-	std::vector<Particle>& GetParticles() { return m_particles; }
+	std::vector<Particle>& GetParticles();	// 수정 가능한 AoS 사본. Step 이후 다시 호출해야 최신 상태
+	const std::vector<Particle>& GetParticlesReadOnly();	// 읽기 전용 AoS 사본 (SoA로 되돌리지 않으므로 이웃 목록/잠자기 유지)
+	const FluidParticleArrays& GetParticleArrays() const { return m_store; }	// 읽기 전용 SoA 뷰
+	const FluidStepStats& GetStepStats() const { return m_stepStats; }
+	const FluidFrameStats& GetFrameStats() const { return m_frameStats; }
+	FluidNeighborStats GetNeighborStats() const;
+	size_t GetMemoryBytes() const;	// 입자/격자/이웃 목록/Step 임시 배열이 잡은 용량 (capacity 기준)
 
 private:
+	struct NeighborRange
+	{
+		uint32_t begin, end;	// 셀 정렬된 입자 인덱스 구간
+	};
+
 	void BuildGrid();
-	void ClearGridBuckets();
-	void InsertParticlesToGrid();
+	void SortParticlesByCell();
+	void UpdateNeighborLists();
+	void BuildNeighborLists();
+	int CollectNeighbors(int pi, float radius2, std::vector<int>& buffer, size_t offset) const;	// 반환 : 이웃 수
 	void ComputePressure();
 	void ComputeForces();
+	void SolvePressurePCISPH(float dt);
+	void ComputePCISPHDelta();
 	void Integrate(float dt);
 	void ApplyBoundaryConditions();
-	void GetNeighbors(int pi, std::vector<int>& outNeighbors) const;
+	void BuildBoundaryCache();
+	void ReduceStepStats();
+	void UpdateParticleActivity();
+	void UpdateSleepState();
+	bool IsParticleActive(size_t i) const { return !m_sleeping || m_particleState[i] == kParticleActive; }
+	bool NeedsPressure(size_t i) const { return !m_sleeping || m_particleState[i] != kParticleAsleep; }
+	void CopyToParticleView();
+	void SyncFromParticleView();
+	int GetNeighborRanges(int pi, NeighborRange (&outRanges)[9]) const;	// 반환 : 구간 수
 
 	inline int CellIndexFromCoord(int ix, int iy, int iz) const {
 		if (ix < 0 || iy < 0 || iz < 0) return -1;
@@ -61,10 +207,10 @@ private:
 		return ix + iy * m_gridDim[0] + iz * m_gridDim[0] * m_gridDim[1];
 	}
 
-	inline void PositionToCell(const XMFLOAT3& p, int& ix, int& iy, int& iz) const {
-		ix = int((p.x - m_domainMin.x) / m_cellSize);
-		iy = int((p.y - m_domainMin.y) / m_cellSize);
-		iz = int((p.z - m_domainMin.z) / m_cellSize);
+	inline void PositionToCell(float x, float y, float z, int& ix, int& iy, int& iz) const {
+		ix = int((x - m_domainMin.x) / m_cellSize);
+		iy = int((y - m_domainMin.y) / m_cellSize);
+		iz = int((z - m_domainMin.z) / m_cellSize);
 	}
 
 	// -------------------- Kernels (3D) --------------------
@@ -74,13 +220,11 @@ private:
 		float t = (m_h2 - r2);
 		return m_poly6Coeff * t * t * t;
 	}
-	inline XMVECTOR Kernel_Spiky_Grad(const XMVECTOR& rij) const 
+	// 기울기 = rij * Kernel_Spiky_Grad(r) (r = |rij|, 방향 정규화를 계수에 포함)
+	inline float Kernel_Spiky_Grad(float r) const 
 	{
-		float r = XMVectorGetX(XMVector3Length(rij));
-		if (r <= 1e-7f || r >= m_h) return XMVECTOR{ 0, 0, 0 };
-		float coef = -m_spikyCoeff * (m_h - r) * (m_h - r);
-		XMVECTOR dir = XMVector3Normalize(rij);
-		return dir * coef;
+		if (r <= 1e-7f || r >= m_h) return 0.0f;
+		return -m_spikyCoeff * (m_h - r) * (m_h - r) / r;
 	}
 
 	inline float Kernel_Visc_Laplacian(float r) const {
@@ -89,7 +233,7 @@ private:
 	}
 
 private:
-	// Spatial Hash (TerrainSystem GridDesc  .
+	// Spatial Hash (TerrainSystem에서 GridDesc와 역할이 동일.
 	XMFLOAT3 m_domainMin, m_domainMax;
 	std::array<int,3> m_gridDim{ 0,0,0 };
 	size_t m_numCells = 0;
@@ -97,10 +241,62 @@ private:
 
 	float m_h = 0.045f;
 	float m_h2 = 0.045f * 0.045f;
-	std::vector<std::vector<int>> m_buckets; // per-cell list of particle indices
+	std::vector<uint32_t> m_cellStart; // 셀 c 입자 = [m_cellStart[c], m_cellStart[c + 1]), 마지막 셀(m_numCells)은 도메인 밖 입자
+	std::vector<uint32_t> m_particleCell; // 정렬 전 입자별 셀 인덱스
+	std::vector<uint32_t> m_sortCursor; // 카운팅 정렬 셀별 쓰기 위치
+	std::vector<uint32_t> m_sortOrder; // 정렬 후 k 번째 = 정렬 전 입자 인덱스
+
+	// Verlet 이웃 목록 (CSR)
+	float m_skin = 0.0f;
+	std::vector<uint32_t> m_neighborOffsets; // 입자 수 + 1
+	std::vector<int> m_neighborIndices;
+	std::vector<std::vector<int>> m_blockNeighbors; // 재구성 시 kParticleGrain 블록별 이웃 (이어 붙이기 전)
+	std::vector<int> m_activeNeighborIndices; // 이번 Step r < h 이웃 (m_neighborOffsets 오프셋, 앞쪽 m_activeNeighborCounts[i] 개)
+	std::vector<uint32_t> m_activeNeighborCounts;
+	std::vector<float> m_listX, m_listY, m_listZ; // 목록을 만든 시점 위치
+	float m_maxDisplacement2 = 0.0f; // 그 이후 최대 이동량^2 (직전 Step 기준)
+	bool m_neighborListsDirty = true;
+
+	// SDF 경계 (셀별 캐시는 이웃 격자와 같은 셀)
+	SdfCollision::Volume m_boundaryVolume;
+	bool m_hasBoundaryVolume = false;
+	bool m_boundaryCacheDirty = true;
+	XMINT3 m_boundaryDirtyMin{}, m_boundaryDirtyMax{}; // 다시 계산할 필드 샘플 범위 (캐시가 비어 있으면 전체)
+	float m_boundaryRadius = 0.0f;
+	std::vector<uint8_t> m_boundaryCellNear; // 1 : 셀 안 입자가 경계 반경 안에 표면을 둘 수 있음
+	std::vector<XMFLOAT3> m_boundaryCellNormal; // 셀 중심 외부 방향
+
+	// PCISPH (Step 안에서만 쓰는 입자별 임시값)
+	float m_pcisphDeltaDt2 = 0.0f; // delta * dt^2
+	std::vector<float> m_predX, m_predY, m_predZ; // 예측 위치
+	std::vector<float> m_pressureAx, m_pressureAy, m_pressureAz; // 압력 가속도
+	std::vector<float> m_blockDensityError; // kParticleGrain 블록별 최대 밀도 오차
+
+	// 잠자기 (셀은 이웃 격자와 같은 셀)
+	std::vector<uint16_t> m_cellQuietSteps; // 연속으로 조용했던 Step 수, sleepSteps 이상이면 잠든 셀
+	std::vector<uint32_t> m_cellWakeStamp; // 이번 Step 에 이미 주변을 깨운 셀 (m_sleepStamp 와 같으면)
+	uint32_t m_sleepStamp = 0;
+	// 입자 상태 (m_sleeping 일 때만 유효). 경계 입자 : 잠들어 움직이지 않지만 깨어 있는 이웃이 읽는 밀도/압력은 매 Step 갱신
+	static constexpr uint8_t kParticleAsleep = 0;
+	static constexpr uint8_t kParticleActive = 1;
+	static constexpr uint8_t kParticleBorder = 2;
+	std::vector<uint8_t> m_particleState;
+	std::vector<uint8_t> m_cellHasActive; // 깨어 있는 입자가 있는 셀 (경계 입자 판정용)
+	std::vector<uint8_t> m_cellOccupancy; // Step 끝 위치 기준 셀의 입자 (kCellEmpty / kCellAsleep / kCellActive)
+	static constexpr uint8_t kCellEmpty = 0;
+	static constexpr uint8_t kCellAsleep = 1;
+	static constexpr uint8_t kCellActive = 2;
+	std::vector<uint32_t> m_particleDisturbedCell; // 경계 패스 기록 : 임계값을 넘은 깨어 있는 입자의 셀 (+ 이웃 깨움 비트, 아니면 UINT32_MAX)
+	uint32_t m_sleepingCells = 0; // 직전 Step 이 끝난 뒤 잠든 셀 수 (입자가 있는 셀만)
+	bool m_sleeping = false; // 이번 Step 에 잠든 셀이 있음 (없으면 입자별 검사를 건너뜀)
+	bool m_wakeAll = true;
 
 	// Particles
-	std::vector<Particle> m_particles;
+	FluidParticleArrays m_store;
+	std::vector<Particle> m_particles;	// GetParticles() 어댑터 (AoS 사본 + color/normal)
+	bool m_particleViewOut = false;		// GetParticles() 로 내준 뒤 아직 SoA로 되돌리지 않음
+	FluidParticleArrays m_sortScratch;	// 셀 순서 재배치 대상 (swap 으로 교대)
+	std::vector<Particle> m_particleScratch;
 
 	// Kernel Constants
 	float m_poly6Coeff = 0.0f;
@@ -110,6 +306,23 @@ private:
 	// Params
 	FluidParams m_params;
 
+	// 병렬 Step
+	struct StepBlockStats
+	{
+		float maxSpeed = 0.0f;
+		double densitySum = 0.0;
+		float maxDisplacement2 = 0.0f;
+		float maxAcceleration2 = 0.0f;
+		uint32_t boundaryCandidates = 0;
+		uint32_t boundaryContacts = 0;
+	};
+	std::vector<StepBlockStats> m_blockStats; // kParticleGrain 블록별 부분값
+	FluidStepStats m_stepStats;
+
+	// Advance
+	FluidFrameStats m_frameStats;
+	double m_stepCostMs = 0.0; // substep 비용 지수 평균
+
 
 };
 
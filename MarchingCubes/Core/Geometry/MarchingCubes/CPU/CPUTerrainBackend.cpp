@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "CPUTerrainBackend.h"
 #include "Core/Math/PhysicsHelper.h"
+#include "Core/Geometry/MarchingCubes/SdfRedistance.h"
 #include <algorithm>
 #include <cmath>
 
@@ -12,11 +13,78 @@ CPUTerrainBackend::CPUTerrainBackend(ID3D12Device* device, const GridDesc& desc)
 void CPUTerrainBackend::setGridDesc(const GridDesc& desc)
 {
 	m_gridDesc = desc;
+	m_meshCache.clear();
+	m_spanIndex.clear();
 }
 
 void CPUTerrainBackend::setFieldPtr(std::shared_ptr<SdfField<float>> grid)
 {
 	m_grd = std::move(grid);
+	m_meshCache.clear();
+	m_spanIndex.clear();
+	m_strokeActive = false;
+	m_redistancePending = false;
+
+	m_mips.clear();
+	if (m_mipEnabled && m_grd) m_mips.build(*m_grd);
+}
+
+void CPUTerrainBackend::setMipPyramid(bool enable)
+{
+	m_mipEnabled = enable;
+	if (!m_mipEnabled)
+		m_mips.clear();
+	else if (!m_mips.valid() && m_grd)
+		m_mips.build(*m_grd);
+}
+
+void CPUTerrainBackend::markFieldDirty(const XMINT3& sampleMin, const XMINT3& sampleMax)
+{
+	m_spanIndex.markDirtySamples(sampleMin, sampleMax);
+	if (m_mips.valid()) m_mips.update(*m_grd, sampleMin, sampleMax);
+}
+
+void CPUTerrainBackend::setIsoScrub(bool enable)
+{
+	m_isoScrub = enable;
+	if (!m_isoScrub) m_spanIndex.clear();
+}
+
+void CPUTerrainBackend::prepareSpanIndex()
+{
+	if (!m_grd) return;
+
+	if (!m_spanIndex.valid())
+		m_spanIndex.build(*m_grd);
+	else if (m_spanIndex.hasDirty())
+		m_spanIndex.refresh(*m_grd);
+}
+
+void CPUTerrainBackend::storeChunkPatch(const ChunkKey& key, GeometryData&& md, const std::vector<GeometryRange>& ranges)
+{
+	// 전체 메쉬는 대기 중인 것을 그대로 대체
+	auto it = m_chunkData.find(key);
+	if (ranges.empty() || it == m_chunkData.end())
+	{
+		m_chunkData[key] = std::move(md);
+		if (ranges.empty()) m_chunkRanges.erase(key);
+		else m_chunkRanges[key] = ranges;
+		return;
+	}
+
+	// 대기 중인 전체 메쉬 위에는 patch를 덮어써 전체 업로드로 유지
+	GeometryData& pendingData = it->second;
+	auto rangeIt = m_chunkRanges.find(key);
+	if (rangeIt == m_chunkRanges.end())
+	{
+		ApplyGeometryPatch(pendingData, md, ranges);
+		return;
+	}
+
+	// 대기 중인 patch 뒤에 이어 붙인다 (같은 구간은 나중 것이 덮어씀)
+	pendingData.vertices.insert(pendingData.vertices.end(), md.vertices.begin(), md.vertices.end());
+	pendingData.indices.insert(pendingData.indices.end(), md.indices.begin(), md.indices.end());
+	rangeIt->second.insert(rangeIt->second.end(), ranges.begin(), ranges.end());
 }
 
 void CPUTerrainBackend::requestBrush(uint32_t frameIndex, const BrushRequest& r)
@@ -39,7 +107,7 @@ void CPUTerrainBackend::requestBrush(uint32_t frameIndex, const BrushRequest& r)
 
     const float kBase = std::clamp(m_brushDelta * deltaTime * std::abs(weight), 0.0f, 1.0f);
 
-    //   (Field ε  ȯ)
+    // 영향 범위 (Field 인덱스 공간으로 변환)
     auto sample = [cellsize](float p, float o) { return (p - o) / cellsize; };
     int minX = std::max(0, int(std::floor(sample(hitPos.x - radius, origin.x))));
     int maxX = std::min(SX - 1, int(std::ceil(sample(hitPos.x + radius, origin.x))));
@@ -58,44 +126,181 @@ void CPUTerrainBackend::requestBrush(uint32_t frameIndex, const BrushRequest& r)
             const float py = origin.y + y * cellsize;
             const float dy = py - hitPos.y;
 
+            auto row = m_grd->row(y, z);
             for (int x = minX; x <= maxX; ++x)
             {
                 const float px = origin.x + x * cellsize;
                 const float dx = px - hitPos.x;
 
                 const float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
-                if (dist > radius) continue; // ݰ   ( ŵ)
+                if (dist > radius) continue; // 반경 밖은 영향 없음(빠른 스킵)
 
-                // Brush ߽ɰ Ÿ  ġ ο
+                // Brush 중심과의 거리에 따라 가중치 부여
                 const float sphere = radius - dist;
 
-                float& F = m_grd->at(x, y, z);
+                float& F = row[x];
                 float desired = (weight < 0) ? std::min(F, -sphere) : std::max(F, sphere);
                 const float falloff = std::clamp(sphere / radius, 0.0f, 1.0f);
                 const float k = kBase * falloff;
 
                 F = F + (desired - F) * k;
-
-                remeshRequest.chunkset.insert(ChunkKey{ x / m_gridDesc.chunkSize, y / m_gridDesc.chunkSize,  z / m_gridDesc.chunkSize });
             }
         }
     }
 
+    collectChunks({ minX, minY, minZ }, { maxX, maxY, maxZ }, remeshRequest.chunkset);
+
+    markFieldDirty({ minX, minY, minZ }, { maxX, maxY, maxZ });
+
+    remeshRequest.hasDirtyRegion = (minX <= maxX && minY <= maxY && minZ <= maxZ);
+    remeshRequest.dirtyMin = { minX, minY, minZ };
+    remeshRequest.dirtyMax = { maxX, maxY, maxZ };
+
+    // 스트로크 범위 누적
+    if (remeshRequest.hasDirtyRegion)
+    {
+        if (!m_strokeActive)
+        {
+            m_strokeMin = remeshRequest.dirtyMin;
+            m_strokeMax = remeshRequest.dirtyMax;
+            m_strokeActive = true;
+        }
+        else
+        {
+            m_strokeMin = { std::min(m_strokeMin.x, minX), std::min(m_strokeMin.y, minY), std::min(m_strokeMin.z, minZ) };
+            m_strokeMax = { std::max(m_strokeMax.x, maxX), std::max(m_strokeMax.y, maxY), std::max(m_strokeMax.z, maxZ) };
+        }
+    }
+
     requestRemesh(frameIndex, remeshRequest);
 }
 
+void CPUTerrainBackend::collectChunks(const XMINT3& sampleMin, const XMINT3& sampleMax, std::set<ChunkKey>& outChunks) const
+{
+	// 샘플 s는 셀 s-1, s 의 코너이므로 셀 범위 [min-1, max] 를 덮는 청크 전체
+	// (복셀마다 chunkset에 삽입하던 방식 대신 범위로 한 번에 계산, 청크 경계 샘플의 이웃 청크도 포함)
+	const int chunkSize = static_cast<int>(m_gridDesc.chunkSize);
+	if (chunkSize <= 0) return;
+	const int chunkCount[3] = { int(m_gridDesc.cells.x) / chunkSize, int(m_gridDesc.cells.y) / chunkSize, int(m_gridDesc.cells.z) / chunkSize };
+	if (chunkCount[0] <= 0 || chunkCount[1] <= 0 || chunkCount[2] <= 0) return;
+	if (sampleMin.x > sampleMax.x || sampleMin.y > sampleMax.y || sampleMin.z > sampleMax.z) return;
+
+	auto chunkRange = [chunkSize](int sMin, int sMax, int count, int& outLo, int& outHi) {
+		outLo = std::clamp((sMin - 1) / chunkSize, 0, count - 1);
+		outHi = std::clamp(sMax / chunkSize, 0, count - 1);
+	};
+	int cx0, cx1, cy0, cy1, cz0, cz1;
+	chunkRange(sampleMin.x, sampleMax.x, chunkCount[0], cx0, cx1);
+	chunkRange(sampleMin.y, sampleMax.y, chunkCount[1], cy0, cy1);
+	chunkRange(sampleMin.z, sampleMax.z, chunkCount[2], cz0, cz1);
+	for (int cz = cz0; cz <= cz1; ++cz)
+		for (int cy = cy0; cy <= cy1; ++cy)
+			for (int cx = cx0; cx <= cx1; ++cx)
+				outChunks.insert(ChunkKey{ uint32_t(cx), uint32_t(cy), uint32_t(cz) });
+}
+
+void CPUTerrainBackend::endStroke(uint32_t frameIndex, float isoValue)
+{
+	if (!m_strokeActive || !m_grd) return;
+	m_strokeActive = false;
+
+	// 표면이 움직인 만큼 band 안쪽 샘플의 최근접 거리도 바뀌므로 band만큼 넓혀서 다시 쓴다
+	const int band = static_cast<int>(std::ceil(m_redistanceBandCells));
+	XMINT3 writeMin = { std::max(m_strokeMin.x - band, 0), std::max(m_strokeMin.y - band, 0), std::max(m_strokeMin.z - band, 0) };
+	XMINT3 writeMax = {
+		std::min(m_strokeMax.x + band, m_grd->sx() - 1),
+		std::min(m_strokeMax.y + band, m_grd->sy() - 1),
+		std::min(m_strokeMax.z + band, m_grd->sz() - 1)
+	};
+
+	// 이전 스트로크의 재거리화가 아직 남아 있으면 합친 범위를 처음부터 다시 진행 (값 스케일은 유지)
+	if (m_redistancePending)
+	{
+		writeMin = { std::min(writeMin.x, m_redistanceMin.x), std::min(writeMin.y, m_redistanceMin.y), std::min(writeMin.z, m_redistanceMin.z) };
+		writeMax = { std::max(writeMax.x, m_redistanceMax.x), std::max(writeMax.y, m_redistanceMax.y), std::max(writeMax.z, m_redistanceMax.z) };
+	}
+	else
+	{
+		m_redistanceValueScale = 0.0f;
+	}
+
+	m_redistancePending = true;
+	m_redistanceMin = writeMin;
+	m_redistanceMax = writeMax;
+	m_redistanceNextZ = writeMin.z;
+	m_redistanceIso = isoValue;
+	m_redistanceFrameIndex = frameIndex;
+}
+
+void CPUTerrainBackend::advanceRedistance()
+{
+	if (!m_redistancePending || !m_grd) return;
+
+	// 슬랩 하나마다 Redistance 가 위아래 band + 1 샘플을 더 읽으므로, 슬랩이 너무 얇으면 그 여분이 예산을 잡아먹는다
+	const int band = static_cast<int>(std::ceil(m_redistanceBandCells));
+	const size_t sliceSamples = static_cast<size_t>(m_redistanceMax.x - m_redistanceMin.x + 1) * static_cast<size_t>(m_redistanceMax.y - m_redistanceMin.y + 1);
+	const int depth = std::max(static_cast<int>(m_redistanceSamplesPerFrame / std::max<size_t>(sliceSamples, 1)), 2 * (band + 1));
+
+	const XMINT3 slabMin = { m_redistanceMin.x, m_redistanceMin.y, m_redistanceNextZ };
+	const XMINT3 slabMax = { m_redistanceMax.x, m_redistanceMax.y, std::min(m_redistanceNextZ + depth - 1, m_redistanceMax.z) };
+	m_redistanceNextZ = slabMax.z + 1;
+	if (m_redistanceNextZ > m_redistanceMax.z) m_redistancePending = false;
+
+	const SdfRedistance::Desc desc{
+		.isoValue = m_redistanceIso,
+		.cellsize = m_gridDesc.cellsize,
+		.bandCells = m_redistanceBandCells,
+		.valueScale = m_redistanceValueScale
+	};
+	SdfRedistance::Stats stats;
+	if (!SdfRedistance::Redistance(*m_grd, slabMin, slabMax, desc, &stats)) return;
+	m_redistanceValueScale = stats.valueScale;
+
+	RemeshRequest remeshRequest;
+	remeshRequest.isoValue = m_redistanceIso;
+	remeshRequest.hasDirtyRegion = true;
+	remeshRequest.dirtyMin = slabMin;
+	remeshRequest.dirtyMax = slabMax;
+	collectChunks(slabMin, slabMax, remeshRequest.chunkset);
+	markFieldDirty(slabMin, slabMax);
+
+	requestRemesh(m_redistanceFrameIndex, remeshRequest);
+}
+
+void CPUTerrainBackend::notifyFieldEdited(uint32_t frameIndex, const XMINT3& sampleMin, const XMINT3& sampleMax, float isoValue)
+{
+	if (!m_grd) return;
+	const XMINT3 editMin = { std::max(sampleMin.x, 0), std::max(sampleMin.y, 0), std::max(sampleMin.z, 0) };
+	const XMINT3 editMax = { std::min(sampleMax.x, m_grd->sx() - 1), std::min(sampleMax.y, m_grd->sy() - 1), std::min(sampleMax.z, m_grd->sz() - 1) };
+	if (editMin.x > editMax.x || editMin.y > editMax.y || editMin.z > editMax.z) return;
+
+	RemeshRequest remeshRequest;
+	remeshRequest.isoValue = isoValue;
+	remeshRequest.hasDirtyRegion = true;
+	remeshRequest.dirtyMin = editMin;
+	remeshRequest.dirtyMax = editMax;
+	collectChunks(editMin, editMax, remeshRequest.chunkset);
+	markFieldDirty(editMin, editMax);
+
+	requestRemesh(frameIndex, remeshRequest);
+}
+
 bool CPUTerrainBackend::tryFetch(std::vector<ChunkUpdate>& OutChunkUpdates)
 {
 	OutChunkUpdates.clear();
+	advanceRedistance();
+
     for (auto& [key, data] : m_chunkData)
     {
         ChunkUpdate up;
-        up.empty = data.indices.empty();
         up.key = key;
         up.md = std::move(data);
-        OutChunkUpdates.push_back(up);
+        if (auto it = m_chunkRanges.find(key); it != m_chunkRanges.end()) up.ranges = std::move(it->second);
+        up.empty = up.ranges.empty() && up.md.indices.empty();
+        OutChunkUpdates.push_back(std::move(up));
     }
     m_chunkData.clear();
+    m_chunkRanges.clear();
 
     return !OutChunkUpdates.empty();
 }
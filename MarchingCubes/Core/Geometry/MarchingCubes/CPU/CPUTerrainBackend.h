@@ -1,5 +1,8 @@
 #pragma once
 #include "Core/Geometry/MarchingCubes/ITerrainBackend.h"
+#include "Core/Geometry/MarchingCubes/CPU/ChunkMeshCache.h"
+#include "Core/Geometry/MarchingCubes/CPU/SpanSpaceIndex.h"
+#include "Core/Geometry/MarchingCubes/SdfMipPyramid.h"
 #include <unordered_map>
 
 class CPUTerrainBackend :   public ITerrainBackend
@@ -7,17 +10,65 @@ class CPUTerrainBackend :   public ITerrainBackend
 public:
 	CPUTerrainBackend(ID3D12Device* device, const GridDesc& desc);
 
-	// ITerrainBackend()  ӵ
+	// ITerrainBackend을(를) 통해 상속됨
 	void setGridDesc(const GridDesc&) override;
 	void setFieldPtr(std::shared_ptr<SdfField<float>> grid) override;
 	void requestBrush(uint32_t frameIndex, const BrushRequest& r) override;
 	bool tryFetch(std::vector<ChunkUpdate>& OutChunkUpdate) override;
+	void setIsoScrub(bool enable) override;
+	bool isFieldCPUResident() const override { return m_grd != nullptr; }
+	void endStroke(uint32_t frameIndex, float isoValue) override;
+	void setMipPyramid(bool enable) override;
+	const SdfMipPyramid* getMipPyramid() const override { return m_mips.valid() ? &m_mips : nullptr; }
+	void notifyFieldEdited(uint32_t frameIndex, const XMINT3& sampleMin, const XMINT3& sampleMax, float isoValue) override;
+
+protected:
+	// Span-Space 인덱스 준비 (최초 1회 빌드, 이후 brush로 무효화된 브릭만 갱신)
+	void prepareSpanIndex();
+
+	// 브릭 갱신 결과 기록. ranges가 있으면 md는 바뀐 구간만 담은 patch. 대기 중인 전체 갱신이 있으면 그 위에 덮어써 전체 업로드를 유지하고, 아니면 patch를 누적
+	void storeChunkPatch(const ChunkKey& key, GeometryData&& md, const std::vector<GeometryRange>& ranges);
+
+	// 샘플 범위 [sampleMin, sampleMax] 가 바뀌었을 때 다시 추출해야 하는 청크
+	void collectChunks(const XMINT3& sampleMin, const XMINT3& sampleMax, std::set<ChunkKey>& outChunks) const;
+
+	// 필드 샘플 범위 [sampleMin, sampleMax] 가 바뀌었음을 파생 구조(Span-Space 인덱스, 밉 피라미드)에 반영
+	void markFieldDirty(const XMINT3& sampleMin, const XMINT3& sampleMax);
+
+	// 대기 중인 재거리화를 프레임 예산(m_redistanceSamplesPerFrame)만큼 z 슬랩 단위로 진행하고 해당 슬랩만 재메싱
+	void advanceRedistance();
 
 protected:
 	GridDesc m_gridDesc{};
 	std::shared_ptr<SdfField<float>> m_grd;
 
 	std::unordered_map<ChunkKey, GeometryData, ChunkKeyHash> m_chunkData;
+	std::unordered_map<ChunkKey, std::vector<GeometryRange>, ChunkKeyHash> m_chunkRanges;	// 부분 갱신 청크의 바뀐 구간 (없으면 전체)
+	ChunkMeshCache m_meshCache;	// 청크별 마지막 추출 입력/결과 (변화 없는 청크 재추출 생략)
 	float m_brushDelta = 0.05f;
+
+	bool m_isoScrub = false;
+	SpanSpaceIndex m_spanIndex;
+
+	// 현재 스트로크가 건드린 샘플 범위 (endStroke에서 재거리화)
+	bool m_strokeActive = false;
+	XMINT3 m_strokeMin{};
+	XMINT3 m_strokeMax{};
+	float m_redistanceBandCells = 6.0f;
+
+	// endStroke 이후 나눠서 처리하는 재거리화 (마우스를 뗀 프레임에 영역 전체를 한 번에 돌리지 않음)
+	// - [m_redistanceMin, m_redistanceMax] 를 z 앞쪽부터 소비, m_redistanceNextZ 가 다음 슬랩 시작
+	// - 값 스케일은 처음 표면을 만난 슬랩에서 추정한 값으로 고정 (슬랩마다 추정하면 경계에 이음새가 생김)
+	bool m_redistancePending = false;
+	XMINT3 m_redistanceMin{};
+	XMINT3 m_redistanceMax{};
+	int m_redistanceNextZ = 0;
+	float m_redistanceIso = 0.0f;
+	float m_redistanceValueScale = 0.0f;
+	uint32_t m_redistanceFrameIndex = 0;
+	size_t m_redistanceSamplesPerFrame = size_t(1) << 18;	// 쓰기 샘플 수 기준 프레임당 예산
+
+	bool m_mipEnabled = false;
+	SdfMipPyramid m_mips;
 };
 
@@ -0,0 +1,237 @@
+#include "pch.h"
+#include "ChunkBrickMesh.h"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	// 퇴출 구간이 이 정점 수 이상이고 살아있는 구간보다 많으면 재배치
+	constexpr uint32_t kCompactMinVertices = 4096;
+	constexpr uint32_t kTailMinVertices = 256;
+	constexpr uint32_t kTailMinIndices = 768;
+}
+
+void ChunkBrickMesh::reset(uint32_t brickCount)
+{
+	m_bricks.assign(brickCount, BrickRange{});
+	m_mesh = GeometryData{};
+	m_vertexTail = 0;
+	m_indexTail = 0;
+	m_deadVertices = 0;
+	m_deadIndices = 0;
+	m_liveIndices = 0;
+	m_dirty.clear();
+	m_fullUpload = true;
+}
+
+// 브릭 구간 용량 : 브러시가 조금씩 키워도 제자리에 들어가도록 25% + 여유
+uint32_t ChunkBrickMesh::vertexCapacityFor(size_t count)
+{
+	if (count == 0) return 0;
+	return static_cast<uint32_t>(count + count / 4 + 8);
+}
+
+uint32_t ChunkBrickMesh::indexCapacityFor(size_t count)
+{
+	if (count == 0) return 0;
+	const size_t c = count + count / 4 + 12;
+	return static_cast<uint32_t>(c - c % 3);
+}
+
+void ChunkBrickMesh::setBrick(uint32_t brick, const GeometryData& local)
+{
+	if (brick >= m_bricks.size()) return;
+
+	BrickRange& r = m_bricks[brick];
+	const uint32_t vertexCount = static_cast<uint32_t>(local.vertices.size());
+	const uint32_t indexCount = static_cast<uint32_t>(local.indices.size());
+
+	// 1. 기존 구간에 들어가면 제자리 덮어쓰기
+	if (vertexCount <= r.vertexCapacity && indexCount <= r.indexCapacity)
+	{
+		writeBrick(r, local.vertices.data(), vertexCount, local.indices.data(), indexCount);
+		return;
+	}
+
+	// 2. 옛 구간 퇴출 : 인덱스를 degenerate로 비워 더 이상 그려지지 않게 한다
+	if (r.indexCount > 0)
+	{
+		std::fill_n(m_mesh.indices.begin() + r.indexOffset, r.indexCount, 0u);
+		if (!m_fullUpload) m_dirty.push_back({ .indexOffset = r.indexOffset, .indexCount = r.indexCount });
+	}
+	m_liveIndices -= r.indexCount;
+	m_deadVertices += r.vertexCapacity;
+	m_deadIndices += r.indexCapacity;
+	r = BrickRange{};
+
+	// 3. 꼬리에 새 구간 (예비 공간이 모자라면 전체 재배치)
+	if (!allocate(r, vertexCount, indexCount))
+	{
+		relayout(vertexCapacityFor(vertexCount), indexCapacityFor(indexCount));
+		allocate(r, vertexCount, indexCount);
+	}
+	writeBrick(r, local.vertices.data(), vertexCount, local.indices.data(), indexCount);
+}
+
+void ChunkBrickMesh::writeBrick(BrickRange& range, const Vertex* vertices, uint32_t vertexCount, const uint32_t* localIndices, uint32_t indexCount)
+{
+	// 실제로 바뀐 [first, last) 만 업로드 구간으로 기록 (브러시 가장자리 브릭은 대부분 그대로다)
+	uint32_t vertexFirst = vertexCount, vertexLast = 0;
+	Vertex* vdst = m_mesh.vertices.data() + range.vertexOffset;
+	for (uint32_t i = 0; i < vertexCount; ++i)
+	{
+		if (i < range.vertexCount && std::memcmp(&vdst[i], &vertices[i], sizeof(Vertex)) == 0) continue;
+		vdst[i] = vertices[i];
+		vertexFirst = std::min(vertexFirst, i);
+		vertexLast = i + 1;
+	}
+
+	// 줄어든 만큼 degenerate로 비움
+	const uint32_t written = std::max(indexCount, range.indexCount);
+	uint32_t indexFirst = written, indexLast = 0;
+	uint32_t* idst = m_mesh.indices.data() + range.indexOffset;
+	for (uint32_t i = 0; i < written; ++i)
+	{
+		const uint32_t value = (i < indexCount) ? localIndices[i] + range.vertexOffset : 0u;
+		if (idst[i] == value) continue;
+		idst[i] = value;
+		indexFirst = std::min(indexFirst, i);
+		indexLast = i + 1;
+	}
+
+	if (!m_fullUpload && (vertexLast > vertexFirst || indexLast > indexFirst))
+	{
+		m_dirty.push_back({
+			.vertexOffset = range.vertexOffset + ((vertexLast > vertexFirst) ? vertexFirst : 0),
+			.vertexCount = (vertexLast > vertexFirst) ? vertexLast - vertexFirst : 0,
+			.indexOffset = range.indexOffset + ((indexLast > indexFirst) ? indexFirst : 0),
+			.indexCount = (indexLast > indexFirst) ? indexLast - indexFirst : 0
+		});
+	}
+
+	m_liveIndices = m_liveIndices - range.indexCount + indexCount;
+	range.vertexCount = vertexCount;
+	range.indexCount = indexCount;
+}
+
+bool ChunkBrickMesh::allocate(BrickRange& range, uint32_t vertexCount, uint32_t indexCount)
+{
+	const uint32_t vertexCapacity = vertexCapacityFor(vertexCount);
+	const uint32_t indexCapacity = indexCapacityFor(indexCount);
+	if (m_vertexTail + vertexCapacity > m_mesh.vertices.size() || m_indexTail + indexCapacity > m_mesh.indices.size())
+		return false;
+
+	range = BrickRange{
+		.vertexOffset = m_vertexTail,
+		.vertexCapacity = vertexCapacity,
+		.indexOffset = m_indexTail,
+		.indexCapacity = indexCapacity
+	};
+	m_vertexTail += vertexCapacity;
+	m_indexTail += indexCapacity;
+	return true;
+}
+
+// 살아있는 브릭만 앞에서부터 다시 채우고, 꼬리에 (요청량 + 전체의 절반) 예비 공간을 둔다
+void ChunkBrickMesh::relayout(uint32_t extraVertices, uint32_t extraIndices)
+{
+	uint32_t vertexTotal = extraVertices;
+	uint32_t indexTotal = extraIndices;
+	for (const BrickRange& r : m_bricks)
+	{
+		vertexTotal += vertexCapacityFor(r.vertexCount);
+		indexTotal += indexCapacityFor(r.indexCount);
+	}
+
+	GeometryData packed;
+	packed.topology = m_mesh.topology;
+	packed.vertices.resize(vertexTotal + std::max(vertexTotal / 2, kTailMinVertices));
+	packed.indices.assign(indexTotal + std::max(indexTotal / 2 / 3 * 3, kTailMinIndices), 0u);
+
+	uint32_t vertexTail = 0;
+	uint32_t indexTail = 0;
+	for (BrickRange& r : m_bricks)
+	{
+		BrickRange moved{
+			.vertexOffset = vertexTail,
+			.vertexCount = r.vertexCount,
+			.vertexCapacity = vertexCapacityFor(r.vertexCount),
+			.indexOffset = indexTail,
+			.indexCount = r.indexCount,
+			.indexCapacity = indexCapacityFor(r.indexCount)
+		};
+
+		std::copy_n(m_mesh.vertices.begin() + r.vertexOffset, r.vertexCount, packed.vertices.begin() + moved.vertexOffset);
+		for (uint32_t i = 0; i < r.indexCount; ++i)
+		{
+			packed.indices[moved.indexOffset + i] = m_mesh.indices[r.indexOffset + i] - r.vertexOffset + moved.vertexOffset;
+		}
+
+		vertexTail += moved.vertexCapacity;
+		indexTail += moved.indexCapacity;
+		r = moved;
+	}
+
+	m_mesh = std::move(packed);
+	m_vertexTail = vertexTail;
+	m_indexTail = indexTail;
+	m_deadVertices = 0;
+	m_deadIndices = 0;
+
+	// 모든 오프셋이 바뀌었으므로 전체 업로드
+	m_dirty.clear();
+	m_fullUpload = true;
+}
+
+bool ChunkBrickMesh::flush(GeometryData& outMesh, std::vector<GeometryRange>& outRanges)
+{
+	outRanges.clear();
+
+	// 빈 청크는 렌더러가 슬롯을 지우므로 다음 갱신은 전체 업로드
+	if (m_liveIndices == 0)
+	{
+		outMesh = GeometryData{};
+		m_dirty.clear();
+		m_fullUpload = true;
+		return true;
+	}
+
+	if (m_deadVertices >= kCompactMinVertices && m_deadVertices > m_vertexTail - m_deadVertices)
+	{
+		relayout(0, 0);
+	}
+
+	// 재추출했지만 결과가 같은 경우
+	if (!m_fullUpload && m_dirty.empty()) return false;
+
+	if (m_fullUpload)
+	{
+		outMesh = m_mesh;
+		m_dirty.clear();
+		m_fullUpload = false;
+		return true;
+	}
+
+	// 부분 갱신은 바뀐 구간만 range 순서대로 이어 붙여 넘긴다 (청크 전체 복사 없음)
+	size_t vertexTotal = 0;
+	size_t indexTotal = 0;
+	for (const GeometryRange& r : m_dirty)
+	{
+		vertexTotal += r.vertexCount;
+		indexTotal += r.indexCount;
+	}
+
+	outMesh.vertices.clear();
+	outMesh.indices.clear();
+	outMesh.vertices.reserve(vertexTotal);
+	outMesh.indices.reserve(indexTotal);
+	for (const GeometryRange& r : m_dirty)
+	{
+		outMesh.vertices.insert(outMesh.vertices.end(), m_mesh.vertices.begin() + r.vertexOffset, m_mesh.vertices.begin() + r.vertexOffset + r.vertexCount);
+		outMesh.indices.insert(outMesh.indices.end(), m_mesh.indices.begin() + r.indexOffset, m_mesh.indices.begin() + r.indexOffset + r.indexCount);
+	}
+	outMesh.topology = m_mesh.topology;
+	outRanges.swap(m_dirty);
+	m_dirty.clear();
+	return true;
+}
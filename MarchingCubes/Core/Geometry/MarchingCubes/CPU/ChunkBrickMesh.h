@@ -0,0 +1,57 @@
+#pragma once
+#include "Core/DataStructures/Data.h"
+#include <vector>
+
+/*
+* 브릭 단위로 배치한 청크 메쉬 (브러시 부분 재추출 + 부분 업로드용)
+* - 청크 VB/IB 안에서 브릭마다 정점/인덱스 구간 [offset, offset + capacity) 을 가진다. 인덱스는 청크 기준 정점 번호.
+* - 브릭 메쉬가 바뀌면 자기 구간에 들어가는 경우 제자리에 덮어쓰고, 넘치면 꼬리 예비 공간에 새 구간을 잡는다 (옛 구간은 퇴출).
+* - 쓰지 않는 인덱스 칸은 (0, 0, 0) degenerate 삼각형으로 채워 청크를 DrawIndexed 한 번으로 그대로 그린다.
+* - 바뀐 구간은 GeometryRange로 모아 UploadContext::UploadGeometryRanges 로 그 부분만 올린다.
+* - 꼬리 예비 공간이 모자라거나 퇴출 구간이 살아있는 구간보다 많아지면 전체 재배치 (전체 업로드)
+*/
+class ChunkBrickMesh
+{
+public:
+	void reset(uint32_t brickCount);
+
+	// local : 브릭 하나의 메쉬 (인덱스는 0부터)
+	void setBrick(uint32_t brick, const GeometryData& local);
+
+	// 누적된 변경. outRanges가 비어 있으면 outMesh는 청크 전체 메쉬 (전체 업로드),
+	// 아니면 outMesh는 outRanges 순서대로 이어 붙인 바뀐 구간만 담는다 (ApplyGeometryPatch 로 반영).
+	// 살아있는 삼각형이 없으면 outMesh는 빈 메쉬. 바뀐 것이 없으면 false
+	bool flush(GeometryData& outMesh, std::vector<GeometryRange>& outRanges);
+
+	uint32_t brickCount() const { return static_cast<uint32_t>(m_bricks.size()); }
+
+private:
+	struct BrickRange
+	{
+		uint32_t vertexOffset = 0;
+		uint32_t vertexCount = 0;
+		uint32_t vertexCapacity = 0;
+		uint32_t indexOffset = 0;
+		uint32_t indexCount = 0;
+		uint32_t indexCapacity = 0;
+	};
+
+	static uint32_t vertexCapacityFor(size_t count);
+	static uint32_t indexCapacityFor(size_t count);
+
+	void writeBrick(BrickRange& range, const Vertex* vertices, uint32_t vertexCount, const uint32_t* localIndices, uint32_t indexCount);
+	bool allocate(BrickRange& range, uint32_t vertexCount, uint32_t indexCount);
+	void relayout(uint32_t extraVertices, uint32_t extraIndices);
+
+private:
+	std::vector<BrickRange> m_bricks;
+	GeometryData m_mesh;				// 예비 공간 포함 전체 배치 (vertices/indices 크기 = GPU 버퍼 크기)
+	uint32_t m_vertexTail = 0;			// 꼬리 예비 공간 시작
+	uint32_t m_indexTail = 0;
+	uint32_t m_deadVertices = 0;		// 퇴출된 구간 용량 합
+	uint32_t m_deadIndices = 0;
+	uint32_t m_liveIndices = 0;			// 살아있는 인덱스 수
+
+	std::vector<GeometryRange> m_dirty;
+	bool m_fullUpload = true;
+};
@@ -0,0 +1,249 @@
+#include "pch.h"
+#include "ChunkMeshCache.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	inline size_t LinearIndex(int x, int y, int z, int dim) noexcept
+	{
+		return (static_cast<size_t>(z) * dim + y) * dim + x;
+	}
+
+	// 청크 로컬 샘플에서의 중앙 차분 gradient (경계는 단측 차분)
+	inline XMFLOAT3 SampleGradient(const float* s, int dim, int x, int y, int z)
+	{
+		auto at = [&](int ix, int iy, int iz) {
+			ix = std::clamp(ix, 0, dim - 1);
+			iy = std::clamp(iy, 0, dim - 1);
+			iz = std::clamp(iz, 0, dim - 1);
+			return s[LinearIndex(ix, iy, iz, dim)];
+		};
+		return XMFLOAT3{
+			at(x + 1, y, z) - at(x - 1, y, z),
+			at(x, y + 1, z) - at(x, y - 1, z),
+			at(x, y, z + 1) - at(x, y, z - 1)
+		};
+	}
+
+	// MC33TerrainBackend와 동일한 규칙으로 Tangent 생성
+	inline XMFLOAT4 MakeTangent(const XMVECTOR& N)
+	{
+		const float ny = XMVectorGetY(N);
+		XMVECTOR up = (fabsf(ny) > 0.999f) ? XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f) : XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+		XMVECTOR T = XMVector3Normalize(XMVector3Cross(up, N));
+		XMFLOAT3 t3;
+		XMStoreFloat3(&t3, T);
+		return XMFLOAT4{ t3.x, t3.y, t3.z, 1.0f };
+	}
+}
+
+uint64_t ChunkMeshCache::hashSamples(const float* samples, size_t count, float isoValue) noexcept
+{
+	// 4-lane multiply-xorshift 해시 (비트 패턴 기준, -0.0f/0.0f는 다른 값으로 취급)
+	constexpr uint64_t kPrime = 0x9E3779B97F4A7C15ull;
+	uint64_t h[4] = { 0x243F6A8885A308D3ull, 0x13198A2E03707344ull, 0xA4093822299F31D0ull, 0x082EFA98EC4E6C89ull };
+
+	const uint32_t* w = reinterpret_cast<const uint32_t*>(samples);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		h[0] = (h[0] ^ w[i + 0]) * kPrime;
+		h[1] = (h[1] ^ w[i + 1]) * kPrime;
+		h[2] = (h[2] ^ w[i + 2]) * kPrime;
+		h[3] = (h[3] ^ w[i + 3]) * kPrime;
+	}
+	for (; i < count; ++i) h[i & 3] = (h[i & 3] ^ w[i]) * kPrime;
+
+	uint32_t isoBits;
+	std::memcpy(&isoBits, &isoValue, sizeof(isoBits));
+
+	uint64_t r = (h[0] ^ (h[1] >> 17) ^ (h[2] << 13) ^ (h[3] >> 29)) ^ (uint64_t(isoBits) << 32) ^ count;
+	r ^= r >> 33; r *= 0xFF51AFD7ED558CCDull;
+	r ^= r >> 33; r *= 0xC4CEB9FE1A85EC53ull;
+	r ^= r >> 33;
+	return r;
+}
+
+void ChunkMeshCache::buildSignMask(const float* samples, size_t count, float isoValue, std::vector<uint64_t>& outMask)
+{
+	outMask.assign((count + 63) / 64, 0ull);
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (samples[i] >= isoValue) outMask[i >> 6] |= (1ull << (i & 63));
+	}
+}
+
+bool ChunkMeshCache::signMaskEquals(const float* samples, size_t count, float isoValue, const std::vector<uint64_t>& mask)
+{
+	if (mask.size() != (count + 63) / 64) return false;
+
+	for (size_t word = 0; word < mask.size(); ++word)
+	{
+		const size_t begin = word * 64;
+		const size_t end = std::min(begin + 64, count);
+		uint64_t bits = 0;
+		for (size_t i = begin; i < end; ++i)
+		{
+			if (samples[i] >= isoValue) bits |= (1ull << (i - begin));
+		}
+		if (bits != mask[word]) return false;
+	}
+	return true;
+}
+
+// 정점이 놓인 격자 엣지를 위치로부터 역추적
+// 두 축이 격자 평면 위에 있으면 나머지 한 축 방향 엣지 위의 정점, 그 외(셀 내부 정점, 샘플 위 정점)는 재보간 불가
+bool ChunkMeshCache::classifyVertexEdges(const ChunkExtractInput& in, const GeometryData& mesh, std::vector<uint32_t>& outEdges)
+{
+	constexpr float kGridEps = 1e-3f;
+	const float invCell = 1.0f / in.cellsize;
+	const int dim = in.dim;
+
+	outEdges.resize(mesh.vertices.size());
+	bool allOnEdges = true;
+	for (size_t v = 0; v < mesh.vertices.size(); ++v)
+	{
+		const XMFLOAT3& p = mesh.vertices[v].pos;
+		const float u[3] = {
+			(p.x - in.origin.x) * invCell,
+			(p.y - in.origin.y) * invCell,
+			(p.z - in.origin.z) * invCell
+		};
+
+		int onGridCount = 0;
+		int freeAxis = -1;
+		int base[3];
+		for (int a = 0; a < 3; ++a)
+		{
+			const float r = std::round(u[a]);
+			if (std::fabs(u[a] - r) < kGridEps)
+			{
+				++onGridCount;
+				base[a] = static_cast<int>(r);
+			}
+			else
+			{
+				freeAxis = a;
+				base[a] = static_cast<int>(std::floor(u[a]));
+			}
+		}
+
+		bool valid = (onGridCount == 2);
+		for (int a = 0; a < 3 && valid; ++a)
+		{
+			const int maxBase = (a == freeAxis) ? dim - 2 : dim - 1;
+			valid = (base[a] >= 0 && base[a] <= maxBase);
+		}
+
+		if (!valid)
+		{
+			outEdges[v] = kInteriorVertex;
+			allOnEdges = false;
+			continue;
+		}
+		outEdges[v] = static_cast<uint32_t>(LinearIndex(base[0], base[1], base[2], dim) << 2) | static_cast<uint32_t>(freeAxis);
+	}
+	return allOnEdges;
+}
+
+ChunkCacheResult ChunkMeshCache::tryReuse(const ChunkKey& key, const ChunkExtractInput& in, GeometryData& outMesh)
+{
+	auto it = m_entries.find(key);
+	if (it == m_entries.end()) return ChunkCacheResult::Miss;
+
+	const Entry& e = it->second;
+	const size_t count = static_cast<size_t>(in.dim) * in.dim * in.dim;
+	if (e.samples.size() != count) return ChunkCacheResult::Miss;
+
+	// 1. 직전에 돌려준 메쉬와 입력 동일 (iso + 샘플 해시)
+	const uint64_t hash = hashSamples(in.samples, count, in.isoValue);
+	if (hash == e.servedHash && in.isoValue == e.servedIso) return ChunkCacheResult::Unchanged;
+
+	// 2. 기준 (마지막 추출) 과 부호 패턴 동일 + 값 변화가 허용치 이내 -> 기준 메쉬를 재보간
+	if (!e.reinterpolatable || !signMaskEquals(in.samples, count, in.isoValue, e.signMask))
+		return ChunkCacheResult::Miss;
+
+	const float isoDelta = std::fabs(in.isoValue - e.isoValue);
+	float maxDelta = 0.0f;
+	for (size_t i = 0; i < count; ++i)
+	{
+		maxDelta = std::max(maxDelta, std::fabs(in.samples[i] - e.samples[i]));
+	}
+	if (maxDelta + isoDelta > m_reinterpTolerance) return ChunkCacheResult::Miss;
+
+	reinterpolate(e, in, outMesh);
+
+	// 기준은 그대로 두고 돌려준 입력만 기록
+	Entry& mut = it->second;
+	mut.servedIso = in.isoValue;
+	mut.servedHash = hash;
+	return ChunkCacheResult::Reinterpolated;
+}
+
+void ChunkMeshCache::store(const ChunkKey& key, const ChunkExtractInput& in, const GeometryData& mesh)
+{
+	const size_t count = static_cast<size_t>(in.dim) * in.dim * in.dim;
+
+	Entry& e = m_entries[key];
+	e.isoValue = in.isoValue;
+	e.servedIso = in.isoValue;
+	e.servedHash = hashSamples(in.samples, count, in.isoValue);
+	buildSignMask(in.samples, count, in.isoValue, e.signMask);
+	e.samples.assign(in.samples, in.samples + count);
+	e.mesh = mesh;
+	e.reinterpolatable = classifyVertexEdges(in, mesh, e.vertexEdges);
+}
+
+void ChunkMeshCache::reinterpolate(const Entry& e, const ChunkExtractInput& in, GeometryData& outMesh) const
+{
+	const int dim = in.dim;
+	const float* s = in.samples;
+	const size_t stride[3] = { 1, static_cast<size_t>(dim), static_cast<size_t>(dim) * dim };
+
+	outMesh.topology = e.mesh.topology;
+	outMesh.indices = e.mesh.indices;
+	outMesh.vertices.resize(e.mesh.vertices.size());
+
+	for (size_t v = 0; v < e.mesh.vertices.size(); ++v)
+	{
+		const Vertex& old = e.mesh.vertices[v];
+		const uint32_t code = e.vertexEdges[v];
+		const int axis = static_cast<int>(code & 3u);
+		const size_t ia = code >> 2;
+		const size_t ib = ia + stride[axis];
+
+		const int ax = static_cast<int>(ia % dim);
+		const int ay = static_cast<int>((ia / dim) % dim);
+		const int az = static_cast<int>(ia / stride[2]);
+
+		const float fa = s[ia];
+		const float fb = s[ib];
+		const float denom = fb - fa;
+		const float t = (std::fabs(denom) > 1e-12f) ? std::clamp((in.isoValue - fa) / denom, 0.0f, 1.0f) : 0.5f;
+
+		float local[3] = { static_cast<float>(ax), static_cast<float>(ay), static_cast<float>(az) };
+		local[axis] += t;
+
+		// 두 끝점 gradient를 보간하여 노멀 재계산, 기존 노멀 방향(MC33 규약)에 맞춰 부호 결정
+		const XMFLOAT3 ga = SampleGradient(s, dim, ax, ay, az);
+		const XMFLOAT3 gb = SampleGradient(s, dim, ax + (axis == 0), ay + (axis == 1), az + (axis == 2));
+		XMVECTOR N = XMVectorSet(ga.x + (gb.x - ga.x) * t, ga.y + (gb.y - ga.y) * t, ga.z + (gb.z - ga.z) * t, 0.0f);
+		if (XMVectorGetX(XMVector3LengthSq(N)) < 1e-20f)
+		{
+			N = XMLoadFloat3(&old.normal);
+		}
+		N = XMVector3Normalize(N);
+		if (XMVectorGetX(XMVector3Dot(N, XMLoadFloat3(&old.normal))) < 0.0f) N = XMVectorScale(N, -1.0f);
+
+		Vertex& out = outMesh.vertices[v];
+		out = old;
+		out.pos = {
+			in.origin.x + local[0] * in.cellsize,
+			in.origin.y + local[1] * in.cellsize,
+			in.origin.z + local[2] * in.cellsize
+		};
+		XMStoreFloat3(&out.normal, N);
+		out.tangent = MakeTangent(N);
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/ITerrainBackend.h"
+#include <unordered_map>
+
+/*
+* 청크 단위 추출 결과 캐시
+* - 청크별로 마지막 추출 입력(iso, 샘플 해시, 부호 마스크, 샘플 사본)과 결과 메쉬를 기록
+* - 입력이 완전히 같으면 추출을 생략하고, 부호 패턴이 같고 값 변화가 허용치 이내이면
+*   캐시된 메쉬의 정점만 엣지 위에서 재보간한다.
+* - 비교 기준 (샘플/부호/메쉬) 은 마지막 실제 추출 (store) 결과로 고정. 재보간은 기준을 바꾸지 않으므로
+*   조금씩 이어지는 편집도 누적 변화가 허용치를 넘으면 다시 추출된다 (위상 판정이 기준에서 무한히 멀어지지 않음)
+*/
+enum class ChunkCacheResult
+{
+	Miss,			// 추출 필요
+	Unchanged,		// 입력 동일 -> 기존 메쉬 그대로 사용 (업데이트 불필요)
+	Reinterpolated	// 부호 패턴 동일 -> 정점 재보간 결과를 outMesh에 기록
+};
+
+struct ChunkExtractInput
+{
+	const float* samples = nullptr;	// (dim)^3 개, X-최내부 선형 배열
+	int dim = 0;					// 축당 샘플 수 (chunkSize + 1)
+	float isoValue = 0.0f;
+	DirectX::XMFLOAT3 origin{};		// 청크 첫 샘플의 좌표
+	float cellsize = 1.0f;
+};
+
+class ChunkMeshCache
+{
+public:
+	static constexpr uint32_t kInteriorVertex = UINT32_MAX;
+
+	ChunkCacheResult tryReuse(const ChunkKey& key, const ChunkExtractInput& in, GeometryData& outMesh);
+	void store(const ChunkKey& key, const ChunkExtractInput& in, const GeometryData& mesh);
+
+	void erase(const ChunkKey& key) { m_entries.erase(key); }
+	void clear() { m_entries.clear(); }
+
+	// 부호 패턴이 같을 때 재보간을 허용하는 최대 샘플 변화량 (필드 값 단위)
+	// MC33의 면/내부 모호성 판정은 값에 의존하므로 너무 크게 잡으면 위상이 달라질 수 있다.
+	void setReinterpolationTolerance(float tol) { m_reinterpTolerance = tol; }
+	float getReinterpolationTolerance() const { return m_reinterpTolerance; }
+
+	static uint64_t hashSamples(const float* samples, size_t count, float isoValue) noexcept;
+
+private:
+	struct Entry
+	{
+		// 기준 : 마지막 추출 (store) 입력
+		float isoValue = 0.0f;
+		std::vector<uint64_t> signMask;		// 1 bit / sample (sample >= iso)
+		std::vector<float> samples;			// 마지막 추출 시 샘플 사본
+		// 마지막으로 돌려준 메쉬의 입력 (추출 또는 재보간). 같으면 Unchanged
+		float servedIso = 0.0f;
+		uint64_t servedHash = 0;
+		std::vector<uint32_t> vertexEdges;	// 정점별 (샘플 선형 인덱스 << 2 | 축), 내부 정점은 kInteriorVertex
+		GeometryData mesh;
+		bool reinterpolatable = false;
+	};
+
+	static void buildSignMask(const float* samples, size_t count, float isoValue, std::vector<uint64_t>& outMask);
+	static bool signMaskEquals(const float* samples, size_t count, float isoValue, const std::vector<uint64_t>& mask);
+	static bool classifyVertexEdges(const ChunkExtractInput& in, const GeometryData& mesh, std::vector<uint32_t>& outEdges);
+	void reinterpolate(const Entry& e, const ChunkExtractInput& in, GeometryData& outMesh) const;
+
+private:
+	std::unordered_map<ChunkKey, Entry, ChunkKeyHash> m_entries;
+	float m_reinterpTolerance = 0.05f;
+};
@@ -0,0 +1,217 @@
+#include "pch.h"
+#include "MCTerrainBackend.h"
+
+MCTerrainBackend::MCTerrainBackend(ID3D12Device* device, const GridDesc& desc) :
+	CPUTerrainBackend(device, desc)
+{
+	// 테이블 MC의 위상은 부호 패턴에만 의존하므로 부호가 같으면 항상 재보간 가능
+	m_meshCache.setReinterpolationTolerance(FLT_MAX);
+}
+
+void MCTerrainBackend::setGridDesc(const GridDesc& desc)
+{
+	CPUTerrainBackend::setGridDesc(desc);
+	m_brickChunks.clear();
+}
+
+void MCTerrainBackend::setFieldPtr(std::shared_ptr<SdfField<float>> grid)
+{
+	CPUTerrainBackend::setFieldPtr(std::move(grid));
+	m_brickChunks.clear();
+}
+
+void MCTerrainBackend::dropBrickMesh(const ChunkKey& key)
+{
+	m_brickChunks.erase(key);
+	m_chunkRanges.erase(key);
+}
+
+void MCTerrainBackend::requestRemesh(uint32_t frameIndex, const RemeshRequest& r)
+{
+	if (!m_grd || m_gridDesc.chunkSize == 0) return;
+
+	if (m_isoScrub)
+	{
+		std::unordered_map<ChunkKey, std::vector<uint32_t>, ChunkKeyHash> activeBricks;
+		prepareSpanIndex();
+		m_spanIndex.queryActiveByChunk(r.isoValue, m_gridDesc.chunkSize, activeBricks);
+
+		for (const auto& chunkKey : r.chunkset)
+		{
+			auto it = activeBricks.find(chunkKey);
+			extractChunkActiveBricks(chunkKey, r.isoValue, (it != activeBricks.end()) ? &it->second : nullptr);
+		}
+		return;
+	}
+
+	if (r.hasDirtyRegion)
+	{
+		for (const auto& chunkKey : r.chunkset)
+		{
+			extractChunkBricks(chunkKey, r.isoValue, r.dirtyMin, r.dirtyMax);
+		}
+		return;
+	}
+
+	for (const auto& chunkKey : r.chunkset)
+	{
+		extractChunk(chunkKey, r.isoValue);
+	}
+}
+
+void MCTerrainBackend::extractChunk(const ChunkKey& key, float isoValue)
+{
+	dropBrickMesh(key);
+
+	const int chunkSize = static_cast<int>(m_gridDesc.chunkSize);
+	const XMINT3 cellMin = { int(key.x) * chunkSize, int(key.y) * chunkSize, int(key.z) * chunkSize };
+	const XMINT3 cellMax = {
+		std::min(cellMin.x + chunkSize, m_grd->sx() - 1),
+		std::min(cellMin.y + chunkSize, m_grd->sy() - 1),
+		std::min(cellMin.z + chunkSize, m_grd->sz() - 1)
+	};
+
+	// 청크 샘플 [cellMin, cellMin + chunkSize] + gradient용 1샘플 apron 복사
+	const int dim = chunkSize + 3;
+	const XMINT3 base = { cellMin.x - 1, cellMin.y - 1, cellMin.z - 1 };
+	m_block.resize(static_cast<size_t>(dim) * dim * dim);
+	MCKernel::GatherBlock(*m_grd, base, dim, m_block.data());
+
+	const XMFLOAT3 origin = m_gridDesc.origin;
+	const float cellsize = m_gridDesc.cellsize;
+	const ChunkExtractInput cacheInput{
+		.samples = m_block.data(),
+		.dim = dim,
+		.isoValue = isoValue,
+		.origin = { origin.x + base.x * cellsize, origin.y + base.y * cellsize, origin.z + base.z * cellsize },
+		.cellsize = cellsize
+	};
+
+	GeometryData reused;
+	const ChunkCacheResult cacheResult = m_meshCache.tryReuse(key, cacheInput, reused);
+	if (cacheResult == ChunkCacheResult::Unchanged) return;
+	if (cacheResult == ChunkCacheResult::Reinterpolated)
+	{
+		m_chunkData[key] = std::move(reused);
+		return;
+	}
+
+	GeometryData md;
+	const XMINT3 cellCount = { cellMax.x - cellMin.x, cellMax.y - cellMin.y, cellMax.z - cellMin.z };
+	m_edgeVertices.reset(m_block.size());
+	MCKernel::ExtractChunkBlock(m_block.data(), chunkSize, cellCount, isoValue, cacheInput.origin, cellsize, m_edgeVertices, md);
+
+	m_meshCache.store(key, cacheInput, md);
+	m_chunkData[key] = std::move(md);
+}
+
+void MCTerrainBackend::extractChunkActiveBricks(const ChunkKey& key, float isoValue, const std::vector<uint32_t>* bricks)
+{
+	// Scrub 결과는 캐시 입력(전체 샘플)을 거치지 않으므로 해당 청크의 캐시는 무효화
+	m_meshCache.erase(key);
+	dropBrickMesh(key);
+
+	GeometryData& md = m_chunkData[key];
+	md = GeometryData{};
+	if (!bricks) return;	// 활성 브릭 없음 -> 빈 청크
+
+	const int chunkSize = static_cast<int>(m_gridDesc.chunkSize);
+	const XMINT3 chunkMin = { int(key.x) * chunkSize, int(key.y) * chunkSize, int(key.z) * chunkSize };
+	const XMINT3 chunkMax = {
+		std::min(chunkMin.x + chunkSize, m_grd->sx() - 1),
+		std::min(chunkMin.y + chunkSize, m_grd->sy() - 1),
+		std::min(chunkMin.z + chunkSize, m_grd->sz() - 1)
+	};
+
+	const MCKernel::FieldSampler sampler{ .field = m_grd.get() };
+	m_edgeVertices.reset(chunkMin, { chunkSize + 1, chunkSize + 1, chunkSize + 1 });
+	for (uint32_t b : *bricks)
+	{
+		XMINT3 cMin, cMax;
+		m_spanIndex.brickCellRange(b, cMin, cMax);
+		cMin = { std::max(cMin.x, chunkMin.x), std::max(cMin.y, chunkMin.y), std::max(cMin.z, chunkMin.z) };
+		cMax = { std::min(cMax.x, chunkMax.x), std::min(cMax.y, chunkMax.y), std::min(cMax.z, chunkMax.z) };
+		if (cMin.x >= cMax.x || cMin.y >= cMax.y || cMin.z >= cMax.z) continue;
+
+		MCKernel::ExtractCells(sampler, cMin, cMax, isoValue, m_gridDesc.origin, m_gridDesc.cellsize, m_edgeVertices, md);
+	}
+}
+
+void MCTerrainBackend::extractChunkBricks(const ChunkKey& key, float isoValue, const XMINT3& dirtyMin, const XMINT3& dirtyMax)
+{
+	// 브릭 결과는 캐시 입력(전체 샘플)을 거치지 않으므로 해당 청크의 캐시는 무효화
+	m_meshCache.erase(key);
+
+	const int chunkSize = static_cast<int>(m_gridDesc.chunkSize);
+	const XMINT3 chunkMin = { int(key.x) * chunkSize, int(key.y) * chunkSize, int(key.z) * chunkSize };
+	const XMINT3 chunkMax = {
+		std::min(chunkMin.x + chunkSize, m_grd->sx() - 1),
+		std::min(chunkMin.y + chunkSize, m_grd->sy() - 1),
+		std::min(chunkMin.z + chunkSize, m_grd->sz() - 1)
+	};
+	const int bricksPerAxis = (chunkSize + kBrickCells - 1) / kBrickCells;
+
+	// 처음 브러시가 닿은 청크거나 iso가 바뀌면 브릭 전체 추출 (전체 업로드)
+	auto [it, inserted] = m_brickChunks.try_emplace(key);
+	BrickChunk& chunk = it->second;
+	const bool rebuild = inserted || chunk.isoValue != isoValue;
+	if (rebuild)
+	{
+		chunk.mesh.reset(static_cast<uint32_t>(bricksPerAxis * bricksPerAxis * bricksPerAxis));
+		chunk.isoValue = isoValue;
+	}
+
+	// 샘플 s는 셀 s-1, s 의 코너이고, 정점 노멀은 엣지 끝점의 중앙 차분(±1 샘플)을 쓰므로 셀 [min-2, max+1] 이 영향을 받는다
+	XMINT3 cellMin = chunkMin;
+	XMINT3 cellMax = chunkMax;
+	if (!rebuild)
+	{
+		cellMin = { std::max(chunkMin.x, dirtyMin.x - 2), std::max(chunkMin.y, dirtyMin.y - 2), std::max(chunkMin.z, dirtyMin.z - 2) };
+		cellMax = { std::min(chunkMax.x, dirtyMax.x + 2), std::min(chunkMax.y, dirtyMax.y + 2), std::min(chunkMax.z, dirtyMax.z + 2) };
+	}
+	if (cellMin.x >= cellMax.x || cellMin.y >= cellMax.y || cellMin.z >= cellMax.z) return;
+
+	const XMINT3 brickLo = {
+		(cellMin.x - chunkMin.x) / kBrickCells, (cellMin.y - chunkMin.y) / kBrickCells, (cellMin.z - chunkMin.z) / kBrickCells
+	};
+	const XMINT3 brickHi = {
+		(cellMax.x - 1 - chunkMin.x) / kBrickCells, (cellMax.y - 1 - chunkMin.y) / kBrickCells, (cellMax.z - 1 - chunkMin.z) / kBrickCells
+	};
+
+	// 브릭 (kBrickCells + 3)^3 블록 복사 후 블록 커널로 추출. 브릭 경계 정점은 이웃 브릭과 중복되지만 위치/노멀이 같다.
+	const int dim = kBrickCells + 3;
+	const XMFLOAT3 origin = m_gridDesc.origin;
+	const float cellsize = m_gridDesc.cellsize;
+	m_block.resize(static_cast<size_t>(dim) * dim * dim);
+	for (int bz = brickLo.z; bz <= brickHi.z; ++bz)
+	{
+		for (int by = brickLo.y; by <= brickHi.y; ++by)
+		{
+			for (int bx = brickLo.x; bx <= brickHi.x; ++bx)
+			{
+				const XMINT3 bMin = { chunkMin.x + bx * kBrickCells, chunkMin.y + by * kBrickCells, chunkMin.z + bz * kBrickCells };
+				const XMINT3 cellCount = {
+					std::min(kBrickCells, chunkMax.x - bMin.x), std::min(kBrickCells, chunkMax.y - bMin.y), std::min(kBrickCells, chunkMax.z - bMin.z)
+				};
+
+				m_brickScratch.vertices.clear();
+				m_brickScratch.indices.clear();
+				if (cellCount.x > 0 && cellCount.y > 0 && cellCount.z > 0)
+				{
+					const XMINT3 base = { bMin.x - 1, bMin.y - 1, bMin.z - 1 };
+					const XMFLOAT3 blockOrigin = { origin.x + base.x * cellsize, origin.y + base.y * cellsize, origin.z + base.z * cellsize };
+					MCKernel::GatherBlock(*m_grd, base, dim, m_block.data());
+					m_edgeVertices.reset(m_block.size());
+					MCKernel::ExtractChunkBlock(m_block.data(), kBrickCells, cellCount, isoValue, blockOrigin, cellsize, m_edgeVertices, m_brickScratch);
+				}
+
+				const uint32_t brick = static_cast<uint32_t>((bz * bricksPerAxis + by) * bricksPerAxis + bx);
+				chunk.mesh.setBrick(brick, m_brickScratch);
+			}
+		}
+	}
+
+	GeometryData md;
+	std::vector<GeometryRange> ranges;
+	if (chunk.mesh.flush(md, ranges)) storeChunkPatch(key, std::move(md), ranges);
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/CPU/CPUTerrainBackend.h"
+#include "Core/Geometry/MarchingCubes/CPU/MC/MarchingCubesKernel.h"
+#include "Core/Geometry/MarchingCubes/CPU/ChunkBrickMesh.h"
+
+// 테이블 기반 Marching Cubes CPU 백엔드
+// Iso Scrub 모드에서는 Span-Space 인덱스의 활성 브릭 셀만 방문한다.
+// 브러시 요청(변경 범위 포함)은 청크를 kBrickCells^3 브릭으로 나눠 닿은 브릭만 재추출하고, 바뀐 VB/IB 구간만 업로드한다.
+class MCTerrainBackend : public CPUTerrainBackend
+{
+public:
+	static constexpr int kBrickCells = 8;
+
+	MCTerrainBackend(ID3D12Device* device, const GridDesc& desc);
+
+	// CPUTerrainBackend을(를) 통해 상속됨
+	void setGridDesc(const GridDesc& desc) override;
+	void setFieldPtr(std::shared_ptr<SdfField<float>> grid) override;
+	void requestRemesh(uint32_t frameIndex, const RemeshRequest& r) override;
+
+private:
+	void extractChunk(const ChunkKey& key, float isoValue);
+	void extractChunkActiveBricks(const ChunkKey& key, float isoValue, const std::vector<uint32_t>* bricks);
+	void extractChunkBricks(const ChunkKey& key, float isoValue, const XMINT3& dirtyMin, const XMINT3& dirtyMax);
+
+	// 전체 추출 경로로 바뀐 청크는 브릭 배치를 버린다 (GPU 버퍼 내용과 배치가 달라짐)
+	void dropBrickMesh(const ChunkKey& key);
+
+private:
+	struct BrickChunk
+	{
+		ChunkBrickMesh mesh;
+		float isoValue = 0.0f;
+	};
+
+	std::vector<float> m_block;				// 청크 + apron 샘플 복사본
+	MCKernel::EdgeVertexMap m_edgeVertices;
+	std::unordered_map<ChunkKey, BrickChunk, ChunkKeyHash> m_brickChunks;
+	GeometryData m_brickScratch;
+};
@@ -0,0 +1,329 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/MarchingCubesTables.h"
+#include "Core/Geometry/MarchingCubes/SdfField.h"
+#include "Core/DataStructures/Data.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+/*
+* CPU Marching Cubes 커널 (테이블 기반)
+* - 코너 순서/비트 규칙/삼각형 와인딩/노멀 부호는 MarchingCubesCS.hlsl과 동일하게 맞춤
+*   (bit i = value(corner i) < iso, 삼각형은 C-B-A 순서로 출력, normal = -normalize(grad))
+* - Sampler는 전역 샘플 좌표로 값을 돌려주는 타입 (value(x, y, z)), 셀 범위 밖 1샘플까지 접근 가능해야 함(gradient)
+* - 청크 블록 추출(ExtractChunkBlock)은 청크 + apron 을 연속 블록으로 복사해 선형 인덱스/고정 코너 오프셋으로 순회
+*   (청크 크기별 컴파일 타임 stride 특수화는 측정상 차이가 없어 두지 않음)
+*/
+namespace MCKernel
+{
+	inline constexpr int kCornerOffset[8][3] = {
+		{ 0, 0, 0 }, { 1, 0, 0 }, { 1, 0, 1 }, { 0, 0, 1 },
+		{ 0, 1, 0 }, { 1, 1, 0 }, { 1, 1, 1 }, { 0, 1, 1 }
+	};
+
+	// 엣지 e 의 진행 축 (0:x, 1:y, 2:z)
+	inline constexpr auto kEdgeAxis = [] {
+		std::array<uint8_t, 12> t{};
+		for (int e = 0; e < 12; ++e)
+		{
+			const int a = MarchingCubesTables::edgeToVertices[e][0];
+			const int b = MarchingCubesTables::edgeToVertices[e][1];
+			t[e] = (kCornerOffset[a][0] != kCornerOffset[b][0]) ? 0 : ((kCornerOffset[a][1] != kCornerOffset[b][1]) ? 1 : 2);
+		}
+		return t;
+	}();
+
+	// 전역 필드를 직접 읽는 Sampler (경계 클램프)
+	struct FieldSampler
+	{
+		const SdfField<float>* field = nullptr;
+		inline float value(int x, int y, int z) const noexcept { return field->at_clamped(x, y, z); }
+	};
+
+	// (샘플 좌표, 축) -> 정점 인덱스. 세대 스탬프로 매 청크 초기화 비용 없이 재사용
+	class EdgeVertexMap
+	{
+	public:
+		void reset(const DirectX::XMINT3& sampleMin, const DirectX::XMINT3& sampleDim)
+		{
+			m_min = sampleMin;
+			m_dim = sampleDim;
+			const size_t n = static_cast<size_t>(sampleDim.x) * sampleDim.y * sampleDim.z * 3;
+			if (m_stamp.size() < n)
+			{
+				m_stamp.assign(n, 0u);
+				m_vertex.resize(n);
+				m_generation = 0;
+			}
+			if (++m_generation == 0)
+			{
+				std::fill(m_stamp.begin(), m_stamp.end(), 0u);
+				m_generation = 1;
+			}
+		}
+
+		// 블록 선형 인덱스 기반 사용 (sampleCount = 블록 샘플 수)
+		void reset(size_t sampleCount)
+		{
+			reset({ 0, 0, 0 }, { static_cast<int32_t>(sampleCount), 1, 1 });
+		}
+
+		inline uint32_t* findLinear(size_t sample, int axis) noexcept
+		{
+			const size_t i = sample * 3 + axis;
+			return (m_stamp[i] == m_generation) ? &m_vertex[i] : nullptr;
+		}
+
+		inline void insertLinear(size_t sample, int axis, uint32_t vertex) noexcept
+		{
+			const size_t i = sample * 3 + axis;
+			m_stamp[i] = m_generation;
+			m_vertex[i] = vertex;
+		}
+
+		inline uint32_t* find(int x, int y, int z, int axis) noexcept
+		{
+			const size_t i = slot(x, y, z, axis);
+			return (m_stamp[i] == m_generation) ? &m_vertex[i] : nullptr;
+		}
+
+		inline void insert(int x, int y, int z, int axis, uint32_t vertex) noexcept
+		{
+			const size_t i = slot(x, y, z, axis);
+			m_stamp[i] = m_generation;
+			m_vertex[i] = vertex;
+		}
+
+	private:
+		inline size_t slot(int x, int y, int z, int axis) const noexcept
+		{
+			return ((static_cast<size_t>(z - m_min.z) * m_dim.y + (y - m_min.y)) * m_dim.x + (x - m_min.x)) * 3 + axis;
+		}
+
+		DirectX::XMINT3 m_min{};
+		DirectX::XMINT3 m_dim{};
+		std::vector<uint32_t> m_stamp;
+		std::vector<uint32_t> m_vertex;
+		uint32_t m_generation = 0;
+	};
+
+	template <typename Sampler>
+	inline DirectX::XMFLOAT3 Gradient(const Sampler& s, int x, int y, int z) noexcept
+	{
+		return DirectX::XMFLOAT3{
+			s.value(x + 1, y, z) - s.value(x - 1, y, z),
+			s.value(x, y + 1, z) - s.value(x, y - 1, z),
+			s.value(x, y, z + 1) - s.value(x, y, z - 1)
+		};
+	}
+
+	// 엣지 양 끝점(위치, gradient, 값)으로 정점 생성
+	inline Vertex MakeVertex(const DirectX::XMFLOAT3& pa, const DirectX::XMFLOAT3& pb, const DirectX::XMFLOAT3& ga, const DirectX::XMFLOAT3& gb,
+		float va, float vb, float iso)
+	{
+		using namespace DirectX;
+		const float denom = vb - va;
+		const float t = (std::fabs(denom) > 1e-8f) ? std::clamp((iso - va) / denom, 0.0f, 1.0f) : 0.5f;
+
+		XMVECTOR N = XMVectorSet(ga.x + (gb.x - ga.x) * t, ga.y + (gb.y - ga.y) * t, ga.z + (gb.z - ga.z) * t, 0.0f);
+		N = (XMVectorGetX(XMVector3LengthSq(N)) > 1e-20f) ? XMVectorScale(XMVector3Normalize(N), -1.0f) : XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+
+		XMVECTOR up = (std::fabs(XMVectorGetY(N)) > 0.999f) ? XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f) : XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+		XMVECTOR T = XMVector3Normalize(XMVector3Cross(up, N));
+
+		Vertex v{};
+		v.pos = { pa.x + (pb.x - pa.x) * t, pa.y + (pb.y - pa.y) * t, pa.z + (pb.z - pa.z) * t };
+		XMStoreFloat3(&v.normal, N);
+		XMFLOAT3 t3;
+		XMStoreFloat3(&t3, T);
+		v.tangent = { t3.x, t3.y, t3.z, 1.0f };
+		v.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		return v;
+	}
+
+	template <typename Sampler>
+	inline Vertex MakeEdgeVertex(const Sampler& s, const int a[3], const int b[3], float va, float vb, float iso, const DirectX::XMFLOAT3& origin, float cellsize)
+	{
+		const DirectX::XMFLOAT3 pa = { origin.x + a[0] * cellsize, origin.y + a[1] * cellsize, origin.z + a[2] * cellsize };
+		const DirectX::XMFLOAT3 pb = { origin.x + b[0] * cellsize, origin.y + b[1] * cellsize, origin.z + b[2] * cellsize };
+		return MakeVertex(pa, pb, Gradient(s, a[0], a[1], a[2]), Gradient(s, b[0], b[1], b[2]), va, vb, iso);
+	}
+
+	// 셀 범위 [cellMin, cellMax) 를 추출하여 out에 누적. 정점은 edges를 통해 공유
+	template <typename Sampler>
+	void ExtractCells(const Sampler& s, const DirectX::XMINT3& cellMin, const DirectX::XMINT3& cellMax, float iso,
+		const DirectX::XMFLOAT3& origin, float cellsize, EdgeVertexMap& edges, GeometryData& out)
+	{
+		using namespace MarchingCubesTables;
+
+		for (int z = cellMin.z; z < cellMax.z; ++z)
+		{
+			for (int y = cellMin.y; y < cellMax.y; ++y)
+			{
+				for (int x = cellMin.x; x < cellMax.x; ++x)
+				{
+					float v[8];
+					int cfg = 0;
+					for (int i = 0; i < 8; ++i)
+					{
+						v[i] = s.value(x + kCornerOffset[i][0], y + kCornerOffset[i][1], z + kCornerOffset[i][2]);
+						if (v[i] < iso) cfg |= (1 << i);
+					}
+					const uint32_t edgeMask = caseEdgeMask[cfg];
+					if (edgeMask == 0) continue;
+
+					uint32_t vid[12];
+					for (int e = 0; e < 12; ++e)
+					{
+						if (!(edgeMask & (1u << e))) continue;
+
+						const int ca = edgeCorners[e] & 0xF;
+						const int cb = edgeCorners[e] >> 4;
+						const int a[3] = { x + kCornerOffset[ca][0], y + kCornerOffset[ca][1], z + kCornerOffset[ca][2] };
+						const int b[3] = { x + kCornerOffset[cb][0], y + kCornerOffset[cb][1], z + kCornerOffset[cb][2] };
+
+						// 엣지 식별 : 작은 쪽 샘플 좌표 + 축
+						const int axis = kEdgeAxis[e];
+						const int* lo = (a[axis] < b[axis]) ? a : b;
+						if (uint32_t* found = edges.find(lo[0], lo[1], lo[2], axis))
+						{
+							vid[e] = *found;
+							continue;
+						}
+
+						vid[e] = static_cast<uint32_t>(out.vertices.size());
+						out.vertices.push_back(MakeEdgeVertex(s, a, b, v[ca], v[cb], iso, origin, cellsize));
+						edges.insert(lo[0], lo[1], lo[2], axis, vid[e]);
+					}
+
+					const auto& tri = caseEdges[cfg];
+					const int n = caseTriCount[cfg] * 3;
+					for (int i = 0; i < n; i += 3)
+					{
+						out.indices.push_back(vid[tri[i + 2]]);
+						out.indices.push_back(vid[tri[i + 1]]);
+						out.indices.push_back(vid[tri[i + 0]]);
+					}
+				}
+			}
+		}
+	}
+
+	// 청크 블록 레이아웃 : 청크 셀 N^3 + 양쪽 1샘플 apron -> 축당 N + 3 샘플
+	struct BlockDims
+	{
+		int chunkSize = 0;
+
+		int chunk() const noexcept { return chunkSize; }
+		int dim() const noexcept { return chunkSize + 3; }
+		size_t strideY() const noexcept { return static_cast<size_t>(dim()); }
+		size_t strideZ() const noexcept { return static_cast<size_t>(dim()) * dim(); }
+	};
+
+	// 필드에서 블록 복사 : 블록 (0,0,0) = 전역 base. 범위 안 행은 행 단위 복사(readRow), 경계 행만 클램프 샘플링
+	inline void GatherBlock(const SdfField<float>& field, const DirectX::XMINT3& base, int dim, float* dst)
+	{
+		const bool xInside = (base.x >= 0) && (base.x + dim <= field.sx());
+		for (int z = 0; z < dim; ++z)
+		{
+			const int gz = base.z + z;
+			for (int y = 0; y < dim; ++y, dst += dim)
+			{
+				const int gy = base.y + y;
+				if (xInside && gy >= 0 && gy < field.sy() && gz >= 0 && gz < field.sz())
+				{
+					field.readRow(gy, gz, base.x, dim, dst);
+					continue;
+				}
+				for (int x = 0; x < dim; ++x) dst[x] = field.at_clamped(base.x + x, gy, gz);
+			}
+		}
+	}
+
+	// 블록 추출 : 블록 로컬 셀 [1, cellCount] (로컬 1 = 청크 첫 셀), blockOrigin = 블록 (0,0,0) 샘플의 위치
+	// edges는 reset(블록 샘플 수) 상태여야 함
+	inline void ExtractBlock(const float* block, const BlockDims& dims, const DirectX::XMINT3& cellCount, float iso,
+		const DirectX::XMFLOAT3& blockOrigin, float cellsize, EdgeVertexMap& edges, GeometryData& out)
+	{
+		using namespace MarchingCubesTables;
+
+		const size_t sy = dims.strideY();
+		const size_t sz = dims.strideZ();
+		const size_t corner[8] = { 0, 1, 1 + sz, sz, sy, 1 + sy, 1 + sy + sz, sy + sz };
+
+		auto gradient = [block, sy, sz](size_t i) {
+			return DirectX::XMFLOAT3{ block[i + 1] - block[i - 1], block[i + sy] - block[i - sy], block[i + sz] - block[i - sz] };
+		};
+
+		for (int z = 1; z <= cellCount.z; ++z)
+		{
+			for (int y = 1; y <= cellCount.y; ++y)
+			{
+				const size_t row = z * sz + y * sy;
+				for (int x = 1; x <= cellCount.x; ++x)
+				{
+					const size_t i0 = row + x;
+
+					float v[8];
+					int cfg = 0;
+					for (int i = 0; i < 8; ++i)
+					{
+						v[i] = block[i0 + corner[i]];
+						cfg |= (v[i] < iso) ? (1 << i) : 0;
+					}
+					const uint32_t edgeMask = caseEdgeMask[cfg];
+					if (edgeMask == 0) continue;
+
+					uint32_t vid[12];
+					for (int e = 0; e < 12; ++e)
+					{
+						if (!(edgeMask & (1u << e))) continue;
+
+						const int ca = edgeCorners[e] & 0xF;
+						const int cb = edgeCorners[e] >> 4;
+						const int axis = kEdgeAxis[e];
+						const size_t ia = i0 + corner[ca];
+						const size_t ib = i0 + corner[cb];
+						const size_t lo = std::min(ia, ib);
+						if (uint32_t* found = edges.findLinear(lo, axis))
+						{
+							vid[e] = *found;
+							continue;
+						}
+
+						const DirectX::XMFLOAT3 pa = {
+							blockOrigin.x + (x + kCornerOffset[ca][0]) * cellsize,
+							blockOrigin.y + (y + kCornerOffset[ca][1]) * cellsize,
+							blockOrigin.z + (z + kCornerOffset[ca][2]) * cellsize
+						};
+						const DirectX::XMFLOAT3 pb = {
+							blockOrigin.x + (x + kCornerOffset[cb][0]) * cellsize,
+							blockOrigin.y + (y + kCornerOffset[cb][1]) * cellsize,
+							blockOrigin.z + (z + kCornerOffset[cb][2]) * cellsize
+						};
+
+						vid[e] = static_cast<uint32_t>(out.vertices.size());
+						out.vertices.push_back(MakeVertex(pa, pb, gradient(ia), gradient(ib), v[ca], v[cb], iso));
+						edges.insertLinear(lo, axis, vid[e]);
+					}
+
+					const auto& tri = caseEdges[cfg];
+					const int n = caseTriCount[cfg] * 3;
+					for (int i = 0; i < n; i += 3)
+					{
+						out.indices.push_back(vid[tri[i + 2]]);
+						out.indices.push_back(vid[tri[i + 1]]);
+						out.indices.push_back(vid[tri[i + 0]]);
+					}
+				}
+			}
+		}
+	}
+
+	inline void ExtractChunkBlock(const float* block, int chunkSize, const DirectX::XMINT3& cellCount, float iso,
+		const DirectX::XMFLOAT3& blockOrigin, float cellsize, EdgeVertexMap& edges, GeometryData& out)
+	{
+		ExtractBlock(block, BlockDims{ chunkSize }, cellCount, iso, blockOrigin, cellsize, edges, out);
+	}
+}
@@ -5,16 +5,31 @@
 
 void MC33TerrainBackend::requestRemesh(uint32_t frameIndex, const RemeshRequest& r)
 {
-    m_chunkData.clear();
-
+    // NOTE : m_chunkData는 tryFetch에서 비워진다. 여기서 비우면 fetch 전에 들어온 이전 요청 결과가 유실되고,
+    //        캐시 히트(Unchanged)로 건너뛴 청크가 다시는 전달되지 않을 수 있다.
     int chunkSize = m_gridDesc.chunkSize;
     const int totalX = m_grd->sx();
     const int totalY = m_grd->sy();
     const int totalZ = m_grd->sz();
 
+    // Iso Scrub : 활성 브릭이 하나도 없는 청크는 추출 없이 빈 메쉬로 처리
+    std::unordered_map<ChunkKey, std::vector<uint32_t>, ChunkKeyHash> activeBricks;
+    if (m_isoScrub)
+    {
+        prepareSpanIndex();
+        m_spanIndex.queryActiveByChunk(r.isoValue, m_gridDesc.chunkSize, activeBricks);
+    }
+
     _GRD* grd = new _GRD{};
     for (auto& chunkKey : r.chunkset)
     {
+        if (m_isoScrub && !activeBricks.contains(chunkKey))
+        {
+            m_meshCache.erase(chunkKey);
+            m_chunkData[chunkKey] = GeometryData{};
+            continue;
+        }
+
         const int baseX = chunkKey.x * chunkSize;
         const int baseY = chunkKey.y * chunkSize;
         const int baseZ = chunkKey.z * chunkSize;
@@ -34,22 +49,32 @@ void MC33TerrainBackend::requestRemesh(uint32_t frameIndex, const RemeshRequest&
         grd->nonortho = 0;
         grd->periodic = 0;
 
-        SdfField<float> chunk(chunkSize+1, chunkSize+1, chunkSize+1);
-        
-        for (int z = 0; z <= chunkSize; ++z)
+        // 청크 샘플의 선형 사본 (필드 레이아웃과 무관하게 MC33 삼중 포인터 인터페이스로 전달)
+        SdfLinearView<float> chunk(*m_grd, baseX, baseY, baseZ, chunkSize + 1, chunkSize + 1, chunkSize + 1);
+
+        // 추출 입력이 이전과 같거나(Unchanged) 부호 패턴만 유지된 경우(Reinterpolated) MC33 추출 생략
+        const ChunkExtractInput cacheInput{
+            .samples = chunk.data(),
+            .dim = chunkSize + 1,
+            .isoValue = r.isoValue,
+            .origin = { static_cast<float>(grd->r0[0]), static_cast<float>(grd->r0[1]), static_cast<float>(grd->r0[2]) },
+            .cellsize = m_gridDesc.cellsize
+        };
+        GeometryData reused;
+        const ChunkCacheResult cacheResult = m_meshCache.tryReuse(chunkKey, cacheInput, reused);
+        if (cacheResult == ChunkCacheResult::Unchanged) continue;
+        if (cacheResult == ChunkCacheResult::Reinterpolated)
         {
-            for (int y = 0; y <= chunkSize; ++y)
-            {
-                const float* srcRow = m_grd->rowPtr(baseY + y, baseZ + z) + baseX;
-                float* dstRow = chunk.rowPtr(y, z);
-                std::memcpy(dstRow, srcRow, static_cast<size_t>(chunkSize+1) * sizeof(float));
-            }
+            m_chunkData[chunkKey] = std::move(reused);
+            continue;
         }
+
         grd->F = reinterpret_cast<GRD_data_type***>(static_cast<float***>(chunk));
 
         MC33* M = create_MC33(grd);
         surface* S = calculate_isosurface(M, r.isoValue);
 
+        m_chunkData[chunkKey] = GeometryData{};
         m_chunkData[chunkKey].vertices.reserve(S->nV);
         for (unsigned i = 0; i < S->nV; ++i) 
         {
@@ -58,11 +83,11 @@ void MC33TerrainBackend::requestRemesh(uint32_t frameIndex, const RemeshRequest&
 
             XMVECTOR N = XMVector3Normalize(XMVectorSet(n[0], n[1], n[2], 0.0f));
 
-            // N ʹ     
+            // N과 너무 평행하지 않은 기준 축 선택
             float ny = XMVectorGetY(N);
             XMVECTOR up = (fabsf(ny) > 0.999f) ? XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f) : XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
 
-            // T = up  N (ȭ)
+            // T = up × N (정규화)
             XMVECTOR T = XMVector3Normalize(XMVector3Cross(up, N));
 
             XMFLOAT3 t3;
@@ -86,6 +111,8 @@ void MC33TerrainBackend::requestRemesh(uint32_t frameIndex, const RemeshRequest&
 
         free_surface_memory(S);
         free_MC33(M);
+
+        m_meshCache.store(chunkKey, cacheInput, m_chunkData[chunkKey]);
     }
     delete grd;
 }
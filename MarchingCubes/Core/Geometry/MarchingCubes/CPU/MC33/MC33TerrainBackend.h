@@ -5,7 +5,7 @@ class MC33TerrainBackend : public CPUTerrainBackend
 public:
 	using CPUTerrainBackend::CPUTerrainBackend;
 
-	// CPUTerrainBackend()  ӵ
+	// CPUTerrainBackend을(를) 통해 상속됨
 	void requestRemesh(uint32_t frameIndex, const RemeshRequest& r) override;
 
 };
@@ -0,0 +1,215 @@
+#include "pch.h"
+#include "SpanSpaceIndex.h"
+#include <algorithm>
+#include <cmath>
+
+void SpanSpaceIndex::build(const SdfField<float>& field, uint32_t brickCells, uint32_t bucketCount)
+{
+	clear();
+	if (field.empty() || brickCells == 0 || bucketCount == 0) return;
+
+	m_brickCells = brickCells;
+	m_bucketCount = bucketCount;
+	m_cells = { std::max(field.sx() - 1, 1), std::max(field.sy() - 1, 1), std::max(field.sz() - 1, 1) };
+	m_brickDim = {
+		static_cast<int32_t>((m_cells.x + brickCells - 1) / brickCells),
+		static_cast<int32_t>((m_cells.y + brickCells - 1) / brickCells),
+		static_cast<int32_t>((m_cells.z + brickCells - 1) / brickCells)
+	};
+
+	const size_t numBricks = static_cast<size_t>(m_brickDim.x) * m_brickDim.y * m_brickDim.z;
+	m_brickMin.resize(numBricks);
+	m_brickMax.resize(numBricks);
+	m_brickBucket.assign(numBricks, UINT32_MAX);
+	m_brickSlot.assign(numBricks, UINT32_MAX);
+	m_dirtyFlag.assign(numBricks, 0);
+
+	float lo = FLT_MAX, hi = -FLT_MAX;
+	for (uint32_t b = 0; b < numBricks; ++b)
+	{
+		computeBrickRange(field, b, m_brickMin[b], m_brickMax[b]);
+		lo = std::min(lo, m_brickMin[b]);
+		hi = std::max(hi, m_brickMax[b]);
+	}
+
+	// 버킷 격자의 값 범위는 build 시점에 고정 (이후 범위를 벗어난 값은 양 끝 버킷으로 클램프)
+	m_rangeLo = lo;
+	const float width = (hi > lo) ? (hi - lo) / static_cast<float>(m_bucketCount) : 1.0f;
+	m_invBucketWidth = 1.0f / width;
+
+	m_buckets.assign(static_cast<size_t>(m_bucketCount) * m_bucketCount, {});
+	for (uint32_t b = 0; b < numBricks; ++b) insertToBucket(b);
+}
+
+void SpanSpaceIndex::clear()
+{
+	m_brickMin.clear();
+	m_brickMax.clear();
+	m_brickBucket.clear();
+	m_brickSlot.clear();
+	m_buckets.clear();
+	m_dirtyBricks.clear();
+	m_dirtyFlag.clear();
+	m_cells = { 0, 0, 0 };
+	m_brickDim = { 0, 0, 0 };
+}
+
+void SpanSpaceIndex::markDirtySamples(const XMINT3& sampleMin, const XMINT3& sampleMax)
+{
+	if (!valid()) return;
+
+	// 샘플 s를 코너로 쓰는 셀은 s-1, s -> 해당 셀을 포함하는 브릭 범위
+	auto brickRange = [this](int sMin, int sMax, int cells, int dim, int& outLo, int& outHi) {
+		const int cLo = std::clamp(sMin - 1, 0, cells - 1);
+		const int cHi = std::clamp(sMax, 0, cells - 1);
+		outLo = std::min(cLo / static_cast<int>(m_brickCells), dim - 1);
+		outHi = std::min(cHi / static_cast<int>(m_brickCells), dim - 1);
+	};
+
+	int bx0, bx1, by0, by1, bz0, bz1;
+	brickRange(sampleMin.x, sampleMax.x, m_cells.x, m_brickDim.x, bx0, bx1);
+	brickRange(sampleMin.y, sampleMax.y, m_cells.y, m_brickDim.y, by0, by1);
+	brickRange(sampleMin.z, sampleMax.z, m_cells.z, m_brickDim.z, bz0, bz1);
+
+	for (int bz = bz0; bz <= bz1; ++bz)
+		for (int by = by0; by <= by1; ++by)
+			for (int bx = bx0; bx <= bx1; ++bx)
+			{
+				const uint32_t b = static_cast<uint32_t>((bz * m_brickDim.y + by) * m_brickDim.x + bx);
+				if (m_dirtyFlag[b]) continue;
+				m_dirtyFlag[b] = 1;
+				m_dirtyBricks.push_back(b);
+			}
+}
+
+void SpanSpaceIndex::refresh(const SdfField<float>& field)
+{
+	if (!valid()) return;
+
+	for (uint32_t b : m_dirtyBricks)
+	{
+		removeFromBucket(b);
+		computeBrickRange(field, b, m_brickMin[b], m_brickMax[b]);
+		insertToBucket(b);
+		m_dirtyFlag[b] = 0;
+	}
+	m_dirtyBricks.clear();
+}
+
+void SpanSpaceIndex::queryActive(float isoValue, std::vector<uint32_t>& outBricks) const
+{
+	outBricks.clear();
+	if (!valid()) return;
+
+	const uint32_t K = m_bucketCount;
+	const uint32_t q = bucketOf(isoValue);
+
+	// min 버킷 <= q <= max 버킷 인 영역만 후보. 경계(min==q 또는 max==q) 버킷만 정확 비교 필요
+	for (uint32_t i = 0; i <= q; ++i)
+	{
+		for (uint32_t j = q; j < K; ++j)
+		{
+			const auto& bucket = m_buckets[static_cast<size_t>(i) * K + j];
+			if (bucket.empty()) continue;
+
+			if (i < q && j > q)
+			{
+				outBricks.insert(outBricks.end(), bucket.begin(), bucket.end());
+				continue;
+			}
+			for (uint32_t b : bucket)
+			{
+				if (m_brickMin[b] <= isoValue && isoValue <= m_brickMax[b]) outBricks.push_back(b);
+			}
+		}
+	}
+}
+
+void SpanSpaceIndex::queryActiveByChunk(float isoValue, uint32_t chunkSize, std::unordered_map<ChunkKey, std::vector<uint32_t>, ChunkKeyHash>& outChunkBricks) const
+{
+	outChunkBricks.clear();
+	if (chunkSize == 0) return;
+
+	std::vector<uint32_t> active;
+	queryActive(isoValue, active);
+
+	for (uint32_t b : active)
+	{
+		XMINT3 cMin, cMax;
+		brickCellRange(b, cMin, cMax);
+		for (int cz = cMin.z / int(chunkSize); cz <= (cMax.z - 1) / int(chunkSize); ++cz)
+			for (int cy = cMin.y / int(chunkSize); cy <= (cMax.y - 1) / int(chunkSize); ++cy)
+				for (int cx = cMin.x / int(chunkSize); cx <= (cMax.x - 1) / int(chunkSize); ++cx)
+					outChunkBricks[ChunkKey{ uint32_t(cx), uint32_t(cy), uint32_t(cz) }].push_back(b);
+	}
+}
+
+void SpanSpaceIndex::brickCellRange(uint32_t brick, XMINT3& outCellMin, XMINT3& outCellMax) const
+{
+	const int bs = static_cast<int>(m_brickCells);
+	const int bx = static_cast<int>(brick % m_brickDim.x);
+	const int by = static_cast<int>((brick / m_brickDim.x) % m_brickDim.y);
+	const int bz = static_cast<int>(brick / (m_brickDim.x * m_brickDim.y));
+
+	outCellMin = { bx * bs, by * bs, bz * bs };
+	outCellMax = {
+		std::min(outCellMin.x + bs, m_cells.x),
+		std::min(outCellMin.y + bs, m_cells.y),
+		std::min(outCellMin.z + bs, m_cells.z)
+	};
+}
+
+// 브릭 셀들의 코너 샘플 [cellMin, cellMax] (포함) 의 min/max
+void SpanSpaceIndex::computeBrickRange(const SdfField<float>& field, uint32_t brick, float& outMin, float& outMax) const
+{
+	XMINT3 cMin, cMax;
+	brickCellRange(brick, cMin, cMax);
+
+	float lo = FLT_MAX, hi = -FLT_MAX;
+	for (int z = cMin.z; z <= cMax.z; ++z)
+	{
+		for (int y = cMin.y; y <= cMax.y; ++y)
+		{
+			const auto row = field.row(y, z);
+			for (int x = cMin.x; x <= cMax.x; ++x)
+			{
+				lo = std::min(lo, row[x]);
+				hi = std::max(hi, row[x]);
+			}
+		}
+	}
+	outMin = lo;
+	outMax = hi;
+}
+
+uint32_t SpanSpaceIndex::bucketOf(float v) const
+{
+	const float f = (v - m_rangeLo) * m_invBucketWidth;
+	if (!(f > 0.0f)) return 0;
+	return std::min(static_cast<uint32_t>(f), m_bucketCount - 1);
+}
+
+void SpanSpaceIndex::insertToBucket(uint32_t brick)
+{
+	const uint32_t id = bucketOf(m_brickMin[brick]) * m_bucketCount + bucketOf(m_brickMax[brick]);
+	auto& bucket = m_buckets[id];
+	m_brickBucket[brick] = id;
+	m_brickSlot[brick] = static_cast<uint32_t>(bucket.size());
+	bucket.push_back(brick);
+}
+
+void SpanSpaceIndex::removeFromBucket(uint32_t brick)
+{
+	const uint32_t id = m_brickBucket[brick];
+	if (id == UINT32_MAX) return;
+
+	auto& bucket = m_buckets[id];
+	const uint32_t slot = m_brickSlot[brick];
+	const uint32_t last = bucket.back();
+	bucket[slot] = last;
+	m_brickSlot[last] = slot;
+	bucket.pop_back();
+
+	m_brickBucket[brick] = UINT32_MAX;
+	m_brickSlot[brick] = UINT32_MAX;
+}
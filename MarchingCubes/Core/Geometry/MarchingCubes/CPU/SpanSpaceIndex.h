@@ -0,0 +1,56 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/ITerrainBackend.h"
+#include <unordered_map>
+
+/*
+* Span-Space 인덱스 (브릭 단위 min/max 구간)
+* - 셀을 brickCells^3 브릭으로 묶고 각 브릭의 샘플 min/max를 (min, max) 평면의 K x K 버킷 격자에 등록
+* - iso 질의 시 min <= iso <= max 인 브릭(활성 브릭)만 반환 : 버킷 격자의 대각 영역만 순회
+* - Brush 편집은 markDirtySamples로 해당 브릭만 무효화하고, refresh에서 재계산/재배치
+*/
+class SpanSpaceIndex
+{
+public:
+	void build(const SdfField<float>& field, uint32_t brickCells = 8, uint32_t bucketCount = 64);
+	void clear();
+	bool valid() const { return !m_brickMin.empty(); }
+
+	// 샘플 인덱스 범위 [sampleMin, sampleMax] (포함)가 바뀌었음을 기록
+	void markDirtySamples(const DirectX::XMINT3& sampleMin, const DirectX::XMINT3& sampleMax);
+	bool hasDirty() const { return !m_dirtyBricks.empty(); }
+	void refresh(const SdfField<float>& field);
+
+	// min <= iso <= max 인 브릭 목록
+	void queryActive(float isoValue, std::vector<uint32_t>& outBricks) const;
+	// 활성 브릭을 청크별로 분류 (청크 경계에 걸친 브릭은 겹치는 모든 청크에 등록)
+	void queryActiveByChunk(float isoValue, uint32_t chunkSize, std::unordered_map<ChunkKey, std::vector<uint32_t>, ChunkKeyHash>& outChunkBricks) const;
+
+	// 브릭이 덮는 셀 범위 [outCellMin, outCellMax) (셀 인덱스, max 미포함)
+	void brickCellRange(uint32_t brick, DirectX::XMINT3& outCellMin, DirectX::XMINT3& outCellMax) const;
+	uint32_t brickCells() const { return m_brickCells; }
+	size_t brickCount() const { return m_brickMin.size(); }
+
+private:
+	void computeBrickRange(const SdfField<float>& field, uint32_t brick, float& outMin, float& outMax) const;
+	uint32_t bucketOf(float v) const;
+	void insertToBucket(uint32_t brick);
+	void removeFromBucket(uint32_t brick);
+
+private:
+	uint32_t m_brickCells = 8;
+	DirectX::XMINT3 m_cells{ 0, 0, 0 };		// 셀 수 (샘플 수 - 1)
+	DirectX::XMINT3 m_brickDim{ 0, 0, 0 };	// 축별 브릭 수
+
+	std::vector<float> m_brickMin;
+	std::vector<float> m_brickMax;
+	std::vector<uint32_t> m_brickBucket;	// 브릭이 속한 버킷
+	std::vector<uint32_t> m_brickSlot;		// 버킷 내 위치 (swap-remove 용)
+
+	uint32_t m_bucketCount = 64;
+	float m_rangeLo = 0.0f;
+	float m_invBucketWidth = 1.0f;
+	std::vector<std::vector<uint32_t>> m_buckets;	// [minBucket * K + maxBucket]
+
+	std::vector<uint32_t> m_dirtyBricks;
+	std::vector<uint8_t> m_dirtyFlag;
+};
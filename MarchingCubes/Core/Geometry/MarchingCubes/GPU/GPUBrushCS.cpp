@@ -13,10 +13,10 @@ void GPUBrushCS::encode(const GPUBrushEncodingContext& context)
 	ID3D12GraphicsCommandList* cmd = context.cmd;
 	const SDFVolumeView& vol = context.vol;
 
-	// 귯ÿ threadgroups
+	// 브러시용 threadgroups
 	const XMUINT3 brushGroups = computeBrushDispatchGroups(context. regionMin, context.regionMax);
 
-	// Density3D SRV -> UAV ȯ
+	// Density3D SRV -> UAV 전환
 	auto Density3DtoUav = CD3DX12_RESOURCE_BARRIER::Transition(vol.tex, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 	cmd->ResourceBarrier(1, &Density3DtoUav);
 
@@ -24,7 +24,7 @@ void GPUBrushCS::encode(const GPUBrushEncodingContext& context)
 	PIXScopedEvent(PIX_COLOR(0, 128, 255), "CPU Brush encode");
 #endif
 
-	// PSO, RootSig, Heap 
+	// PSO, RootSig, Heap 세팅
 	cmd->SetPipelineState(m_brushPso.Get());
 	cmd->SetComputeRootSignature(m_brushRootSignature.Get());
 	cmd->SetComputeRootConstantBufferView(0, context.cbAddress);
@@ -41,14 +41,14 @@ void GPUBrushCS::encode(const GPUBrushEncodingContext& context)
 	PIXEndEvent(cmd);
 #endif
 
-	// Dispatch   ȯ
+	// Dispatch 후 상태 전환
 	auto backToSrv = CD3DX12_RESOURCE_BARRIER::Transition(vol.tex, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
 	cmd->ResourceBarrier(1, &backToSrv);
 }
 
 void GPUBrushCS::ensureRootSignature(ID3D12Device* device)
 {
-	// Brush ñ״ : b0, u1
+	// Brush 시그니쳐 : b0, u1
 	if (!m_brushRootSignature)
 	{
 		CD3DX12_DESCRIPTOR_RANGE1 uUav{};
@@ -3,7 +3,7 @@
 
 struct alignas(16) BrushCBData {
 	float brushRadius;
-	float brushWeight; // Add, Sub  +- app ־ش.
+	float brushWeight; // Add, Sub에 맞춰 +-값 app에서 넣어준다.
 	float deltaTime;
 	int _padding0;
 	
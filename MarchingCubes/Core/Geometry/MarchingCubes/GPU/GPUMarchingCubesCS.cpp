@@ -21,7 +21,7 @@ void GPUMarchingCubesCS::encode(const GPUMCEncodingContext& context)
 
 	uploadTableIfNeeded(cmd);
 
-	// ġ( =(dim-1))
+	// 디스패치(셸 개수=(dim-1))
 	cmd->SetPipelineState(m_mcPso.Get());
 	cmd->SetComputeRootSignature(m_mcRootSig.Get());
 	cmd->SetComputeRootConstantBufferView(0, context.cbAddress); // b0: GridCB
@@ -59,7 +59,7 @@ void GPUMarchingCubesCS::uploadTableIfNeeded(ID3D12GraphicsCommandList* cmd)
 
 void GPUMarchingCubesCS::ensurePipeline(ID3D12Device* device)
 {
-	// MarchingCubesCS ñ״ : b0, t0, t1, u0
+	// MarchingCubesCS 시그니쳐 : b0, t0, t1, u0
 	if (!m_mcRootSig)
 	{
 		CD3DX12_DESCRIPTOR_RANGE1 sSRV[2]{}, sUav{};
@@ -89,7 +89,7 @@ void GPUMarchingCubesCS::ensurePipeline(ID3D12Device* device)
 
 	if (!m_mcPso)
 	{
-		// PSO (MarchingCubesCS.hlsl  "CS")
+		// PSO (MarchingCubesCS.hlsl 의 "CS")
 		ComPtr<ID3DBlob> csBlob = PSOList::LoadFileBlob("MarchingCubesCS.cso");
 
 		D3D12_COMPUTE_PIPELINE_STATE_DESC pso{
@@ -100,7 +100,7 @@ void GPUMarchingCubesCS::ensurePipeline(ID3D12Device* device)
 	}
 }
 
-//   Tritable ʱȭ ܰ迡 ̸ صд
+// 정적 데이터인 Tritable은 초기화 단계에서 미리 생성해둔다
 void GPUMarchingCubesCS::ensureTable(ID3D12Device* device)
 {
 	if (m_triDefault) return;
@@ -122,7 +122,7 @@ void GPUMarchingCubesCS::ensureTable(ID3D12Device* device)
 
 DirectX::XMUINT3 GPUMarchingCubesCS::computeDispatchGroupsForRegion(const uint32_t chunkcubes, const DirectX::XMUINT3& gridDim, const DirectX::XMUINT3& regionMin, const DirectX::XMUINT3& regionMax)
 {
-	uint32_t groupsPerChunk = (chunkcubes + 7) / 8; // chunkcubes = 16̹Ƿ 2   
+	uint32_t groupsPerChunk = (chunkcubes + 7) / 8; // chunkcubes = 16이므로 2의 값이 들어갈 예정
 	XMUINT3 gpc(groupsPerChunk, groupsPerChunk, groupsPerChunk);
 
 	XMUINT3 cmin{
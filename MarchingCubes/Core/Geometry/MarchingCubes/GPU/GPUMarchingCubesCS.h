@@ -11,7 +11,7 @@ struct alignas(16) GridCBData {
 	XMUINT3  numChunkAxis;   // = volView.numChunkAxis
 	uint32_t chunkCubes;     // = volView.chunkCubes
 
-	XMUINT3  regionCellMin;  // = ûũ ĵ remesh  ()
+	XMUINT3  regionCellMin;  // = 청크 정렬된 remesh 범위 (셀)
 	uint32_t _padding1;
 	XMUINT3  regionCellMax;
 	uint32_t _padding2;
@@ -73,7 +73,7 @@ void GPUTerrainBackend::setGridDesc(const GridDesc& desc)
 	m_grid = desc;
 
 	computeNumChunks();
-	// readback  
+	// readback 버퍼 재생성
 	m_outBuffer.Reset();
 	ensureTriangleBuffer();
 	for (uint32_t i = 0; i < kRBFrameCount; ++i)
@@ -86,7 +86,7 @@ void GPUTerrainBackend::setGridDesc(const GridDesc& desc)
 void GPUTerrainBackend::setFieldPtr(std::shared_ptr<SdfField<float>> grid)
 {
 	m_gridData = std::move(grid);
-	//SDFVolume3D Upload m_fieldDirty üũϿ encode ó.
+	//SDFVolume3D의 Upload는 m_fieldDirty를 체크하여 encode에서 처리.
 	m_fieldDirty = true;
 }
 
@@ -95,11 +95,11 @@ void GPUTerrainBackend::requestBrush(uint32_t frameIndex, const BrushRequest& r)
 	m_requestedBrush = r;
 	m_hasBrush = true;
 
-	// Brush óѴٴ° ޽  ʿϴٴ 
+	// Brush를 처리한다는건 메쉬 갱신이 필요하다는 뜻
 	requestRemesh(frameIndex, RemeshRequest(m_requestedRemesh.isoValue));
 }
 
-// ü Chunk  û
+// 전체 Chunk 리빌드 요청
 void GPUTerrainBackend::requestRemesh(uint32_t frameIndex, const RemeshRequest& r)
 {
 	m_requestedRemesh = r;
@@ -110,7 +110,7 @@ void GPUTerrainBackend::requestRemesh(uint32_t frameIndex, const RemeshRequest&
 
 void GPUTerrainBackend::encode(uint32_t frameIndex)
 {
-	// encode ߵϴ  : _GRD (m_fieldDirty == true), brush (m_hasBrush == true)
+	// encode가 발동하는 조건 : _GRD 갱신(m_fieldDirty == true), brush 사용(m_hasBrush == true)
 	if (!m_device || (!m_fieldDirty && !m_hasBrush && !m_needsRemesh)) return;
 
 	prepareComputeEncoding();
@@ -212,7 +212,7 @@ bool GPUTerrainBackend::tryFetch(std::vector<ChunkUpdate>& OutChunkUpdates)
 	}
 	r.rbTriangles->Unmap(0, nullptr);
 
-	//     advance
+	// 다음 프레임을 위한 링 advance
 	m_rbCursor = (m_rbCursor + 1) % kRBFrameCount;
 	return !OutChunkUpdates.empty();
 }
@@ -317,7 +317,7 @@ void GPUTerrainBackend::finishComputeEncoding()
 	ID3D12CommandList* ppCommandLists[] = { m_commandList.Get() };
 	m_commandQueue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
 
-	// Compute ť ۾ ִ ķ óϱ  Signal ɾΰ tryFetch 
+	// Compute 큐의 작업을 최대한 병렬로 처리하기 위해 Signal만 걸어두고 tryFetch에서 대기
 	ThrowIfFailed(m_commandQueue->Signal(m_fence.Get(), m_fenceValues));
 	m_lastSubmitFenceValues = m_fenceValues++;
 	m_needsFetch = true;
@@ -380,7 +380,7 @@ void GPUTerrainBackend::encodeRemeshPass(uint32_t frameIndex, const DirectX::XMU
 	auto trisToUav = CD3DX12_RESOURCE_BARRIER::Transition(m_outBuffer.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 	m_commandList->ResourceBarrier(1, &trisToUav);
 
-	// ī (0)
+	// 카운터 리셋(0)
 	m_uploadContext->ResetCounterUAV(m_commandList.Get(), m_outCounter.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
 
 	XMUINT3 expandedMin, expandedMax;
@@ -414,7 +414,7 @@ void GPUTerrainBackend::encodeRemeshPass(uint32_t frameIndex, const DirectX::XMU
 	};
 	m_mc->encode(ctx);
 
-	// readback 
+	// readback 스케쥴
 	const uint32_t rbSlot = m_rbCursor;
 	ensureRBSlot(rbSlot);
 
@@ -15,8 +15,8 @@ struct OutVertex
 	XMFLOAT3 position;
 	XMFLOAT3 normal;
 	XMFLOAT4 tangent;
-	int idA; //  A ε ȣ
-	int idB; //  B ε ȣ
+	int idA; // 엣지 A 인덱스 번호
+	int idB; // 엣지 B 인덱스 번호
 };
 
 struct OutTriangle
@@ -34,13 +34,13 @@ public:
 	{
 		DescriptorAllocator* descriptorAllocator = nullptr;
 		UploadContext* uplaodContext = nullptr;
-		// ComputeSystem* computeSystem = nullptr; // TODO : Compute System   ߰
+		// ComputeSystem* computeSystem = nullptr; // TODO : Compute System 구현 시 추가
 	};
 
 	explicit GPUTerrainBackend(ID3D12Device* device, const GridDesc& gridDesc, const GPUTerrainInitInfo& init);
 	~GPUTerrainBackend();
 
-	// ITerrainBackend()  ӵ
+	// ITerrainBackend을(를) 통해 상속됨
 	void setGridDesc(const GridDesc& desc) override;
 	void setFieldPtr(std::shared_ptr<SdfField<float>> grid) override;
 	void requestBrush(uint32_t frameIndex, const BrushRequest& r) override;
@@ -66,8 +66,8 @@ private:
 
 private:
 	static constexpr uint32_t m_ring = 3;
-	static constexpr size_t kRBFrameCount = 2; // N  [0] Dispatch -> N+1 ӿ [0] Fetch, [1] Dispatch
-	static constexpr int s_chunkcubes = 16; // threadgroup 8x8x8 
+	static constexpr size_t kRBFrameCount = 2; // N 프레임 [0] Dispatch -> N+1 프레임에서 [0] Fetch, [1] Dispatch
+	static constexpr int s_chunkcubes = 16; // threadgroup 8x8x8 정렬
 
 	ID3D12Device* m_device = nullptr;
 	DescriptorAllocator* m_descriptorAllocator = nullptr;
@@ -95,7 +95,7 @@ private:
 
 	ComPtr<ID3D12Resource> m_outBuffer;
 	ComPtr<ID3D12Resource> m_outCounter;
-	static const uint32_t m_triCapPerChunk = 5*16*16*16; // ûũ ﰢ
+	static const uint32_t m_triCapPerChunk = 5*16*16*16; // 청크당 삼각형
 
 	GridDesc m_grid{};
 	DirectX::XMUINT3 m_numChunkAxis{};
@@ -16,8 +16,11 @@ void SDFVolume3D::uploadFromGRD(ID3D12GraphicsCommandList* cmd, const SdfField<f
 
 	EnsureDensityTex(dimX, dimY, dimZ);
 
+	// 브릭 레이아웃 필드는 X-선형 사본으로 변환하여 업로드 (Linear는 복사 없음)
+	SdfLinearView<float> linear(*grid);
+
 	D3D12_SUBRESOURCE_DATA s{};
-	s.pData = grid->data();
+	s.pData = linear.data();
 	s.RowPitch = sizeof(float) * dimX;
 	s.SlicePitch = s.RowPitch * dimY;
 	std::vector<D3D12_SUBRESOURCE_DATA> subs{ s };
@@ -1,11 +1,15 @@
 #pragma once
 #include <Core/Geometry/MarchingCubes/SdfField.h>
 #include "Core/DataStructures/Data.h"
+#include "Core/Math/TriangleBVH.h"
 #include <set>
 
+class SdfMipPyramid;
+
 enum class TerrainMode
 {
 	CPU_MC33,
+	CPU_MC,
 	GPU_ORIGINAL
 };
 
@@ -45,12 +49,18 @@ struct ChunkUpdate
 	ChunkKey key{};
 	GeometryData md{};
 	bool empty = true;
+	std::vector<GeometryRange> ranges;		// 비어 있지 않으면 md는 이 구간들만 순서대로 이어 붙인 patch (브릭 부분 재추출 -> 부분 업로드)
 };
 
 struct RemeshRequest
 {
 	float isoValue = 0.0f;
 	std::set<ChunkKey> chunkset;
+
+	// 브러시로 바뀐 샘플 범위 (전역 샘플 인덱스, 양 끝 포함). 지원하는 백엔드는 이 범위가 닿는 브릭만 재추출
+	bool hasDirtyRegion = false;
+	DirectX::XMINT3 dirtyMin{};
+	DirectX::XMINT3 dirtyMax{};
 };
 
 struct BrushRequest
@@ -67,8 +77,14 @@ struct ITerrainBackend
 {
 	virtual ~ITerrainBackend() = default;
 	virtual void setGridDesc(const GridDesc&) = 0;
-	virtual void setFieldPtr(std::shared_ptr<SdfField<float>> grid) = 0;			// GPU: density3D  / CPU:  GRD 
+	virtual void setFieldPtr(std::shared_ptr<SdfField<float>> grid) = 0;			// GPU: density3D 갱신 / CPU: 내부 GRD 보관
 	virtual void requestBrush(uint32_t frameIndex, const BrushRequest& r) = 0;
 	virtual void requestRemesh(uint32_t frameIndex, const RemeshRequest& r) = 0;
 	virtual bool tryFetch(std::vector<ChunkUpdate>& OutChunkUpdates) = 0;  // GPU : readback / CPU : GeometryData -> GeometryBuffer Commit
+	virtual void setIsoScrub(bool enable) {}	// Iso 값 탐색 모드 : Span-Space 인덱스로 활성 셀만 추출 (지원하지 않는 백엔드는 무시)
+	virtual bool isFieldCPUResident() const { return false; }	// CPU SdfField가 최신 상태인지 (SDF 직접 피킹 가능 여부, GPU는 brush가 GPU 볼륨만 갱신)
+	virtual void endStroke(uint32_t frameIndex, float isoValue) {}	// 브러시 스트로크 종료 : CPU는 스트로크 영역 재거리화를 예약하고 이후 tryFetch 마다 슬랩 단위로 나눠 재메싱 (GPU는 무시)
+	virtual void setMipPyramid(bool enable) {}	// 필드 밉 피라미드 유지 (brush마다 조상 블록만 갱신, 지원하지 않는 백엔드는 무시)
+	virtual const SdfMipPyramid* getMipPyramid() const { return nullptr; }	// 유지 중이고 필드와 같은 상태일 때만
+	virtual void notifyFieldEdited(uint32_t frameIndex, const DirectX::XMINT3& sampleMin, const DirectX::XMINT3& sampleMax, float isoValue) {}	// 외부에서 CPU 필드를 직접 고친 뒤 호출 (샘플 범위 양 끝 포함) : 파생 구조 갱신 후 그 영역만 재메싱 (GPU는 무시)
 };
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include "pch.h"
+#include "SdfCollision.h"
+#include "SdfRaycast.h"
+#include "Core/Utils/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	constexpr int kProjectIterations = 4;		// ClosestPoint Newton 투영 횟수
+	constexpr int kSweepBisectIterations = 12;
+	constexpr int kCapsuleMaxSamples = 64;
+	constexpr size_t kBatchGrain = 64;
+
+	using DirectX::XMFLOAT3;
+
+	inline XMFLOAT3 Sub(const XMFLOAT3& a, const XMFLOAT3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+	inline XMFLOAT3 Scale(const XMFLOAT3& a, float s) { return { a.x * s, a.y * s, a.z * s }; }
+	inline XMFLOAT3 Lerp3(const XMFLOAT3& a, const XMFLOAT3& b, float t) { return { a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t }; }
+	inline float Length(const XMFLOAT3& a) { return std::sqrt(a.x * a.x + a.y * a.y + a.z * a.z); }
+
+	// 표면 밖 거리 추정 상한 : 필드 대각선 길이 (gradient가 0인 포화 영역 보호)
+	float MaxDistance(const SdfCollision::Volume& volume)
+	{
+		const SdfField<float>& f = *volume.field;
+		const float dx = static_cast<float>(f.sx()), dy = static_cast<float>(f.sy()), dz = static_cast<float>(f.sz());
+		return std::sqrt(dx * dx + dy * dy + dz * dz) * volume.cellsize;
+	}
+
+	// 캡슐 축 위 매개변수 s 에서의 거리
+	float SegmentDistance(const SdfCollision::Volume& volume, const XMFLOAT3& a, const XMFLOAT3& b, float s)
+	{
+		return SdfCollision::SampleDistance(volume, Lerp3(a, b, s)).distance;
+	}
+}
+
+namespace SdfCollision
+{
+	bool IsValid(const Volume& volume)
+	{
+		return volume.field && !volume.field->empty() && volume.cellsize > 0.0f &&
+			volume.field->sx() > 1 && volume.field->sy() > 1 && volume.field->sz() > 1;
+	}
+
+	DistanceSample SampleDistance(const Volume& volume, const XMFLOAT3& p)
+	{
+		DistanceSample out{};
+		if (!IsValid(volume)) return out;
+
+		const float invCell = 1.0f / volume.cellsize;
+		const float gx = (p.x - volume.origin.x) * invCell, gy = (p.y - volume.origin.y) * invCell, gz = (p.z - volume.origin.z) * invCell;
+		const SdfField<float>& field = *volume.field;
+		// 범위 밖 : 경계 셀 값으로 클램프하면 경계면 거리를 돌려주게 되므로 "먼 외부" 로 표시 (NaN 도 여기서 걸러짐)
+		if (!(gx >= 0.0f && gy >= 0.0f && gz >= 0.0f &&
+			gx <= static_cast<float>(field.sx() - 1) && gy <= static_cast<float>(field.sy() - 1) && gz <= static_cast<float>(field.sz() - 1)))
+		{
+			return out;
+		}
+
+		XMFLOAT3 grad;
+		const float f = SdfRaycast::SampleTrilinearGradient(field, gx, gy, gz, grad);
+		out.inField = true;
+
+		// 격자 단위 gradient -> 월드 단위
+		const float gradLen = Length(grad) * invCell;
+		const float limit = MaxDistance(volume);
+		out.distance = (gradLen > 1e-12f) ? std::clamp((volume.isoValue - f) / gradLen, -limit, limit) : ((f < volume.isoValue) ? limit : -limit);
+		if (gradLen > 1e-12f)
+		{
+			const float inv = -invCell / gradLen;
+			out.normal = { grad.x * inv, grad.y * inv, grad.z * inv };
+		}
+		return out;
+	}
+
+	bool ClosestPoint(const Volume& volume, const XMFLOAT3& p, XMFLOAT3& outPoint, XMFLOAT3& outNormal)
+	{
+		if (!IsValid(volume)) return false;
+
+		// p_{k+1} = p_k - n_k * d_k (표면 근처에서 빠르게 수렴)
+		XMFLOAT3 q = p;
+		DistanceSample s = SampleDistance(volume, q);
+		const float tolerance = 1e-4f * volume.cellsize;
+		for (int it = 0; it < kProjectIterations && s.inField && std::fabs(s.distance) > tolerance; ++it)
+		{
+			q = Sub(q, Scale(s.normal, s.distance));
+			s = SampleDistance(volume, q);
+		}
+		if (!s.inField) return false;
+
+		// 포화 영역 등으로 수렴 실패 (표면에서 1셀 이상 떨어짐)
+		if (std::fabs(s.distance) > volume.cellsize) return false;
+
+		outPoint = q;
+		outNormal = s.normal;
+		return true;
+	}
+
+	Contact SphereOverlap(const Volume& volume, const XMFLOAT3& center, float radius)
+	{
+		Contact out{};
+		if (!IsValid(volume)) return out;
+
+		const DistanceSample s = SampleDistance(volume, center);
+		if (s.distance >= radius) return out;
+
+		out.hit = true;
+		out.normal = s.normal;
+		out.depth = radius - s.distance;
+		out.point = Sub(center, Scale(s.normal, s.distance));
+		return out;
+	}
+
+	Contact CapsuleOverlap(const Volume& volume, const XMFLOAT3& a, const XMFLOAT3& b, float radius)
+	{
+		if (!IsValid(volume)) return {};
+
+		// 축을 반 셀 간격으로 샘플해 최소 거리 구간을 찾고, 그 주변을 삼분 탐색으로 정밀화
+		const float len = Length(Sub(b, a));
+		const int samples = std::clamp(static_cast<int>(std::ceil(len / (0.5f * volume.cellsize))) + 1, 2, kCapsuleMaxSamples);
+		int best = 0;
+		float bestDist = FLT_MAX;
+		for (int i = 0; i < samples; ++i)
+		{
+			const float d = SegmentDistance(volume, a, b, static_cast<float>(i) / (samples - 1));
+			if (d < bestDist)
+			{
+				bestDist = d;
+				best = i;
+			}
+		}
+
+		float lo = static_cast<float>(std::max(best - 1, 0)) / (samples - 1);
+		float hi = static_cast<float>(std::min(best + 1, samples - 1)) / (samples - 1);
+		for (int it = 0; it < 8; ++it)
+		{
+			const float m1 = lo + (hi - lo) / 3.0f;
+			const float m2 = hi - (hi - lo) / 3.0f;
+			if (SegmentDistance(volume, a, b, m1) < SegmentDistance(volume, a, b, m2)) hi = m2;
+			else lo = m1;
+		}
+
+		Contact out = SphereOverlap(volume, Lerp3(a, b, 0.5f * (lo + hi)), radius);
+		if (!out.hit && bestDist < radius)
+		{
+			// 정밀화가 구간 밖으로 벗어난 경우 샘플 최소점 사용
+			out = SphereOverlap(volume, Lerp3(a, b, static_cast<float>(best) / (samples - 1)), radius);
+		}
+		return out;
+	}
+
+	SweepResult SphereSweep(const Volume& volume, const XMFLOAT3& from, const XMFLOAT3& to, float radius)
+	{
+		SweepResult out{};
+		out.position = to;
+		if (!IsValid(volume)) return out;
+
+		const XMFLOAT3 delta = Sub(to, from);
+		const float len = Length(delta);
+
+		auto gap = [&](float t, DistanceSample& s) {
+			s = SampleDistance(volume, Lerp3(from, to, t));
+			return s.distance - radius;
+		};
+
+		DistanceSample s;
+		if (gap(0.0f, s) <= 0.0f)
+		{
+			out.hit = true;
+			out.toi = 0.0f;
+			out.position = from;
+			out.normal = s.normal;
+			return out;
+		}
+		if (len <= 1e-12f) return out;
+
+		// 거리 추정만큼 전진 (추정이 부정확하므로 [1/4셀, 1셀] 로 제한)
+		const float minStep = 0.25f * volume.cellsize / len;
+		const float maxStep = volume.cellsize / len;
+		float tPrev = 0.0f;
+		float t = 0.0f;
+		float g = gap(0.0f, s);
+		while (t < 1.0f)
+		{
+			tPrev = t;
+			t = std::min(1.0f, t + std::clamp(g / len, minStep, maxStep));
+			g = gap(t, s);
+			if (g > 0.0f) continue;
+
+			// [tPrev, t] 에서 부호 변화 -> 이분법
+			float lo = tPrev, hi = t;
+			for (int it = 0; it < kSweepBisectIterations; ++it)
+			{
+				const float mid = 0.5f * (lo + hi);
+				if (gap(mid, s) > 0.0f) lo = mid;
+				else hi = mid;
+			}
+			gap(hi, s);
+			out.hit = true;
+			out.toi = lo;	// 관통 직전 위치
+			out.position = Lerp3(from, to, lo);
+			out.normal = s.normal;
+			return out;
+		}
+		return out;
+	}
+
+	void SphereOverlapBatch(const Volume& volume, const std::vector<SphereQuery>& queries, std::vector<Contact>& outContacts)
+	{
+		outContacts.assign(queries.size(), Contact{});
+		ThreadPool::Get().ParallelFor(0, queries.size(), kBatchGrain, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) outContacts[i] = SphereOverlap(volume, queries[i].center, queries[i].radius);
+		});
+	}
+
+	void SphereSweepBatch(const Volume& volume, const std::vector<SweepQuery>& queries, std::vector<SweepResult>& outResults)
+	{
+		outResults.assign(queries.size(), SweepResult{});
+		ThreadPool::Get().ParallelFor(0, queries.size(), kBatchGrain, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) outResults[i] = SphereSweep(volume, queries[i].from, queries[i].to, queries[i].radius);
+		});
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/SdfField.h"
+#include <DirectXMath.h>
+#include <vector>
+
+/*
+* SdfField 기반 충돌 질의 (삼각형 메시 갱신 여부와 무관)
+* - 필드는 정규화된 거리가 아니라 클램프된 밀도이므로, 표면까지 거리는 1차 근사 d = (iso - f) / |∇f| 로 추정
+*   (d > 0 : 외부, d < 0 : 내부, 표면 근처에서 정확하고 멀어질수록 과대/과소 추정)
+* - f, ∇f 는 셀 하나의 trilinear 보간과 해석 gradient (코너 8개 읽기)
+* - 필드 샘플 범위 밖의 점은 경계 셀로 클램프하지 않고 inField = false, distance = FLT_MAX (멀리 떨어진 외부) 로 돌려준다
+*   -> 범위 밖 구/캡슐은 겹치지 않고, ClosestPoint 는 실패, 스윕은 범위 밖 구간을 빈 공간으로 지나간다
+* - 스윕은 최대 1셀 간격으로 전진하고 부호가 바뀌면 이분법으로 충돌 시점을 정밀화
+* - *Batch : 공용 ThreadPool에서 질의 단위 병렬 (수천 개 에이전트용)
+* - 좌표는 필드 로컬 공간 (TerrainSystem::getCollisionVolume)
+*/
+namespace SdfCollision
+{
+	struct Volume
+	{
+		const SdfField<float>* field = nullptr;
+		DirectX::XMFLOAT3 origin{};
+		float cellsize = 1.0f;
+		float isoValue = 0.0f;
+	};
+
+	struct DistanceSample
+	{
+		float distance = FLT_MAX;	// 표면까지 부호 거리 추정 (외부 > 0), 필드 밖이면 FLT_MAX
+		bool inField = false;		// 필드 샘플 범위 안에서 보간한 값인지
+		DirectX::XMFLOAT3 normal{ 0.0f, 1.0f, 0.0f };	// 외부 방향 (-normalize(∇f))
+	};
+
+	struct Contact
+	{
+		bool hit = false;
+		DirectX::XMFLOAT3 point{};		// 표면 위 접촉점
+		DirectX::XMFLOAT3 normal{};		// 외부 방향
+		float depth = 0.0f;				// 관통 깊이 (hit일 때 > 0)
+	};
+
+	struct SweepResult
+	{
+		bool hit = false;
+		float toi = 1.0f;				// 충돌 시점 [0, 1] (from -> to 비율)
+		DirectX::XMFLOAT3 position{};	// 충돌 시점의 구 중심
+		DirectX::XMFLOAT3 normal{};
+	};
+
+	struct SphereQuery
+	{
+		DirectX::XMFLOAT3 center{};
+		float radius = 0.0f;
+	};
+
+	struct SweepQuery
+	{
+		DirectX::XMFLOAT3 from{};
+		DirectX::XMFLOAT3 to{};
+		float radius = 0.0f;
+	};
+
+	bool IsValid(const Volume& volume);
+
+	DistanceSample SampleDistance(const Volume& volume, const DirectX::XMFLOAT3& p);
+	// 표면 위 최근접점 (Newton 투영 몇 회)
+	bool ClosestPoint(const Volume& volume, const DirectX::XMFLOAT3& p, DirectX::XMFLOAT3& outPoint, DirectX::XMFLOAT3& outNormal);
+
+	Contact SphereOverlap(const Volume& volume, const DirectX::XMFLOAT3& center, float radius);
+	Contact CapsuleOverlap(const Volume& volume, const DirectX::XMFLOAT3& a, const DirectX::XMFLOAT3& b, float radius);
+	SweepResult SphereSweep(const Volume& volume, const DirectX::XMFLOAT3& from, const DirectX::XMFLOAT3& to, float radius);
+
+	void SphereOverlapBatch(const Volume& volume, const std::vector<SphereQuery>& queries, std::vector<Contact>& outContacts);
+	void SphereSweepBatch(const Volume& volume, const std::vector<SweepQuery>& queries, std::vector<SweepResult>& outResults);
+}
@@ -1,48 +1,51 @@
 #pragma once
 #include <cstdint>
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <type_traits>
 #include <stdexcept>
+#include <vector>
+#include "Core/Utils/ThreadPool.h"
+#include "Core/Utils/VirtualMemory.h"
 
-#if defined(_MSC_VER)
-#include <malloc.h> 
-#endif
-// 32B   ϴ deleter
-struct AlignedDeleter {
-    void operator()(void* p) const noexcept {
-#if defined(_MSC_VER)
-        _aligned_free(p);
-#else
-        free(p);
-#endif
-    }
+// 필드 저장소 할당 옵션
+// - policy : 할당 백엔드 (기본 Aligned = 기존 32B 정렬 힙 할당)
+// - parallelFirstTouch : 할당 직후 공용 스레드 풀의 ParallelForStatic 분할로 0 초기화.
+//   Mapped / Aligned 처럼 첫 접근 때 물리 페이지가 잡히는 경우에만 의미가 있다 (LargePages 는 할당 시 이미 커밋됨).
+//   스레드 풀 작업자는 코어/노드에 고정되어 있지 않으므로 NUMA 배치는 보장되지 않고, 0 초기화 병렬화 정도로만 본다.
+struct SdfAllocDesc {
+    MemoryPolicy policy = MemoryPolicy::Aligned;
+    bool parallelFirstTouch = false;
+};
+
+// 할당 정책에 맞춰 해제하는 deleter
+struct SdfStorageDeleter {
+    MemoryPolicy policy = MemoryPolicy::Aligned;
+    std::size_t bytes = 0;
+    void operator()(void* p) const noexcept { VirtualMemory::Free(p, bytes, policy); }
+};
+
+// 메모리 레이아웃
+// - Linear : X-최내부 선형 (기본). rowPtr / 삼중 포인터 / data() 직접 사용 가능
+// - Brick4/Brick8 : 4^3/8^3 브릭을 연속 저장, 브릭 내부는 Morton 순서.
+//   3D 이웃(brush, gradient, 셀 코너)이 같은 캐시 라인/페이지에 모인다.
+//   at/row/readRow/writeRow 로 접근하고, 선형 배열이 필요한 곳(MC33, GPU 업로드)은 SdfLinearView 사용
+enum class SdfLayout : uint8_t {
+    Linear,
+    Brick4,
+    Brick8,
 };
 
-// 32B ĵ 迭 unique_ptr 
-template <typename T>
-inline std::unique_ptr<T, AlignedDeleter>
-make_aligned_array(std::size_t n, std::size_t align = 32) {
-    if (n == 0) return { nullptr, AlignedDeleter{} };
-    void* p = nullptr;
-#if defined(_MSC_VER)
-    p = _aligned_malloc(n * sizeof(T), align);
-    if (!p) throw std::bad_alloc();
-#else
-    if (posix_memalign(&p, align, n * sizeof(T)) != 0) throw std::bad_alloc();
-#endif
-    return std::unique_ptr<T, AlignedDeleter>(static_cast<T*>(p));
-}
-
-//  1D ׸ ̳ (X-ֳ, 32B )
+// 연속 1D 그리드 컨테이너 (32B 이상 정렬, 레이아웃/할당 정책 선택 가능)
 template <typename T = float>
 class SdfField {
 public:
     using value_type = T;
 
-    // /Ҹ/̵
+    // 생성/소멸/이동
     SdfField() = default;
-    SdfField(int sx, int sy, int sz) { allocate(sx, sy, sz); }
+    SdfField(int sx, int sy, int sz, SdfLayout layout = SdfLayout::Linear, const SdfAllocDesc& alloc = {}) { allocate(sx, sy, sz, layout, alloc); }
 
     SdfField(const SdfField&) = delete;
     SdfField& operator=(const SdfField&) = delete;
@@ -55,7 +58,7 @@ public:
 
     ~SdfField() { release(); }
 
-    // ũ/
+    // 크기/상태
     int  sx() const noexcept { return Sx_; }
     int  sy() const noexcept { return Sy_; }
     int  sz() const noexcept { return Sz_; }
@@ -63,70 +66,133 @@ public:
     std::size_t size() const noexcept {
         return data_ ? static_cast<std::size_t>(Sx_) * Sy_ * Sz_ : 0;
     }
+    // 실제 저장 원소 수 (브릭 레이아웃은 브릭 단위로 패딩됨)
+    std::size_t storageSize() const noexcept { return data_ ? storage_ : 0; }
     explicit operator bool() const noexcept { return !empty(); }
 
-    // ޸  ------------------------------------------------------------
-    void allocate(int sx, int sy, int sz) {
+    SdfLayout layout() const noexcept { return layout_; }
+    bool isLinear() const noexcept { return brickShift_ == 0; }
+    int  brickSize() const noexcept { return 1 << brickShift_; }
+    // 실제 적용된 할당 정책 (대형 페이지 실패 시 Mapped)
+    MemoryPolicy allocPolicy() const noexcept { return data_.get_deleter().policy; }
+
+    // 메모리 관리 ------------------------------------------------------------
+    void allocate(int sx, int sy, int sz, SdfLayout layout = SdfLayout::Linear, const SdfAllocDesc& alloc = {}) {
         release();
         if (sx <= 0 || sy <= 0 || sz <= 0)
             throw std::invalid_argument("SdfField::allocate: invalid size");
         Sx_ = sx; Sy_ = sy; Sz_ = sz;
+        layout_ = layout;
+        brickShift_ = (layout == SdfLayout::Brick4) ? 2 : (layout == SdfLayout::Brick8) ? 3 : 0;
 
-        const std::size_t n = static_cast<std::size_t>(sx) * sy * sz;
-        data_ = make_aligned_array<T>(n, 32);  // 32-Bytes 
+        if (brickShift_ == 0) {
+            storage_ = static_cast<std::size_t>(sx) * sy * sz;
+        } else {
+            const int b = 1 << brickShift_;
+            Bx_ = (sx + b - 1) >> brickShift_;
+            By_ = (sy + b - 1) >> brickShift_;
+            Bz_ = (sz + b - 1) >> brickShift_;
+            storage_ = (static_cast<std::size_t>(Bx_) * By_ * Bz_) << (3 * brickShift_);
+            buildBrickOffsets();
+        }
+        allocateStorage(alloc);
         buildPointerTables();
     }
 
     void release() noexcept {
-        data_.reset();    // RAII  
+        data_.reset();    // RAII로 안전 해제
         Sx_ = Sy_ = Sz_ = 0;
+        Bx_ = By_ = Bz_ = 0;
+        storage_ = 0;
+        layout_ = SdfLayout::Linear;
+        brickShift_ = 0;
         rowPtrs_.clear();
         zPtrs_.clear();
+        offX_.clear();
+        offY_.clear();
+        offZ_.clear();
     }
 
-    // ü ä: field = 0.0f; (  ä)
+    // 전체 채우기: field = 0.0f; (원소 단위로 채움, 브릭 패딩 포함)
+    // first-touch 와 같은 균등 분할로 병렬 채움 (float 전용 SIMD 경로는 SdfFieldOps::Fill)
     SdfField& operator=(const T& v) noexcept {
         if (!data_) return *this;
         T* p = data_.get();
-        const std::size_t n = size();
-        for (std::size_t i = 0; i < n; ++i) p[i] = v;
+        ThreadPool::Get().ParallelForStatic(0, storage_, [p, &v](std::size_t b, std::size_t e) {
+            std::fill(p + b, p + e, v);
+        });
         return *this;
     }
 
-    // / ----------------------------------------------------------
+    // 데이터/포인터 ----------------------------------------------------------
+    // 저장소 원시 포인터 : 레이아웃 순서 그대로 (X-선형 배열은 Linear 레이아웃에서만 보장)
     inline       T* data()       noexcept { return data_.get(); }
     inline const T* data() const noexcept { return data_.get(); }
 
-    //  ε (X-)
+    // 선형 인덱스 (X-연속)
     static inline std::size_t idx_linear(int x, int y, int z, int Sx, int Sy) noexcept {
         return static_cast<std::size_t>(z) * static_cast<std::size_t>(Sy) * static_cast<std::size_t>(Sx)
             + static_cast<std::size_t>(y) * static_cast<std::size_t>(Sx)
             + static_cast<std::size_t>(x);
     }
+    // 레이아웃에 따른 저장소 인덱스
     inline std::size_t idx(int x, int y, int z) const noexcept {
-        return idx_linear(x, y, z, Sx_, Sy_);
+        if (brickShift_ == 0) return idx_linear(x, y, z, Sx_, Sy_);
+        return idx_brick(x, y, z);
     }
-    // Ŭ  ε( )
+    // 클램프된 선형 인덱스(삼항 연산자)
     inline std::size_t idx_clamed(int x, int y, int z) const noexcept {
         x = (x < 0) ? 0 : ((x >= Sx_) ? (Sx_ - 1) : x);
         y = (y < 0) ? 0 : ((y >= Sy_) ? (Sy_ - 1) : y);
         z = (z < 0) ? 0 : ((z >= Sz_) ? (Sz_ - 1) : z);
-        return idx_linear(x, y, z, Sx_, Sy_);
+        return idx(x, y, z);
     }
 
-    //  
+    // 명시적 접근
     inline       T& at(int x, int y, int z)       noexcept { return data_.get()[idx(x, y, z)]; }
     inline const T& at(int x, int y, int z) const noexcept { return data_.get()[idx(x, y, z)]; }
 
-    // Ŭ 
+    // 클램프 접근
     inline       T& at_clamped(int x, int y, int z)       noexcept { return data_.get()[idx_clamed(x, y, z)]; }
     inline const T& at_clamped(int x, int y, int z) const noexcept { return data_.get()[idx_clamed(x, y, z)]; }
 
-    //  (X-  SIMD ģȭ)
-    inline       T* rowPtr(int y, int z)       noexcept { return data_.get() + idx(0, y, z); }
-    inline const T* rowPtr(int y, int z) const noexcept { return data_.get() + idx(0, y, z); }
+    // 행 포인터(X-연속 → SIMD 친화). Linear 레이아웃 전용 (브릭 레이아웃은 nullptr)
+    inline       T* rowPtr(int y, int z)       noexcept { return isLinear() ? data_.get() + idx_linear(0, y, z, Sx_, Sy_) : nullptr; }
+    inline const T* rowPtr(int y, int z) const noexcept { return isLinear() ? data_.get() + idx_linear(0, y, z, Sx_, Sy_) : nullptr; }
+
+    // 레이아웃 무관 행 접근자 : field.row(y, z)[x]
+    // Linear는 행 포인터로, 브릭 레이아웃은 at()으로 접근
+    template <typename F, typename V>
+    struct RowRefT {
+        V* base; F* f; int y; int z;
+        inline V& operator[](int x) const noexcept { return base ? base[x] : f->at(x, y, z); }
+    };
+    using RowRef = RowRefT<SdfField, T>;
+    using ConstRowRef = RowRefT<const SdfField, const T>;
+    inline RowRef      row(int y, int z)       noexcept { return RowRef{ rowPtr(y, z), this, y, z }; }
+    inline ConstRowRef row(int y, int z) const noexcept { return ConstRowRef{ rowPtr(y, z), this, y, z }; }
+
+    // 행 구간 [x0, x0 + count) 을 X-연속 버퍼로 읽기/쓰기 (범위는 필드 내부여야 함)
+    void readRow(int y, int z, int x0, int count, T* dst) const noexcept {
+        if (isLinear()) {
+            std::memcpy(dst, rowPtr(y, z) + x0, sizeof(T) * static_cast<std::size_t>(count));
+            return;
+        }
+        forEachBrickSegment(y, z, x0, count, [&](std::size_t brickBase, int lx0, int n, int i) {
+            for (int k = 0; k < n; ++k) dst[i + k] = data_.get()[brickBase | kMortonSpread[lx0 + k]];
+        });
+    }
+    void writeRow(int y, int z, int x0, int count, const T* src) noexcept {
+        if (isLinear()) {
+            std::memcpy(rowPtr(y, z) + x0, src, sizeof(T) * static_cast<std::size_t>(count));
+            return;
+        }
+        forEachBrickSegment(y, z, x0, count, [&](std::size_t brickBase, int lx0, int n, int i) {
+            for (int k = 0; k < n; ++k) data_.get()[brickBase | kMortonSpread[lx0 + k]] = src[i + k];
+        });
+    }
 
-    // 3 ȣ : field[z][y][x]
+    // 3중 대괄호 접근: field[z][y][x]
     struct YProxy {
         SdfField* f; int y; int z;
         inline       T& operator[](int x)       noexcept { return f->at(x, y, z); }
@@ -140,6 +206,7 @@ public:
     inline ZProxy operator[](int z) noexcept { return ZProxy{ this, z }; }
     inline const ZProxy operator[](int z) const noexcept { return ZProxy{ const_cast<SdfField*>(this), z }; }
 
+    // 삼중 포인터 (MC33 인터페이스). Linear 레이아웃 전용, 그 외는 nullptr -> SdfLinearView 사용
     explicit operator T*** () noexcept {
         return zPtrs_.empty() ? nullptr : zPtrs_.data();
     }
@@ -149,27 +216,95 @@ public:
             : reinterpret_cast<const T* const* const*>(zPtrs_.data());
     }
 
-    // Ҵ   ̺ 籸ϰ  
+    // 재할당 없이 포인터 테이블만 재구성하고 싶을 때
     void rebuildTriplePtr() { buildPointerTables(); }
 
 private:
+    void allocateStorage(const SdfAllocDesc& alloc) {
+        const std::size_t bytes = storage_ * sizeof(T);
+        MemoryPolicy resolved = alloc.policy;
+        T* p = static_cast<T*>(VirtualMemory::Allocate(bytes, 32, alloc.policy, &resolved));  // 최소 32-Bytes 정렬
+        data_ = std::unique_ptr<T, SdfStorageDeleter>(p, SdfStorageDeleter{ resolved, bytes });
+
+        if (alloc.parallelFirstTouch) {
+            ThreadPool::Get().ParallelForStatic(0, storage_, [p](std::size_t b, std::size_t e) {
+                std::fill(p + b, p + e, T{});
+            });
+        }
+    }
+
+    // 브릭 내부 로컬 좌표(3bit)의 Morton 비트 확산 : b2 b1 b0 -> b2 0 0 b1 0 0 b0
+    static constexpr uint16_t kMortonSpread[8] = { 0, 1, 8, 9, 64, 65, 72, 73 };
+
+    // 축별 오프셋 테이블 합으로 계산 (브릭 오프셋 + Morton 로컬 비트는 서로 겹치지 않으므로 덧셈 = 결합)
+    inline std::size_t idx_brick(int x, int y, int z) const noexcept {
+        return offX_[static_cast<std::size_t>(x)] + offY_[static_cast<std::size_t>(y)] + offZ_[static_cast<std::size_t>(z)];
+    }
+
+    void buildBrickOffsets() {
+        const int s = brickShift_;
+        const int m = (1 << s) - 1;
+        offX_.resize(static_cast<std::size_t>(Sx_));
+        offY_.resize(static_cast<std::size_t>(Sy_));
+        offZ_.resize(static_cast<std::size_t>(Sz_));
+        for (int x = 0; x < Sx_; ++x)
+            offX_[x] = (static_cast<std::size_t>(x >> s) << (3 * s)) | kMortonSpread[x & m];
+        for (int y = 0; y < Sy_; ++y)
+            offY_[y] = ((static_cast<std::size_t>(y >> s) * Bx_) << (3 * s)) | (static_cast<std::size_t>(kMortonSpread[y & m]) << 1);
+        for (int z = 0; z < Sz_; ++z)
+            offZ_[z] = ((static_cast<std::size_t>(z >> s) * Bx_ * By_) << (3 * s)) | (static_cast<std::size_t>(kMortonSpread[z & m]) << 2);
+    }
+
+    // 행 구간을 브릭 경계로 나눠 fn(브릭 기준 인덱스(y,z 비트 포함), 브릭 내 시작 x, 개수, 출력 오프셋) 호출
+    template <typename Fn>
+    void forEachBrickSegment(int y, int z, int x0, int count, Fn&& fn) const noexcept {
+        const int s = brickShift_;
+        const int b = 1 << s;
+        const int m = b - 1;
+        const std::size_t yz = (kMortonSpread[y & m] << 1) | (kMortonSpread[z & m] << 2);
+        const std::size_t rowBrick = (static_cast<std::size_t>(z >> s) * By_ + static_cast<std::size_t>(y >> s)) * Bx_;
+        for (int i = 0; i < count;) {
+            const int x = x0 + i;
+            const int lx = x & m;
+            const int n = (b - lx < count - i) ? (b - lx) : (count - i);
+            fn(((rowBrick + static_cast<std::size_t>(x >> s)) << (3 * s)) | yz, lx, n, i);
+            i += n;
+        }
+    }
+
     int Sx_{ 0 }, Sy_{ 0 }, Sz_{ 0 };
-    std::unique_ptr<T, AlignedDeleter> data_{ nullptr, AlignedDeleter{} };
+    int Bx_{ 0 }, By_{ 0 }, Bz_{ 0 };   // 축별 브릭 수 (브릭 레이아웃)
+    std::size_t storage_{ 0 };
+    SdfLayout layout_{ SdfLayout::Linear };
+    int brickShift_{ 0 };               // 0 : Linear, 2 : 4^3, 3 : 8^3
+    std::vector<std::size_t> offX_, offY_, offZ_;   // 축별 저장소 오프셋 (브릭 레이아웃)
+    std::unique_ptr<T, SdfStorageDeleter> data_{ nullptr, SdfStorageDeleter{} };
 
-    //  ̺ (  : /̽ ͸ )
-    std::vector<T*>  rowPtrs_;  // [Sz*Sy] :  (z,y)    &data_[z,y,0]
-    std::vector<T**> zPtrs_;    // [Sz]    :  z  迭  ּ &rowPtrs_[z*Sy]
+    // 포인터 테이블 (데이터 복사 없음: 행/슬라이스 포인터만 저장)
+    std::vector<T*>  rowPtrs_;  // [Sz*Sy] : 각 (z,y)의 행 시작 포인터 &data_[z,y,0]
+    std::vector<T**> zPtrs_;    // [Sz]    : 각 z의 행 배열 시작 주소 &rowPtrs_[z*Sy]
 
     void moveFrom(SdfField&& r) noexcept {
         Sx_ = r.Sx_; Sy_ = r.Sy_; Sz_ = r.Sz_;
+        Bx_ = r.Bx_; By_ = r.By_; Bz_ = r.Bz_;
+        storage_ = r.storage_;
+        layout_ = r.layout_;
+        brickShift_ = r.brickShift_;
+        offX_ = std::move(r.offX_);
+        offY_ = std::move(r.offY_);
+        offZ_ = std::move(r.offZ_);
         data_ = std::move(r.data_);
         rowPtrs_ = std::move(r.rowPtrs_);
         zPtrs_ = std::move(r.zPtrs_);
         r.Sx_ = r.Sy_ = r.Sz_ = 0;
+        r.Bx_ = r.By_ = r.Bz_ = 0;
+        r.storage_ = 0;
+        r.layout_ = SdfLayout::Linear;
+        r.brickShift_ = 0;
     }
 
     void buildPointerTables() {
-        if (!data_) { rowPtrs_.clear(); zPtrs_.clear(); return; }
+        if (!data_ || !isLinear()) { rowPtrs_.clear(); zPtrs_.clear(); return; }
         rowPtrs_.resize(static_cast<std::size_t>(Sy_) * static_cast<std::size_t>(Sz_));
         zPtrs_.resize(static_cast<std::size_t>(Sz_));
         for (int z = 0; z < Sz_; ++z) {
@@ -178,4 +313,43 @@ private:
             for (int y = 0; y < Sy_; ++y) rows[static_cast<std::size_t>(y)] = rowPtr(y, z);
         }
     }
-};
\ No newline at end of file
+};
+
+// X-선형 배열 / 삼중 포인터 변환 뷰 (MC33, GPU 업로드 등 선형 배열을 요구하는 인터페이스용)
+// - Linear 필드 전체 : 복사 없이 원본을 가리킴
+// - 브릭 레이아웃 또는 부분 영역 : 선형 사본 생성 (영역은 필드 내부여야 함)
+template <typename T = float>
+class SdfLinearView {
+public:
+    explicit SdfLinearView(const SdfField<T>& src)
+        : SdfLinearView(src, 0, 0, 0, src.sx(), src.sy(), src.sz()) {}
+
+    SdfLinearView(const SdfField<T>& src, int x0, int y0, int z0, int nx, int ny, int nz) {
+        const bool whole = (x0 == 0 && y0 == 0 && z0 == 0 && nx == src.sx() && ny == src.sy() && nz == src.sz());
+        if (src.isLinear() && whole) {
+            view_ = const_cast<SdfField<T>*>(&src);
+            return;
+        }
+        copy_.allocate(nx, ny, nz);
+        for (int z = 0; z < nz; ++z)
+            for (int y = 0; y < ny; ++y)
+                src.readRow(y0 + y, z0 + z, x0, nx, copy_.rowPtr(y, z));
+        view_ = &copy_;
+    }
+
+    SdfLinearView(const SdfLinearView&) = delete;
+    SdfLinearView& operator=(const SdfLinearView&) = delete;
+
+    bool aliased() const noexcept { return view_ != &copy_; }
+    int  sx() const noexcept { return view_->sx(); }
+    int  sy() const noexcept { return view_->sy(); }
+    int  sz() const noexcept { return view_->sz(); }
+    const T* data() const noexcept { return view_->data(); }
+    const T* rowPtr(int y, int z) const noexcept { return view_->rowPtr(y, z); }
+
+    explicit operator T*** () noexcept { return static_cast<T***>(*view_); }
+
+private:
+    SdfField<T>* view_ = nullptr;
+    SdfField<T>  copy_;
+};
@@ -0,0 +1,282 @@
+#include "pch.h"
+#include "SdfFieldOps.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	// 저장소 원소 단위 병렬 분할 크기 (페이지 여러 장 단위)
+	constexpr size_t kElementGrain = size_t(1) << 16;
+
+	// Reduce 의 z 슬랩 분할 크기. 부분 합을 슬랩 번호 순서로 합치므로 스레드 수/스케줄과 무관하게 sum 이 같다
+	constexpr size_t kReduceSlabGrain = 4;
+
+	struct RowStats
+	{
+		float mn = FLT_MAX;
+		float mx = -FLT_MAX;
+		double sum = 0.0;
+	};
+
+	void AccumulateRow(const float* p, int n, RowStats& s)
+	{
+		int i = 0;
+#if defined(__AVX2__)
+		if (n >= 8)
+		{
+			__m256 vmin = _mm256_set1_ps(FLT_MAX);
+			__m256 vmax = _mm256_set1_ps(-FLT_MAX);
+			__m256 vsum = _mm256_setzero_ps();
+			for (; i + 8 <= n; i += 8)
+			{
+				const __m256 v = _mm256_loadu_ps(p + i);
+				vmin = _mm256_min_ps(vmin, v);
+				vmax = _mm256_max_ps(vmax, v);
+				vsum = _mm256_add_ps(vsum, v);
+			}
+			alignas(32) float lmin[8], lmax[8], lsum[8];
+			_mm256_store_ps(lmin, vmin);
+			_mm256_store_ps(lmax, vmax);
+			_mm256_store_ps(lsum, vsum);
+			for (int k = 0; k < 8; ++k)
+			{
+				s.mn = std::min(s.mn, lmin[k]);
+				s.mx = std::max(s.mx, lmax[k]);
+				s.sum += lsum[k];
+			}
+		}
+#endif
+		for (; i < n; ++i)
+		{
+			s.mn = std::min(s.mn, p[i]);
+			s.mx = std::max(s.mx, p[i]);
+			s.sum += p[i];
+		}
+	}
+
+	// v = v * scale + bias 후 [lo, hi] 클램프 (클램프 불필요 시 lo/hi = -+FLT_MAX)
+	void ScaleBiasClampSpan(float* p, size_t n, float scale, float bias, float lo, float hi)
+	{
+		size_t i = 0;
+#if defined(__AVX2__)
+		const __m256 vs = _mm256_set1_ps(scale);
+		const __m256 vb = _mm256_set1_ps(bias);
+		const __m256 vlo = _mm256_set1_ps(lo);
+		const __m256 vhi = _mm256_set1_ps(hi);
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 v = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(p + i), vs), vb);
+			v = _mm256_min_ps(_mm256_max_ps(v, vlo), vhi);
+			_mm256_storeu_ps(p + i, v);
+		}
+#endif
+		for (; i < n; ++i) p[i] = std::min(std::max(p[i] * scale + bias, lo), hi);
+	}
+
+	template <typename Fn>
+	void ForEachStorageSpan(SdfField<float>& field, Fn&& fn)
+	{
+		float* p = field.data();
+		const size_t n = field.storageSize();
+		if (!p || n == 0) return;
+
+		const size_t blocks = (n + kElementGrain - 1) / kElementGrain;
+		ThreadPool::Get().ParallelForStatic(0, blocks, [&](size_t bBegin, size_t bEnd) {
+			const size_t b = bBegin * kElementGrain;
+			const size_t e = std::min(bEnd * kElementGrain, n);
+			fn(p + b, e - b);
+		});
+	}
+
+	inline float Lerp(float a, float b, float t) { return a + (b - a) * t; }
+}
+
+namespace SdfFieldOps
+{
+	void Fill(SdfField<float>& field, float value)
+	{
+		ForEachStorageSpan(field, [value](float* p, size_t n) {
+			size_t i = 0;
+#if defined(__AVX2__)
+			const __m256 v = _mm256_set1_ps(value);
+			for (; i + 8 <= n; i += 8) _mm256_storeu_ps(p + i, v);
+#endif
+			for (; i < n; ++i) p[i] = value;
+		});
+	}
+
+	void CopyRegion(const SdfField<float>& src, const DirectX::XMINT3& srcMin, SdfField<float>& dst, const DirectX::XMINT3& dstMin, const DirectX::XMINT3& size)
+	{
+		// 두 필드 모두의 범위로 클리핑 (음수 시작은 양쪽을 같이 이동)
+		int s[3] = { srcMin.x, srcMin.y, srcMin.z };
+		int d[3] = { dstMin.x, dstMin.y, dstMin.z };
+		int n[3] = { size.x, size.y, size.z };
+		const int srcDim[3] = { src.sx(), src.sy(), src.sz() };
+		const int dstDim[3] = { dst.sx(), dst.sy(), dst.sz() };
+		for (int a = 0; a < 3; ++a)
+		{
+			const int shift = std::max({ 0, -s[a], -d[a] });
+			s[a] += shift;
+			d[a] += shift;
+			n[a] = std::min({ n[a] - shift, srcDim[a] - s[a], dstDim[a] - d[a] });
+			if (n[a] <= 0) return;
+		}
+
+		const bool direct = src.isLinear() && dst.isLinear();
+		ThreadPool::Get().ParallelForStatic(0, n[2], [&](size_t zBegin, size_t zEnd) {
+			std::vector<float> buffer(direct ? 0 : static_cast<size_t>(n[0]));
+			for (int z = static_cast<int>(zBegin); z < static_cast<int>(zEnd); ++z)
+			{
+				for (int y = 0; y < n[1]; ++y)
+				{
+					if (direct)
+					{
+						std::memcpy(dst.rowPtr(d[1] + y, d[2] + z) + d[0], src.rowPtr(s[1] + y, s[2] + z) + s[0], sizeof(float) * n[0]);
+						continue;
+					}
+					src.readRow(s[1] + y, s[2] + z, s[0], n[0], buffer.data());
+					dst.writeRow(d[1] + y, d[2] + z, d[0], n[0], buffer.data());
+				}
+			}
+		});
+	}
+
+	SdfFieldStats Reduce(const SdfField<float>& field)
+	{
+		return Reduce(field, { 0, 0, 0 }, { field.sx(), field.sy(), field.sz() });
+	}
+
+	SdfFieldStats Reduce(const SdfField<float>& field, const DirectX::XMINT3& regionMin, const DirectX::XMINT3& regionMax)
+	{
+		const DirectX::XMINT3 lo = { std::max(regionMin.x, 0), std::max(regionMin.y, 0), std::max(regionMin.z, 0) };
+		const DirectX::XMINT3 hi = { std::min(regionMax.x, field.sx()), std::min(regionMax.y, field.sy()), std::min(regionMax.z, field.sz()) };
+		SdfFieldStats out{};
+		if (field.empty() || lo.x >= hi.x || lo.y >= hi.y || lo.z >= hi.z) return out;
+
+		const int nx = hi.x - lo.x;
+		const size_t nz = static_cast<size_t>(hi.z - lo.z);
+		std::vector<RowStats> partial((nz + kReduceSlabGrain - 1) / kReduceSlabGrain);
+
+		ThreadPool::Get().ParallelForIndexed(lo.z, hi.z, kReduceSlabGrain, [&](uint32_t, size_t zBegin, size_t zEnd) {
+			RowStats local{};
+			std::vector<float> buffer(field.isLinear() ? 0 : static_cast<size_t>(nx));
+			for (int z = static_cast<int>(zBegin); z < static_cast<int>(zEnd); ++z)
+			{
+				for (int y = lo.y; y < hi.y; ++y)
+				{
+					const float* row = nullptr;
+					if (field.isLinear())
+					{
+						row = field.rowPtr(y, z) + lo.x;
+					}
+					else
+					{
+						field.readRow(y, z, lo.x, nx, buffer.data());
+						row = buffer.data();
+					}
+					AccumulateRow(row, nx, local);
+				}
+			}
+			partial[(zBegin - lo.z) / kReduceSlabGrain] = local;
+		});
+
+		RowStats total{};
+		for (size_t i = 0; i < partial.size(); ++i)
+		{
+			total.mn = std::min(total.mn, partial[i].mn);
+			total.mx = std::max(total.mx, partial[i].mx);
+			total.sum += partial[i].sum;
+		}
+		out.minValue = total.mn;
+		out.maxValue = total.mx;
+		out.sum = total.sum;
+		out.count = static_cast<size_t>(nx) * (hi.y - lo.y) * (hi.z - lo.z);
+		return out;
+	}
+
+	void Clamp(SdfField<float>& field, float lo, float hi)
+	{
+		ForEachStorageSpan(field, [lo, hi](float* p, size_t n) { ScaleBiasClampSpan(p, n, 1.0f, 0.0f, lo, hi); });
+	}
+
+	void Remap(SdfField<float>& field, float inLo, float inHi, float outLo, float outHi)
+	{
+		const float inRange = inHi - inLo;
+		const float scale = (std::fabs(inRange) > FLT_EPSILON) ? (outHi - outLo) / inRange : 0.0f;
+		const float bias = outLo - inLo * scale;
+		ForEachStorageSpan(field, [scale, bias](float* p, size_t n) { ScaleBiasClampSpan(p, n, scale, bias, -FLT_MAX, FLT_MAX); });
+	}
+
+	void Resample(const SdfField<float>& src, SdfField<float>& dst)
+	{
+		if (src.empty() || dst.empty()) return;
+
+		auto axisScale = [](int srcN, int dstN) { return (dstN > 1) ? static_cast<float>(srcN - 1) / static_cast<float>(dstN - 1) : 0.0f; };
+		const float scale[3] = { axisScale(src.sx(), dst.sx()), axisScale(src.sy(), dst.sy()), axisScale(src.sz(), dst.sz()) };
+
+		// x 방향 보간 계수는 모든 행에서 같으므로 미리 계산
+		std::vector<int> x0(dst.sx());
+		std::vector<float> tx(dst.sx());
+		for (int x = 0; x < dst.sx(); ++x)
+		{
+			const float u = x * scale[0];
+			x0[x] = std::min(static_cast<int>(u), std::max(src.sx() - 2, 0));
+			tx[x] = u - x0[x];
+		}
+
+		ThreadPool::Get().ParallelForStatic(0, dst.sz(), [&](size_t zBegin, size_t zEnd) {
+			const int srcX = src.sx();
+			std::vector<float> rowZ0(srcX), rowZ1(srcX);
+			// z 보간을 먼저 끝낸 원본 행 2개 (slot 별 원본 y). 대상 y 는 원본 y 를 순서대로 지나므로 원본 행은 대상 z 마다 한 번씩만 읽는다
+			std::vector<float> cached[2] = { std::vector<float>(srcX), std::vector<float>(srcX) };
+			int cachedY[2];
+
+			for (int z = static_cast<int>(zBegin); z < static_cast<int>(zEnd); ++z)
+			{
+				const float w = z * scale[2];
+				const int z0 = std::min(static_cast<int>(w), std::max(src.sz() - 2, 0));
+				const int z1 = std::min(z0 + 1, src.sz() - 1);
+				const float tz = w - z0;
+				cachedY[0] = cachedY[1] = -1;
+
+				// 원본 y 행의 z 보간 결과 slot (keepY 를 가진 slot 은 덮어쓰지 않음)
+				auto acquire = [&](int sy, int keepY) -> const float* {
+					for (int s = 0; s < 2; ++s)
+						if (cachedY[s] == sy) return cached[s].data();
+					const int slot = (cachedY[0] == keepY) ? 1 : 0;
+					src.readRow(sy, z0, 0, srcX, rowZ0.data());
+					src.readRow(sy, z1, 0, srcX, rowZ1.data());
+					float* out = cached[slot].data();
+					for (int x = 0; x < srcX; ++x) out[x] = Lerp(rowZ0[x], rowZ1[x], tz);
+					cachedY[slot] = sy;
+					return out;
+				};
+
+				for (int y = 0; y < dst.sy(); ++y)
+				{
+					const float v = y * scale[1];
+					const int y0 = std::min(static_cast<int>(v), std::max(src.sy() - 2, 0));
+					const int y1 = std::min(y0 + 1, src.sy() - 1);
+					const float ty = v - y0;
+
+					const float* r0 = acquire(y0, y1);
+					const float* r1 = acquire(y1, y0);
+
+					auto row = dst.row(y, z);
+					for (int x = 0; x < dst.sx(); ++x)
+					{
+						const int xa = x0[x];
+						const int xb = std::min(xa + 1, srcX - 1);
+						const float t = tx[x];
+						row[x] = Lerp(Lerp(r0[xa], r0[xb], t), Lerp(r1[xa], r1[xb], t), ty);
+					}
+				}
+			}
+		});
+	}
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/SdfField.h"
+#include "Core/Utils/ThreadPool.h"
+#include <DirectXMath.h>
+
+/*
+* SdfField 벌크 연산 (공용 ThreadPool 병렬 + AVX2 경로)
+* - 영역은 샘플 인덱스 [min, max) (max 미포함), 필드 범위로 클리핑된다.
+* - 병렬 분할은 z 슬랩 ParallelForStatic (first-touch 분할과 일치). 예외로 Reduce 는 고정 크기 z 블록 ParallelForIndexed 로
+*   블록별 부분값을 블록 순서대로 합쳐 스레드 수/스케줄과 무관하게 같은 결과
+* - 원소 단위 연산(Fill/Clamp/Remap)은 레이아웃과 무관하게 저장소 전체에 적용 (브릭 패딩 포함)
+*/
+struct SdfFieldStats
+{
+	float minValue = 0.0f;
+	float maxValue = 0.0f;
+	double sum = 0.0;
+	size_t count = 0;
+
+	double Mean() const { return count ? sum / static_cast<double>(count) : 0.0; }
+};
+
+namespace SdfFieldOps
+{
+	void Fill(SdfField<float>& field, float value);
+
+	// src [srcMin, srcMin + size) -> dst [dstMin, dstMin + size), 두 필드 범위로 클리핑
+	void CopyRegion(const SdfField<float>& src, const DirectX::XMINT3& srcMin, SdfField<float>& dst, const DirectX::XMINT3& dstMin, const DirectX::XMINT3& size);
+
+	SdfFieldStats Reduce(const SdfField<float>& field);
+	SdfFieldStats Reduce(const SdfField<float>& field, const DirectX::XMINT3& regionMin, const DirectX::XMINT3& regionMax);
+
+	void Clamp(SdfField<float>& field, float lo, float hi);
+	// [inLo, inHi] -> [outLo, outHi] 선형 변환 (클램프 없음)
+	void Remap(SdfField<float>& field, float inLo, float inHi, float outLo, float outHi);
+
+	// src 전체를 dst 해상도로 trilinear 재샘플 (양 끝 샘플 정렬 : dst(0) = src(0), dst(N-1) = src(M-1))
+	void Resample(const SdfField<float>& src, SdfField<float>& dst);
+
+	// 영역의 각 샘플에 fn(x, y, z, float& value) 적용
+	template <typename Fn>
+	void ApplyRegion(SdfField<float>& field, DirectX::XMINT3 regionMin, DirectX::XMINT3 regionMax, Fn&& fn)
+	{
+		regionMin = { std::max(regionMin.x, 0), std::max(regionMin.y, 0), std::max(regionMin.z, 0) };
+		regionMax = { std::min(regionMax.x, field.sx()), std::min(regionMax.y, field.sy()), std::min(regionMax.z, field.sz()) };
+		if (regionMin.x >= regionMax.x || regionMin.y >= regionMax.y || regionMin.z >= regionMax.z) return;
+
+		ThreadPool::Get().ParallelForStatic(regionMin.z, regionMax.z, [&](size_t zBegin, size_t zEnd) {
+			for (int z = static_cast<int>(zBegin); z < static_cast<int>(zEnd); ++z)
+			{
+				for (int y = regionMin.y; y < regionMax.y; ++y)
+				{
+					auto row = field.row(y, z);
+					for (int x = regionMin.x; x < regionMax.x; ++x) fn(x, y, z, row[x]);
+				}
+			}
+		});
+	}
+}
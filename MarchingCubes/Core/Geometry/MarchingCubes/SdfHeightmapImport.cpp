@@ -0,0 +1,404 @@
+#include "pch.h"
+#include "SdfHeightmapImport.h"
+#include "Core/Utils/ThreadPool.h"
+#include <algorithm>
+#include <cctype>
+#include <cfloat>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	using SdfHeightmapImport::Format;
+	using SdfHeightmapImport::Source;
+
+	// 행 단위 임의 접근 리더 (헤더만 해석하고 데이터는 요청한 행만 읽음)
+	class HeightmapReader
+	{
+	public:
+		explicit HeightmapReader(const Source& source)
+		{
+			m_file.open(source.path, std::ios::binary);
+			if (!m_file) throw std::runtime_error("SdfHeightmapImport: cannot open " + source.path.string());
+
+			Format format = source.format;
+			if (format == Format::Auto)
+			{
+				std::string ext = source.path.extension().string();
+				std::transform(ext.begin(), ext.end(), ext.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+				format = (ext == ".pgm") ? Format::PGM : Format::Raw16;
+			}
+
+			if (format == Format::PGM) parsePGMHeader();
+			else openRaw16(source);
+
+			if (m_width == 0 || m_height == 0) throw std::runtime_error("SdfHeightmapImport: empty heightmap");
+		}
+
+		uint32_t width() const { return m_width; }
+		uint32_t height() const { return m_height; }
+		size_t rowBytes() const { return static_cast<size_t>(m_width) * m_bytesPerSample; }
+
+		void readRows(uint32_t row, uint32_t count, std::vector<uint8_t>& outBytes)
+		{
+			outBytes.resize(rowBytes() * count);
+			m_file.seekg(m_dataOffset + static_cast<std::streamoff>(rowBytes() * row));
+			m_file.read(reinterpret_cast<char*>(outBytes.data()), static_cast<std::streamsize>(outBytes.size()));
+			if (!m_file) throw std::runtime_error("SdfHeightmapImport: unexpected end of file");
+		}
+
+		// 정규화 높이 (0..1)
+		void decodeRow(const uint8_t* bytes, float* out) const
+		{
+			if (m_bytesPerSample == 1)
+			{
+				for (uint32_t x = 0; x < m_width; ++x) out[x] = bytes[x] * m_invMax;
+				return;
+			}
+			const int hiByte = m_bigEndian ? 0 : 1;
+			for (uint32_t x = 0; x < m_width; ++x)
+			{
+				const uint8_t* p = bytes + 2 * x;
+				out[x] = static_cast<float>((p[hiByte] << 8) | p[1 - hiByte]) * m_invMax;
+			}
+		}
+
+	private:
+		void openRaw16(const Source& source)
+		{
+			const uint64_t size = std::filesystem::file_size(source.path);
+			m_bytesPerSample = 2;
+			m_bigEndian = source.rawBigEndian;
+			m_invMax = 1.0f / 65535.0f;
+			m_dataOffset = 0;
+
+			m_width = source.rawWidth;
+			m_height = source.rawHeight;
+			if (m_width == 0 || m_height == 0)
+			{
+				const uint64_t samples = size / 2;
+				const uint64_t side = static_cast<uint64_t>(std::llround(std::sqrt(static_cast<double>(samples))));
+				if (side * side != samples || size % 2 != 0)
+					throw std::runtime_error("SdfHeightmapImport: raw size is not a square 16-bit image, pass rawWidth/rawHeight");
+				m_width = m_height = static_cast<uint32_t>(side);
+			}
+			if (static_cast<uint64_t>(m_width) * m_height * 2 > size)
+				throw std::runtime_error("SdfHeightmapImport: raw file is smaller than rawWidth * rawHeight * 2");
+		}
+
+		// 공백/주석(#...) 을 건너뛰고 다음 정수
+		uint32_t readHeaderInt()
+		{
+			int c = m_file.get();
+			while (c != EOF && (std::isspace(c) || c == '#'))
+			{
+				if (c == '#') while (c != EOF && c != '\n') c = m_file.get();
+				c = m_file.get();
+			}
+			if (c == EOF || !std::isdigit(c)) throw std::runtime_error("SdfHeightmapImport: malformed PGM header");
+
+			uint64_t v = 0;
+			while (c != EOF && std::isdigit(c))
+			{
+				v = v * 10 + static_cast<uint64_t>(c - '0');
+				if (v > UINT32_MAX) throw std::runtime_error("SdfHeightmapImport: malformed PGM header");
+				c = m_file.get();
+			}
+			// 숫자 뒤 공백 한 글자는 소비된 상태 (maxval 뒤 공백 1개 다음이 데이터)
+			if (c != EOF && !std::isspace(c)) throw std::runtime_error("SdfHeightmapImport: malformed PGM header");
+			return static_cast<uint32_t>(v);
+		}
+
+		void parsePGMHeader()
+		{
+			char magic[2] = {};
+			m_file.read(magic, 2);
+			if (!m_file || magic[0] != 'P' || magic[1] != '5')
+				throw std::runtime_error("SdfHeightmapImport: only binary PGM (P5) is supported");
+
+			m_width = readHeaderInt();
+			m_height = readHeaderInt();
+			const uint32_t maxValue = readHeaderInt();
+			if (maxValue == 0 || maxValue > 65535) throw std::runtime_error("SdfHeightmapImport: invalid PGM maxval");
+
+			m_bytesPerSample = (maxValue < 256) ? 1 : 2;
+			m_bigEndian = true;
+			m_invMax = 1.0f / static_cast<float>(maxValue);
+			m_dataOffset = m_file.tellg();
+		}
+
+	private:
+		std::ifstream m_file;
+		uint32_t m_width = 0;
+		uint32_t m_height = 0;
+		uint32_t m_bytesPerSample = 2;
+		bool m_bigEndian = false;
+		float m_invMax = 1.0f;
+		std::streamoff m_dataOffset = 0;
+	};
+
+	// 출력 샘플마다 입력 [first, first + count) 의 가중치
+	struct AxisTaps
+	{
+		std::vector<uint32_t> first;
+		std::vector<uint32_t> count;
+		std::vector<uint32_t> offset;	// weights 시작 위치
+		std::vector<float> weights;
+	};
+
+	// 양 끝 정렬 (out 0 -> in 0, out N-1 -> in M-1). 입력이 더 촘촘하면 간격 폭 박스, 아니면 선형 보간
+	AxisTaps BuildTaps(int outCount, uint32_t inCount)
+	{
+		AxisTaps taps;
+		taps.first.resize(outCount);
+		taps.count.resize(outCount);
+		taps.offset.resize(outCount);
+
+		const float ratio = (outCount > 1) ? static_cast<float>(inCount - 1) / static_cast<float>(outCount - 1) : 0.0f;
+		const int last = static_cast<int>(inCount) - 1;
+		for (int o = 0; o < outCount; ++o)
+		{
+			const float c = o * ratio;
+			taps.offset[o] = static_cast<uint32_t>(taps.weights.size());
+			if (ratio <= 1.0f || last == 0)
+			{
+				const int i0 = std::clamp(static_cast<int>(std::floor(c)), 0, std::max(last - 1, 0));
+				const float t = std::clamp(c - i0, 0.0f, 1.0f);
+				taps.first[o] = static_cast<uint32_t>(i0);
+				if (last == 0)
+				{
+					taps.count[o] = 1;
+					taps.weights.push_back(1.0f);
+				}
+				else
+				{
+					taps.count[o] = 2;
+					taps.weights.push_back(1.0f - t);
+					taps.weights.push_back(t);
+				}
+			}
+			else
+			{
+				const int lo = std::clamp(static_cast<int>(std::ceil(c - 0.5f * ratio)), 0, last);
+				const int hi = std::clamp(static_cast<int>(std::floor(c + 0.5f * ratio)), lo, last);
+				taps.first[o] = static_cast<uint32_t>(lo);
+				taps.count[o] = static_cast<uint32_t>(hi - lo + 1);
+				taps.weights.insert(taps.weights.end(), taps.count[o], 1.0f / static_cast<float>(hi - lo + 1));
+			}
+		}
+		return taps;
+	}
+
+	// out[o] = sum(w * in[first + k]) * scale + bias
+	void ResampleRow(const float* in, const AxisTaps& taps, float scale, float bias, float* out)
+	{
+		const size_t n = taps.first.size();
+		for (size_t o = 0; o < n; ++o)
+		{
+			const float* src = in + taps.first[o];
+			const float* w = taps.weights.data() + taps.offset[o];
+			float acc = 0.0f;
+			for (uint32_t k = 0; k < taps.count[o]; ++k) acc += src[k] * w[k];
+			out[o] = acc * scale + bias;
+		}
+	}
+
+	// out = sum(weights[k] * rows[k])
+	void CombineRows(const float* const* rows, const float* weights, uint32_t rowCount, int n, float* out)
+	{
+		int i = 0;
+#if defined(__AVX2__)
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 acc = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i), _mm256_set1_ps(weights[0]));
+			for (uint32_t k = 1; k < rowCount; ++k)
+				acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(rows[k] + i), _mm256_set1_ps(weights[k])));
+			_mm256_storeu_ps(out + i, acc);
+		}
+#endif
+		for (; i < n; ++i)
+		{
+			float acc = rows[0][i] * weights[0];
+			for (uint32_t k = 1; k < rowCount; ++k) acc += rows[k][i] * weights[k];
+			out[i] = acc;
+		}
+	}
+
+	struct EvalParams
+	{
+		float y = 0.0f;				// 행의 월드 높이
+		float cap = 0.0f;
+		float valueScale = 1.0f;
+		float lo = -FLT_MAX;		// 필드 값 클램프
+		float hi = FLT_MAX;
+	};
+
+	// 수직 거리 f = h - y. 파낸 구간 [h - cap - d, h - cap] 은 그 구간 밖까지의 거리로 음수
+	void EvaluateRow(const float* height, const float* undercut, const EvalParams& p, int n, float* out)
+	{
+		int i = 0;
+#if defined(__AVX2__)
+		const __m256 vy = _mm256_set1_ps(p.y);
+		const __m256 vcap = _mm256_set1_ps(p.cap);
+		const __m256 vscale = _mm256_set1_ps(p.valueScale);
+		const __m256 vlo = _mm256_set1_ps(p.lo);
+		const __m256 vhi = _mm256_set1_ps(p.hi);
+		const __m256 zero = _mm256_setzero_ps();
+		for (; i + 8 <= n; i += 8)
+		{
+			const __m256 h = _mm256_loadu_ps(height + i);
+			__m256 f = _mm256_sub_ps(h, vy);
+			if (undercut)
+			{
+				const __m256 d = _mm256_loadu_ps(undercut + i);
+				const __m256 top = _mm256_sub_ps(h, vcap);
+				const __m256 bottom = _mm256_sub_ps(top, d);
+				const __m256 cavity = _mm256_max_ps(_mm256_sub_ps(bottom, vy), _mm256_sub_ps(vy, top));
+				f = _mm256_blendv_ps(f, _mm256_min_ps(f, cavity), _mm256_cmp_ps(d, zero, _CMP_GT_OQ));
+			}
+			f = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(f, vscale), vlo), vhi);
+			_mm256_storeu_ps(out + i, f);
+		}
+#endif
+		for (; i < n; ++i)
+		{
+			float f = height[i] - p.y;
+			if (undercut && undercut[i] > 0.0f)
+			{
+				const float top = height[i] - p.cap;
+				const float bottom = top - undercut[i];
+				f = std::min(f, std::max(bottom - p.y, p.y - top));
+			}
+			out[i] = std::min(std::max(f * p.valueScale, p.lo), p.hi);
+		}
+	}
+}
+
+namespace SdfHeightmapImport
+{
+	void ReadInfo(const Source& source, uint32_t& outWidth, uint32_t& outHeight)
+	{
+		HeightmapReader reader(source);
+		outWidth = reader.width();
+		outHeight = reader.height();
+	}
+
+	void Import(const Source& source, const GridDesc& grid, SdfField<float>& field, const Desc& desc, Stats* outStats, SdfLayout layout)
+	{
+		HeightmapReader reader(source);
+		std::unique_ptr<HeightmapReader> mask;
+		if (!desc.overhangMask.path.empty() && desc.overhangDepth > 0.0f)
+		{
+			mask = std::make_unique<HeightmapReader>(desc.overhangMask);
+			if (mask->width() != reader.width() || mask->height() != reader.height())
+				throw std::runtime_error("SdfHeightmapImport: overhang mask size differs from heightmap");
+		}
+
+		const int sx = static_cast<int>(grid.cells.x) + 1;
+		const int sy = static_cast<int>(grid.cells.y) + 1;
+		const int sz = static_cast<int>(grid.cells.z) + 1;
+		if (field.sx() != sx || field.sy() != sy || field.sz() != sz)
+			field.allocate(sx, sy, sz, layout);
+
+		const uint32_t width = reader.width();
+		const AxisTaps xTaps = BuildTaps(sx, width);
+		const AxisTaps zTaps = BuildTaps(sz, reader.height());
+
+		EvalParams eval{ .cap = desc.overhangCap, .valueScale = desc.valueScale };
+		if (desc.clampValue > 0.0f)
+		{
+			eval.lo = -desc.clampValue;
+			eval.hi = desc.clampValue;
+		}
+
+		ThreadPool& pool = ThreadPool::Get();
+		const int tileRows = std::max(desc.tileRows, 1);
+		std::vector<uint8_t> bytes, maskBytes;
+		std::vector<float> rowsX, maskX;
+		std::vector<float> zMin(static_cast<size_t>(sz)), zMax(static_cast<size_t>(sz));
+		uint64_t rowsRead = 0;
+
+		for (int z0 = 0; z0 < sz; z0 += tileRows)
+		{
+			const int z1 = std::min(z0 + tileRows, sz);
+
+			// 1. 타일이 쓰는 하이트맵 행만 읽기
+			const uint32_t r0 = zTaps.first[z0];
+			const uint32_t r1 = zTaps.first[z1 - 1] + zTaps.count[z1 - 1];
+			const uint32_t rowCount = r1 - r0;
+			reader.readRows(r0, rowCount, bytes);
+			if (mask) mask->readRows(r0, rowCount, maskBytes);
+			rowsRead += rowCount;
+
+			// 2. 행별 디코딩 + x 재샘플 (필드 해상도, 월드 높이)
+			rowsX.resize(static_cast<size_t>(rowCount) * sx);
+			if (mask) maskX.resize(rowsX.size());
+			pool.ParallelFor(0, rowCount, 8, [&](size_t begin, size_t end) {
+				std::vector<float> decoded(width);
+				for (size_t r = begin; r < end; ++r)
+				{
+					reader.decodeRow(bytes.data() + r * reader.rowBytes(), decoded.data());
+					ResampleRow(decoded.data(), xTaps, desc.heightScale, desc.heightOffset, rowsX.data() + r * sx);
+					if (mask)
+					{
+						mask->decodeRow(maskBytes.data() + r * mask->rowBytes(), decoded.data());
+						ResampleRow(decoded.data(), xTaps, desc.overhangDepth, 0.0f, maskX.data() + r * sx);
+					}
+				}
+			});
+
+			// 3. 필드 z 행마다 z 방향 결합 -> 열 높이, 모든 y 행 수직 거리 평가
+			pool.ParallelFor(static_cast<size_t>(z0), static_cast<size_t>(z1), 1, [&](size_t begin, size_t end) {
+				std::vector<float> height(static_cast<size_t>(sx));
+				std::vector<float> undercut(mask ? static_cast<size_t>(sx) : 0);
+				std::vector<float> out(static_cast<size_t>(sx));
+				std::vector<const float*> rows;
+				std::vector<const float*> maskRows;
+
+				for (size_t zs = begin; zs < end; ++zs)
+				{
+					const uint32_t first = zTaps.first[zs] - r0;
+					const uint32_t count = zTaps.count[zs];
+					const float* weights = zTaps.weights.data() + zTaps.offset[zs];
+					rows.resize(count);
+					maskRows.resize(count);
+					for (uint32_t k = 0; k < count; ++k)
+					{
+						rows[k] = rowsX.data() + static_cast<size_t>(first + k) * sx;
+						if (mask) maskRows[k] = maskX.data() + static_cast<size_t>(first + k) * sx;
+					}
+					CombineRows(rows.data(), weights, count, sx, height.data());
+					if (mask) CombineRows(maskRows.data(), weights, count, sx, undercut.data());
+
+					const auto [mn, mx] = std::minmax_element(height.begin(), height.end());
+					zMin[zs] = *mn;
+					zMax[zs] = *mx;
+
+					const int z = static_cast<int>(zs);
+					EvalParams rowEval = eval;
+					for (int y = 0; y < sy; ++y)
+					{
+						rowEval.y = grid.origin.y + y * grid.cellsize;
+						EvaluateRow(height.data(), mask ? undercut.data() : nullptr, rowEval, sx, out.data());
+						field.writeRow(y, z, 0, sx, out.data());
+					}
+				}
+			});
+		}
+
+		if (outStats)
+		{
+			outStats->width = reader.width();
+			outStats->height = reader.height();
+			outStats->minHeight = *std::min_element(zMin.begin(), zMin.end());
+			outStats->maxHeight = *std::max_element(zMax.begin(), zMax.end());
+			outStats->rowsRead = rowsRead;
+		}
+	}
+}
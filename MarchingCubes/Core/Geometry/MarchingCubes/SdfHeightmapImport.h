@@ -0,0 +1,62 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/ITerrainBackend.h"
+#include <filesystem>
+
+/*
+* 하이트맵 -> SdfField 변환 (16-bit raw / 바이너리 PGM(P5))
+* - 하이트맵 (u, v) 는 격자 XZ 범위 전체에 대응 : 필드 샘플 x -> u = x * (W - 1) / (sx - 1), z -> v 도 같은 방식
+* - 필드 값 = (높이 - y) * valueScale (내부 > 0, 수직 거리), |값| 은 clampValue 로 클램프
+* - 하이트맵이 필드보다 촘촘하면 샘플 간격만큼 박스 필터, 성기면 bilinear (축별 탭을 한 번 계산해 재사용)
+* - 스트리밍 : 필드 z 행을 tileRows 단위로 묶어 그 타일이 쓰는 하이트맵 행만 파일에서 읽는다 (전체 하이트맵을 메모리에 올리지 않음)
+*   타일 안에서는 하이트맵 행 x 재샘플, 필드 z 행 평가를 공용 ThreadPool로 병렬 처리하고 수직 거리 평가는 AVX2
+* - 오버행 마스크 (선택, 하이트맵과 같은 크기) : 마스크 값 m (0..1) 인 열은 높이에서 overhangCap 아래로
+*   m * overhangDepth 만큼 파낸다 (덮개 아래 빈 공간 -> 절벽 끝 돌출부)
+* - 파일/형식 오류는 std::runtime_error
+*/
+namespace SdfHeightmapImport
+{
+	enum class Format : uint8_t
+	{
+		Auto,	// 확장자 .pgm 이면 PGM, 아니면 Raw16
+		Raw16,	// 헤더 없는 16-bit 행 우선 배열
+		PGM,	// P5, maxval < 256 이면 8-bit, 아니면 16-bit big-endian
+	};
+
+	struct Source
+	{
+		std::filesystem::path path;
+		Format format = Format::Auto;
+		uint32_t rawWidth = 0;		// Raw16 크기, 0 이면 파일 크기로 정사각형 추정
+		uint32_t rawHeight = 0;
+		bool rawBigEndian = false;
+	};
+
+	struct Desc
+	{
+		float heightScale = 1.0f;	// 월드 높이 (격자 로컬) = heightOffset + 정규화 높이(0..1) * heightScale
+		float heightOffset = 0.0f;
+		float valueScale = 1.0f;	// 필드 값 / 월드 거리
+		float clampValue = 1.0f;	// 0 이하면 클램프 없음
+		int tileRows = 32;			// 스트리밍 단위 (필드 z 행 수)
+
+		Source overhangMask;		// path가 비어 있으면 사용 안 함
+		float overhangCap = 1.0f;	// 파내기 시작하는 깊이 (덮개 두께)
+		float overhangDepth = 0.0f;	// m = 1 일 때 파내는 높이
+	};
+
+	struct Stats
+	{
+		uint32_t width = 0;
+		uint32_t height = 0;
+		float minHeight = 0.0f;		// 필드 샘플 위치에서 필터링된 월드 높이 범위
+		float maxHeight = 0.0f;
+		uint64_t rowsRead = 0;		// 파일에서 읽은 하이트맵 행 수 (타일 경계 행은 중복 포함)
+	};
+
+	// 헤더만 읽어 크기 확인
+	void ReadInfo(const Source& source, uint32_t& outWidth, uint32_t& outHeight);
+
+	// field 크기가 grid.cells + 1 이 아니면 layout 으로 다시 할당
+	void Import(const Source& source, const GridDesc& grid, SdfField<float>& field, const Desc& desc, Stats* outStats = nullptr,
+		SdfLayout layout = SdfLayout::Linear);
+}
@@ -0,0 +1,230 @@
+#include "pch.h"
+#include "SdfMeshVoxelizer.h"
+#include "Core/Assets/MeshAsset.h"
+#include "Core/Utils/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace
+{
+	constexpr int kBrick = 8;
+
+	// mesh = isoValue + 부호 거리 * valueScale. 여집합은 isoValue 기준으로 뒤집은 값
+	inline float Combine(SdfMeshVoxelizer::Operation op, float isoValue, float field, float mesh)
+	{
+		switch (op)
+		{
+		case SdfMeshVoxelizer::Operation::Union:		return std::max(field, mesh);
+		case SdfMeshVoxelizer::Operation::Subtract:		return std::min(field, 2.0f * isoValue - mesh);
+		case SdfMeshVoxelizer::Operation::Intersect:	return std::min(field, mesh);
+		default:										return mesh;
+		}
+	}
+
+	float ResolveBand(const SdfMeshVoxelizer::Desc& desc, const GridDesc& grid)
+	{
+		return desc.bandWidth > 0.0f ? desc.bandWidth : 4.0f * grid.cellsize;
+	}
+}
+
+namespace SdfMeshVoxelizer
+{
+	bool ComputeRegion(const SdfField<float>& field, const GridDesc& grid, const TriangleBVH& bvh, const Desc& desc,
+		XMINT3& outSampleMin, XMINT3& outSampleMax)
+	{
+		if (bvh.IsEmpty() || field.empty() || grid.cellsize <= 0.0f) return false;
+
+		const float band = ResolveBand(desc, grid);
+		const DirectX::BoundingBox& bounds = bvh.GetBounds();
+		const float center[3] = { bounds.Center.x, bounds.Center.y, bounds.Center.z };
+		const float extents[3] = { bounds.Extents.x, bounds.Extents.y, bounds.Extents.z };
+		const float origin[3] = { grid.origin.x, grid.origin.y, grid.origin.z };
+		const int size[3] = { field.sx(), field.sy(), field.sz() };
+
+		int lo[3], hi[3];
+		for (int a = 0; a < 3; ++a)
+		{
+			lo[a] = std::max(static_cast<int>(std::floor((center[a] - extents[a] - band - origin[a]) / grid.cellsize)), 0);
+			hi[a] = std::min(static_cast<int>(std::ceil((center[a] + extents[a] + band - origin[a]) / grid.cellsize)), size[a] - 1);
+			if (lo[a] > hi[a]) return false;
+		}
+		outSampleMin = { lo[0], lo[1], lo[2] };
+		outSampleMax = { hi[0], hi[1], hi[2] };
+		return true;
+	}
+
+	void Stamp(SdfField<float>& field, const GridDesc& grid, const TriangleBVH& bvh, const Desc& desc,
+		const XMINT3& sampleMin, const XMINT3& sampleMax, Stats* outStats)
+	{
+		if (bvh.IsEmpty() || field.empty()) return;
+
+		const XMINT3 lo = { std::max(sampleMin.x, 0), std::max(sampleMin.y, 0), std::max(sampleMin.z, 0) };
+		const XMINT3 hi = { std::min(sampleMax.x, field.sx() - 1), std::min(sampleMax.y, field.sy() - 1), std::min(sampleMax.z, field.sz() - 1) };
+		if (lo.x > hi.x || lo.y > hi.y || lo.z > hi.z) return;
+
+		const float h = grid.cellsize;
+		const float band = ResolveBand(desc, grid);
+		// 브릭 중심에서 가장 먼 샘플까지 거리 (8^3 브릭은 7셀 폭)
+		const float brickRadius = 0.5f * std::sqrt(3.0f) * (kBrick - 1) * h;
+		const Operation op = desc.operation;
+
+		const int bricks[3] = { (hi.x - lo.x) / kBrick + 1, (hi.y - lo.y) / kBrick + 1, (hi.z - lo.z) / kBrick + 1 };
+		const size_t brickCount = static_cast<size_t>(bricks[0]) * bricks[1] * bricks[2];
+
+		std::atomic<uint32_t> nearBricks{ 0 };
+		std::atomic<uint64_t> windingQueries{ 0 };
+
+		auto isInside = [&](const XMFLOAT3& p) {
+			return std::fabs(bvh.WindingNumber(p, desc.windingAccuracy)) > desc.windingThreshold;
+		};
+		auto toValue = [&](float signedDistance) {
+			return desc.isoValue + signedDistance * desc.valueScale;
+		};
+
+		ThreadPool::Get().ParallelFor(0, brickCount, 1, [&](size_t begin, size_t end) {
+			float row[kBrick];
+			float distances[kBrick * kBrick * kBrick];
+			bool insides[kBrick * kBrick * kBrick];
+			uint32_t localNear = 0;
+			uint64_t localWinding = 0;
+
+			for (size_t b = begin; b < end; ++b)
+			{
+				const int bx = static_cast<int>(b % bricks[0]);
+				const int by = static_cast<int>((b / bricks[0]) % bricks[1]);
+				const int bz = static_cast<int>(b / (static_cast<size_t>(bricks[0]) * bricks[1]));
+				const int x0 = lo.x + bx * kBrick, y0 = lo.y + by * kBrick, z0 = lo.z + bz * kBrick;
+				const int x1 = std::min(x0 + kBrick - 1, hi.x), y1 = std::min(y0 + kBrick - 1, hi.y), z1 = std::min(z0 + kBrick - 1, hi.z);
+				const int nx = x1 - x0 + 1;
+
+				const XMFLOAT3 brickCenter = {
+					grid.origin.x + (x0 + 0.5f * (kBrick - 1)) * h,
+					grid.origin.y + (y0 + 0.5f * (kBrick - 1)) * h,
+					grid.origin.z + (z0 + 0.5f * (kBrick - 1)) * h
+				};
+
+				TriangleBVH::ClosestHit closest;
+				if (!bvh.ClosestPoint(brickCenter, band + brickRadius, closest))
+				{
+					// 모든 샘플이 표면에서 band 보다 멀고 브릭 안에 표면이 없음 : 한 번의 winding 으로 브릭 전체 부호
+					++localWinding;
+					const float value = toValue(isInside(brickCenter) ? band : -band);
+					for (int z = z0; z <= z1; ++z)
+					{
+						for (int y = y0; y <= y1; ++y)
+						{
+							field.readRow(y, z, x0, nx, row);
+							for (int i = 0; i < nx; ++i) row[i] = Combine(op, desc.isoValue, row[i], value);
+							field.writeRow(y, z, x0, nx, row);
+						}
+					}
+					continue;
+				}
+
+				++localNear;
+				// 브릭 안 샘플별 (거리, 부호). 이미 계산한 -x/-y/-z 이웃의 거리가 h 보다 크면
+				// 그 이웃 중심 구 안에 표면이 없으므로 부호를 그대로 쓰고, 거리 상한은 이웃 거리 + h 로 좁힌다
+				for (int z = z0; z <= z1; ++z)
+				{
+					const int lz = z - z0;
+					const float pz = grid.origin.z + z * h;
+					for (int y = y0; y <= y1; ++y)
+					{
+						const int ly = y - y0;
+						const float py = grid.origin.y + y * h;
+						field.readRow(y, z, x0, nx, row);
+
+						for (int i = 0; i < nx; ++i)
+						{
+							const XMFLOAT3 p = { grid.origin.x + (x0 + i) * h, py, pz };
+
+							float bound = band;
+							int signSource = -1;
+							auto neighbor = [&](int nxIdx, int nyIdx, int nzIdx) {
+								const int k = (nzIdx * kBrick + nyIdx) * kBrick + nxIdx;
+								bound = std::min(bound, distances[k] + h * 1.0001f);
+								if (signSource < 0 && distances[k] > h) signSource = k;
+							};
+							if (i > 0) neighbor(i - 1, ly, lz);
+							if (ly > 0) neighbor(i, ly - 1, lz);
+							if (lz > 0) neighbor(i, ly, lz - 1);
+
+							TriangleBVH::ClosestHit hit;
+							const float distance = bvh.ClosestPoint(p, bound, hit) ? hit.distance : std::min(bound, band);
+
+							bool inside;
+							if (signSource >= 0)
+							{
+								inside = insides[signSource];
+							}
+							else
+							{
+								inside = isInside(p);
+								++localWinding;
+							}
+
+							const int k = (lz * kBrick + ly) * kBrick + i;
+							distances[k] = distance;
+							insides[k] = inside;
+							row[i] = Combine(op, desc.isoValue, row[i], toValue(inside ? distance : -distance));
+						}
+						field.writeRow(y, z, x0, nx, row);
+					}
+				}
+			}
+
+			nearBricks.fetch_add(localNear, std::memory_order_relaxed);
+			windingQueries.fetch_add(localWinding, std::memory_order_relaxed);
+		});
+
+		if (outStats)
+		{
+			outStats->bricks = static_cast<uint32_t>(brickCount);
+			outStats->nearBricks = nearBricks.load();
+			outStats->windingQueries = windingQueries.load();
+		}
+	}
+
+	void BuildBVH(const GeometryData& geometry, FXMMATRIX meshToGrid, TriangleBVH& outBVH)
+	{
+		std::vector<XMFLOAT3> positions(geometry.vertices.size());
+		for (size_t i = 0; i < positions.size(); ++i)
+			XMStoreFloat3(&positions[i], XMVector3TransformCoord(XMLoadFloat3(&geometry.vertices[i].pos), meshToGrid));
+
+		outBVH.Build(positions.data(), sizeof(XMFLOAT3), geometry.indices.data(), geometry.indices.size());
+	}
+
+	void BuildBVH(const MeshAsset& asset, FXMMATRIX meshToGrid, TriangleBVH& outBVH)
+	{
+		const GeometryData& geometry = asset.GetGeometry();
+		const std::vector<MeshSubmesh>& submeshes = asset.GetSubmesh();
+		if (submeshes.empty())
+		{
+			BuildBVH(geometry, meshToGrid, outBVH);
+			return;
+		}
+
+		std::vector<XMFLOAT3> positions(geometry.vertices.size());
+		for (size_t i = 0; i < positions.size(); ++i)
+			XMStoreFloat3(&positions[i], XMVector3TransformCoord(XMLoadFloat3(&geometry.vertices[i].pos), meshToGrid));
+
+		std::vector<uint32_t> indices;
+		for (const MeshSubmesh& sm : submeshes)
+		{
+			const size_t end = std::min<size_t>(static_cast<size_t>(sm.indexOffset) + sm.indexCount, geometry.indices.size());
+			for (size_t i = sm.indexOffset; i + 3 <= end; i += 3)
+			{
+				const uint32_t tri[3] = {
+					geometry.indices[i + 0] + sm.baseVertexLocation,
+					geometry.indices[i + 1] + sm.baseVertexLocation,
+					geometry.indices[i + 2] + sm.baseVertexLocation
+				};
+				if (tri[0] >= positions.size() || tri[1] >= positions.size() || tri[2] >= positions.size()) continue;
+				indices.insert(indices.end(), tri, tri + 3);
+			}
+		}
+
+		outBVH.Build(positions.data(), sizeof(XMFLOAT3), indices.data(), indices.size());
+	}
+}
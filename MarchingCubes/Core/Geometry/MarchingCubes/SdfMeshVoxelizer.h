@@ -0,0 +1,56 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/ITerrainBackend.h"
+#include "Core/Math/TriangleBVH.h"
+
+class MeshAsset;
+
+/*
+* 메시 -> SdfField 스탬프 (CSG)
+* - 메시 좌표는 격자 로컬 공간 (샘플 s 위치 = grid.origin + s * cellsize), BVH로 빌드해 넘긴다
+* - 거리 : TriangleBVH::ClosestPoint (bandWidth 안쪽만 정확, 밖은 +-bandWidth 로 클램프)
+* - 부호 : TriangleBVH::WindingNumber (|w| > windingThreshold 이면 내부) -> 감김 방향이 섞이거나 작은 구멍이 있는 FBX도 안팎 판정
+* - 영역을 8^3 브릭으로 나눠 공용 ThreadPool ParallelFor 로 처리
+*   브릭 중심에서 band + 브릭 반경 안에 삼각형이 없으면 브릭 전체가 한쪽 (winding 1회로 부호 결정)
+*   표면 근처 브릭은 샘플마다 최근접 거리, 부호는 x 방향 이전 샘플의 거리 > cellsize 면 그대로 재사용 (그 사이에 표면이 없음)
+* - 값 규약은 필드와 같다 : 내부 > isoValue, 값 = isoValue + 부호 거리 * valueScale
+*/
+namespace SdfMeshVoxelizer
+{
+	enum class Operation : uint8_t
+	{
+		Replace,	// 영역 값을 메시 SDF로 교체
+		Union,		// max(필드, 메시)
+		Subtract,	// min(필드, -메시) : 메시 모양으로 파냄
+		Intersect,	// min(필드, 메시)
+	};
+
+	struct Desc
+	{
+		Operation operation = Operation::Union;
+		float bandWidth = 0.0f;			// 정확한 거리를 구하는 표면 주변 폭 (격자 로컬 거리), 0 이하면 4 * cellsize
+		float valueScale = 1.0f;		// 필드 값 / 거리
+		float isoValue = 0.0f;
+		float windingThreshold = 0.5f;
+		float windingAccuracy = 2.0f;	// TriangleBVH::WindingNumber accuracy
+	};
+
+	struct Stats
+	{
+		uint32_t bricks = 0;
+		uint32_t nearBricks = 0;		// 표면이 지나가 샘플별로 계산한 브릭
+		uint64_t windingQueries = 0;
+	};
+
+	// 메시 바운드 + band 가 덮는 샘플 범위 (양 끝 포함, 필드 범위로 클리핑). 겹치지 않으면 false
+	bool ComputeRegion(const SdfField<float>& field, const GridDesc& grid, const TriangleBVH& bvh, const Desc& desc,
+		DirectX::XMINT3& outSampleMin, DirectX::XMINT3& outSampleMax);
+
+	// [sampleMin, sampleMax] (양 끝 포함) 샘플에 desc.operation 적용
+	void Stamp(SdfField<float>& field, const GridDesc& grid, const TriangleBVH& bvh, const Desc& desc,
+		const DirectX::XMINT3& sampleMin, const DirectX::XMINT3& sampleMax, Stats* outStats = nullptr);
+
+	// meshToGrid 로 정점을 격자 로컬 공간으로 옮겨 BVH 빌드
+	void BuildBVH(const GeometryData& geometry, DirectX::FXMMATRIX meshToGrid, TriangleBVH& outBVH);
+	// 서브메시 인덱스는 baseVertexLocation 기준이므로 전역 인덱스로 펼쳐서 빌드
+	void BuildBVH(const MeshAsset& asset, DirectX::FXMMATRIX meshToGrid, TriangleBVH& outBVH);
+}
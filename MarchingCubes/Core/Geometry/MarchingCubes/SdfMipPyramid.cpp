@@ -0,0 +1,253 @@
+#include "pch.h"
+#include "SdfMipPyramid.h"
+#include "Core/Utils/ThreadPool.h"
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	enum class Reduce : uint8_t
+	{
+		Min,
+		Max,
+		Tent,	// [1 2 1] / 4
+	};
+
+	constexpr float kTent[3] = { 0.25f, 0.5f, 0.25f };
+
+	// 소스 행 [x0, x0 + count) 를 읽는다. 필드 밖은 가장자리 값 복제 (클램프)
+	void ReadClampedRow(const SdfField<float>& src, int y, int z, int x0, int count, float* dst)
+	{
+		const int lo = std::max(x0, 0);
+		const int hi = std::min(x0 + count, src.sx());
+		src.readRow(y, z, lo, hi - lo, dst + (lo - x0));
+		std::fill(dst, dst + (lo - x0), dst[lo - x0]);
+		std::fill(dst + (hi - x0), dst + count, dst[hi - 1 - x0]);
+	}
+
+	// 행 여러 개를 원소별로 결합 (Tent는 가중합)
+	void CombineRows(Reduce op, const float* const* rows, const float* weights, int rowCount, int n, float* out)
+	{
+		int i = 0;
+#if defined(__AVX2__)
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 acc;
+			if (op == Reduce::Tent)
+			{
+				acc = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i), _mm256_set1_ps(weights[0]));
+				for (int k = 1; k < rowCount; ++k)
+					acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(rows[k] + i), _mm256_set1_ps(weights[k])));
+			}
+			else
+			{
+				acc = _mm256_loadu_ps(rows[0] + i);
+				for (int k = 1; k < rowCount; ++k)
+				{
+					const __m256 v = _mm256_loadu_ps(rows[k] + i);
+					acc = (op == Reduce::Min) ? _mm256_min_ps(acc, v) : _mm256_max_ps(acc, v);
+				}
+			}
+			_mm256_storeu_ps(out + i, acc);
+		}
+#endif
+		for (; i < n; ++i)
+		{
+			float acc = (op == Reduce::Tent) ? rows[0][i] * weights[0] : rows[0][i];
+			for (int k = 1; k < rowCount; ++k)
+			{
+				const float v = rows[k][i];
+				acc = (op == Reduce::Tent) ? acc + v * weights[k] : (op == Reduce::Min) ? std::min(acc, v) : std::max(acc, v);
+			}
+			out[i] = acc;
+		}
+	}
+
+#if defined(__AVX2__)
+	// p[0..15] -> 짝수 원소 8개 / 홀수 원소 8개
+	inline void Deinterleave(const float* p, __m256& even, __m256& odd)
+	{
+		const __m256 a = _mm256_loadu_ps(p);
+		const __m256 b = _mm256_loadu_ps(p + 8);
+		// 레인 안에서 [a0 a2 b0 b2 | a4 a6 b4 b6] -> 64비트 단위 (0, 2, 1, 3) 재배치
+		const __m256 e = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m256 o = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+		even = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(e), _MM_SHUFFLE(3, 1, 2, 0)));
+		odd = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(o), _MM_SHUFFLE(3, 1, 2, 0)));
+	}
+#endif
+
+	// x 방향 2x 축소 : out[j] = op(in[2j], in[2j+1] (, in[2j+2])). in 길이는 2 * outCount + 2 이상
+	void ReduceX(Reduce op, int window, const float* in, int outCount, float* out)
+	{
+		int j = 0;
+#if defined(__AVX2__)
+		for (; j + 8 <= outCount; j += 8)
+		{
+			__m256 e0, o0, e1, o1;
+			Deinterleave(in + 2 * j, e0, o0);
+			__m256 r;
+			if (op == Reduce::Tent)
+			{
+				Deinterleave(in + 2 * j + 2, e1, o1);
+				r = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(e0, e1), _mm256_set1_ps(kTent[0])), _mm256_mul_ps(o0, _mm256_set1_ps(kTent[1])));
+			}
+			else
+			{
+				r = (op == Reduce::Min) ? _mm256_min_ps(e0, o0) : _mm256_max_ps(e0, o0);
+				if (window == 3)
+				{
+					Deinterleave(in + 2 * j + 2, e1, o1);
+					r = (op == Reduce::Min) ? _mm256_min_ps(r, e1) : _mm256_max_ps(r, e1);
+				}
+			}
+			_mm256_storeu_ps(out + j, r);
+		}
+#endif
+		for (; j < outCount; ++j)
+		{
+			const float* p = in + 2 * j;
+			if (op == Reduce::Tent)
+				out[j] = (p[0] + p[2]) * kTent[0] + p[1] * kTent[1];
+			else if (op == Reduce::Min)
+				out[j] = (window == 3) ? std::min({ p[0], p[1], p[2] }) : std::min(p[0], p[1]);
+			else
+				out[j] = (window == 3) ? std::max({ p[0], p[1], p[2] }) : std::max(p[0], p[1]);
+		}
+	}
+
+	// dst 범위 [lo, hi] (포함) 를 src에서 다시 계산. 축마다 소스 탭 = 2 * o + first + [0, window)
+	void Downsample(const SdfField<float>& src, SdfField<float>& dst, Reduce op, int first, int window,
+		const DirectX::XMINT3& lo, const DirectX::XMINT3& hi)
+	{
+		if (lo.x > hi.x || lo.y > hi.y || lo.z > hi.z) return;
+
+		const int outCount = hi.x - lo.x + 1;
+		const int inCount = 2 * outCount + 2;
+		const int x0 = 2 * lo.x + first;
+
+		ThreadPool::Get().ParallelFor(static_cast<size_t>(lo.z), static_cast<size_t>(hi.z) + 1, 1, [&](size_t zBegin, size_t zEnd) {
+			std::vector<float> rowBuffer(static_cast<size_t>(window * window) * inCount);
+			std::vector<float> combined(static_cast<size_t>(inCount));
+			std::vector<float> out(static_cast<size_t>(outCount));
+			const float* rows[9];
+			float weights[9];
+
+			for (size_t zs = zBegin; zs < zEnd; ++zs)
+			{
+				const int z = static_cast<int>(zs);
+				for (int y = lo.y; y <= hi.y; ++y)
+				{
+					int k = 0;
+					for (int tz = 0; tz < window; ++tz)
+					{
+						const int sz = std::clamp(2 * z + first + tz, 0, src.sz() - 1);
+						for (int ty = 0; ty < window; ++ty)
+						{
+							const int sy = std::clamp(2 * y + first + ty, 0, src.sy() - 1);
+							float* row = rowBuffer.data() + static_cast<size_t>(k) * inCount;
+							ReadClampedRow(src, sy, sz, x0, inCount, row);
+							rows[k] = row;
+							weights[k] = (op == Reduce::Tent) ? kTent[tz] * kTent[ty] : 1.0f;
+							++k;
+						}
+					}
+					CombineRows(op, rows, weights, k, inCount, combined.data());
+					ReduceX(op, window, combined.data(), outCount, out.data());
+					dst.writeRow(y, z, lo.x, outCount, out.data());
+				}
+			}
+		});
+	}
+
+	DirectX::XMINT3 ClampRange(const DirectX::XMINT3& v, const DirectX::XMINT3& maxInclusive)
+	{
+		return { std::clamp(v.x, 0, maxInclusive.x), std::clamp(v.y, 0, maxInclusive.y), std::clamp(v.z, 0, maxInclusive.z) };
+	}
+}
+
+void SdfMipPyramid::clear()
+{
+	m_levels.clear();
+	m_samples = { 0, 0, 0 };
+}
+
+void SdfMipPyramid::build(const SdfField<float>& field, uint32_t maxLevels)
+{
+	clear();
+	if (field.empty() || field.sx() < 2 || field.sy() < 2 || field.sz() < 2) return;
+
+	m_samples = { field.sx(), field.sy(), field.sz() };
+	DirectX::XMINT3 cells{ field.sx() - 1, field.sy() - 1, field.sz() - 1 };
+	while ((maxLevels == 0 || m_levels.size() < maxLevels) && (cells.x > 1 || cells.y > 1 || cells.z > 1))
+	{
+		cells = { (cells.x + 1) / 2, (cells.y + 1) / 2, (cells.z + 1) / 2 };
+
+		Level& level = m_levels.emplace_back();
+		level.blocks = cells;
+		level.minField.allocate(cells.x, cells.y, cells.z);
+		level.maxField.allocate(cells.x, cells.y, cells.z);
+		level.average.allocate(cells.x + 1, cells.y + 1, cells.z + 1);
+	}
+
+	update(field, { 0, 0, 0 }, { m_samples.x - 1, m_samples.y - 1, m_samples.z - 1 });
+}
+
+void SdfMipPyramid::update(const SdfField<float>& field, const DirectX::XMINT3& sampleMin, const DirectX::XMINT3& sampleMax)
+{
+	if (!valid()) return;
+	if (field.sx() != m_samples.x || field.sy() != m_samples.y || field.sz() != m_samples.z)
+	{
+		build(field, levelCount());
+		return;
+	}
+
+	const DirectX::XMINT3 last{ m_samples.x - 1, m_samples.y - 1, m_samples.z - 1 };
+	const DirectX::XMINT3 s0 = ClampRange(sampleMin, last);
+	const DirectX::XMINT3 s1 = ClampRange(sampleMax, last);
+	if (s0.x > s1.x || s0.y > s1.y || s0.z > s1.z) return;
+
+	// 레벨 1 : 블록 b 는 원본 샘플 [2b, 2b + 2], 평균 샘플 i 는 [2i - 1, 2i + 1] 를 읽는다
+	DirectX::XMINT3 blockLo{ (s0.x - 1) >> 1, (s0.y - 1) >> 1, (s0.z - 1) >> 1 };
+	DirectX::XMINT3 blockHi{ s1.x >> 1, s1.y >> 1, s1.z >> 1 };
+	DirectX::XMINT3 averageLo{ s0.x >> 1, s0.y >> 1, s0.z >> 1 };
+	DirectX::XMINT3 averageHi{ (s1.x + 1) >> 1, (s1.y + 1) >> 1, (s1.z + 1) >> 1 };
+
+	for (uint32_t level = 1; level <= levelCount(); ++level)
+	{
+		const DirectX::XMINT3 blocks = m_levels[level - 1].blocks;
+		blockLo = ClampRange(blockLo, { blocks.x - 1, blocks.y - 1, blocks.z - 1 });
+		blockHi = ClampRange(blockHi, { blocks.x - 1, blocks.y - 1, blocks.z - 1 });
+		averageLo = ClampRange(averageLo, blocks);
+		averageHi = ClampRange(averageHi, blocks);
+
+		updateLevel(field, level, blockLo, blockHi, averageLo, averageHi);
+
+		// 다음 레벨 : 블록은 자식 [2b, 2b + 1], 평균은 [2i - 1, 2i + 1]
+		blockLo = { blockLo.x >> 1, blockLo.y >> 1, blockLo.z >> 1 };
+		blockHi = { blockHi.x >> 1, blockHi.y >> 1, blockHi.z >> 1 };
+		averageLo = { averageLo.x >> 1, averageLo.y >> 1, averageLo.z >> 1 };
+		averageHi = { (averageHi.x + 1) >> 1, (averageHi.y + 1) >> 1, (averageHi.z + 1) >> 1 };
+	}
+}
+
+void SdfMipPyramid::updateLevel(const SdfField<float>& field, uint32_t level, const DirectX::XMINT3& blockLo, const DirectX::XMINT3& blockHi,
+	const DirectX::XMINT3& sampleLo, const DirectX::XMINT3& sampleHi)
+{
+	Level& dst = m_levels[level - 1];
+	if (level == 1)
+	{
+		Downsample(field, dst.minField, Reduce::Min, 0, 3, blockLo, blockHi);
+		Downsample(field, dst.maxField, Reduce::Max, 0, 3, blockLo, blockHi);
+		Downsample(field, dst.average, Reduce::Tent, -1, 3, sampleLo, sampleHi);
+		return;
+	}
+
+	const Level& src = m_levels[level - 2];
+	Downsample(src.minField, dst.minField, Reduce::Min, 0, 2, blockLo, blockHi);
+	Downsample(src.maxField, dst.maxField, Reduce::Max, 0, 2, blockLo, blockHi);
+	Downsample(src.average, dst.average, Reduce::Tent, -1, 3, sampleLo, sampleHi);
+}
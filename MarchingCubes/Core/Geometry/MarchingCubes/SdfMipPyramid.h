@@ -0,0 +1,52 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/SdfField.h"
+#include <DirectXMath.h>
+#include <vector>
+
+/*
+* SdfField 밉 피라미드 (2x 축소 레벨 1..N, 레벨 0 = 원본 필드)
+* - min/max : 레벨 L 블록 (bx,by,bz) 은 원본 셀 [b * 2^L, (b + 1) * 2^L) 를 덮고, 그 코너 샘플의 min/max를 가진다.
+*   블록 구간이 iso를 포함하지 않으면 안쪽 셀 전체에 표면이 없다 (레이 마칭 빈 공간 건너뛰기, 거친 범위 질의)
+* - average : 레벨 L 샘플 i 위치 = 원본 샘플 i * 2^L. 아래 레벨을 [1 2 1] / 4 텐트 필터로 축소 (LOD 메싱/미리보기용 필드)
+* - update : brush 편집 샘플 범위의 조상 블록/샘플만 레벨 순서대로 다시 계산 (행 단위 SIMD 축소, z 행 병렬)
+* - 필드 레이아웃과 무관 (원본은 readRow로 읽음), 레벨 필드는 Linear
+*/
+class SdfMipPyramid
+{
+public:
+	// maxLevels 0 : 가장 거친 레벨이 축마다 블록 1개가 될 때까지
+	void build(const SdfField<float>& field, uint32_t maxLevels = 0);
+	void clear();
+	bool valid() const { return !m_levels.empty(); }
+	uint32_t levelCount() const { return static_cast<uint32_t>(m_levels.size()); }
+
+	// 원본 샘플 범위 [sampleMin, sampleMax] (포함) 가 바뀌었을 때 조상만 갱신
+	void update(const SdfField<float>& field, const DirectX::XMINT3& sampleMin, const DirectX::XMINT3& sampleMax);
+
+	// level : 1..levelCount()
+	DirectX::XMINT3 blockDims(uint32_t level) const { return m_levels[level - 1].blocks; }
+	float blockMin(uint32_t level, int bx, int by, int bz) const { return m_levels[level - 1].minField.at(bx, by, bz); }
+	float blockMax(uint32_t level, int bx, int by, int bz) const { return m_levels[level - 1].maxField.at(bx, by, bz); }
+	bool blockMayContain(uint32_t level, int bx, int by, int bz, float iso) const
+	{
+		const Level& l = m_levels[level - 1];
+		return l.minField.at(bx, by, bz) <= iso && iso <= l.maxField.at(bx, by, bz);
+	}
+	const SdfField<float>& averageField(uint32_t level) const { return m_levels[level - 1].average; }
+
+private:
+	struct Level
+	{
+		DirectX::XMINT3 blocks{ 0, 0, 0 };	// 축별 블록 수 (= 평균 필드 샘플 수 - 1)
+		SdfField<float> minField;			// [blocks]
+		SdfField<float> maxField;			// [blocks]
+		SdfField<float> average;			// [blocks + 1]
+	};
+
+	void updateLevel(const SdfField<float>& field, uint32_t level, const DirectX::XMINT3& blockLo, const DirectX::XMINT3& blockHi,
+		const DirectX::XMINT3& sampleLo, const DirectX::XMINT3& sampleHi);
+
+private:
+	DirectX::XMINT3 m_samples{ 0, 0, 0 };	// 원본 필드 크기
+	std::vector<Level> m_levels;
+};
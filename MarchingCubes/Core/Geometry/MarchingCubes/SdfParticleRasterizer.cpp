@@ -0,0 +1,328 @@
+#include "pch.h"
+#include "SdfParticleRasterizer.h"
+#include "Core/Utils/ThreadPool.h"
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	constexpr int kBrick = 8;
+	constexpr uint32_t kOutside = UINT32_MAX;
+
+	inline int BrickCount(int samples) { return (samples + kBrick - 1) / kBrick; }
+}
+
+bool SdfParticleRasterizer::Rasterize(const FluidParticleArrays& particles, const Desc& desc, SdfField<float>& field, const GridDesc& grid,
+	XMINT3& outSampleMin, XMINT3& outSampleMax, Stats* outStats)
+{
+	if (field.empty() || grid.cellsize <= 0.0f) return false;
+
+	const float h = grid.cellsize;
+	const float invH = 1.0f / h;
+	// 샘플 단위 반경 (3x3x3 브릭 이웃으로 덮이도록 브릭 폭 이하)
+	const float radius = std::clamp(desc.radius > 0.0f ? desc.radius : 2.0f * h, 1e-3f * h, kBrick * h);
+	const float rs = radius * invH;
+	const float rs2 = rs * rs;
+	// Poly6 (반경 R) : 315 / (64 pi R^9) (R^2 - r^2)^3, 샘플 단위 거리로 계산하므로 h^6 을 계수에 포함
+	const float pi = 3.14159265358979323846f;
+	const float kernelScale = 315.0f / (64.0f * pi * std::pow(radius, 9.0f)) * std::pow(h, 6.0f);
+	const float emptyValue = EmptyValue(desc);
+
+	const int size[3] = { field.sx(), field.sy(), field.sz() };
+	const float origin[3] = { grid.origin.x, grid.origin.y, grid.origin.z };
+
+	// 필드가 바뀌었으면 전체를 빈 값으로 (이후로는 브릭 단위로만 갱신)
+	const bool fullReset = m_field != &field || m_fieldSize[0] != size[0] || m_fieldSize[1] != size[1] || m_fieldSize[2] != size[2];
+	if (fullReset)
+	{
+		field = emptyValue;
+		m_field = &field;
+		for (int a = 0; a < 3; ++a)
+		{
+			m_fieldSize[a] = size[a];
+			m_bricks[a] = BrickCount(size[a]);
+		}
+		m_brickState.assign(static_cast<size_t>(m_bricks[0]) * m_bricks[1] * m_bricks[2], 0);
+		m_brickStart.assign(m_brickState.size() + 1, 0);
+		m_written.clear();
+	}
+	const int* bricks = m_bricks;
+	const size_t brickCount = m_brickState.size();
+
+	// 1. 입자별 브릭 (영향 범위가 필드와 겹치지 않으면 제외). 필드 밖 입자는 가장자리 브릭으로 클램프
+	const size_t count = particles.size();
+	m_particleBrick.resize(count);
+	ThreadPool::Get().ParallelFor(0, count, 1024, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+		{
+			const float u[3] = {
+				(particles.x[i] - origin[0]) * invH,
+				(particles.y[i] - origin[1]) * invH,
+				(particles.z[i] - origin[2]) * invH
+			};
+			uint32_t brick = 0, stride = 1;
+			for (int a = 0; a < 3; ++a)
+			{
+				if (!(u[a] + rs >= 0.0f && u[a] - rs <= static_cast<float>(size[a] - 1)))
+				{
+					brick = kOutside;
+					break;
+				}
+				const int b = std::clamp(static_cast<int>(std::floor(u[a] / kBrick)), 0, bricks[a] - 1);
+				brick += static_cast<uint32_t>(b) * stride;
+				stride *= static_cast<uint32_t>(bricks[a]);
+			}
+			m_particleBrick[i] = brick;
+		}
+	});
+
+	// 2. 브릭으로 카운팅 정렬 (안정 정렬 -> 누적 순서 고정)
+	std::fill(m_brickStart.begin(), m_brickStart.end(), 0u);
+	uint32_t inside = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (m_particleBrick[i] == kOutside) continue;
+		++m_brickStart[m_particleBrick[i] + 1];
+		++inside;
+	}
+	for (size_t b = 1; b <= brickCount; ++b) m_brickStart[b] += m_brickStart[b - 1];
+
+	m_px.resize(inside);
+	m_py.resize(inside);
+	m_pz.resize(inside);
+	m_volume.resize(inside);
+	for (int a = 0; a < 3; ++a)
+	{
+		m_boundMin[a].resize(inside);
+		m_boundMax[a].resize(inside);
+	}
+	m_brickCursor.assign(m_brickStart.begin(), m_brickStart.end() - 1);
+	for (size_t i = 0; i < count; ++i)
+	{
+		const uint32_t brick = m_particleBrick[i];
+		if (brick == kOutside) continue;
+		const uint32_t k = m_brickCursor[brick]++;
+		// 샘플 단위 좌표로 저장
+		m_px[k] = (particles.x[i] - origin[0]) * invH;
+		m_py[k] = (particles.y[i] - origin[1]) * invH;
+		m_pz[k] = (particles.z[i] - origin[2]) * invH;
+		// 반경 안 샘플 범위 (전역 샘플 인덱스, 양 끝 포함)
+		const float u[3] = { m_px[k], m_py[k], m_pz[k] };
+		for (int a = 0; a < 3; ++a)
+		{
+			m_boundMin[a][k] = static_cast<int>(std::ceil(u[a] - rs));
+			m_boundMax[a][k] = static_cast<int>(std::floor(u[a] + rs));
+		}
+		const float density = particles.density[i] > 0.0f ? particles.density[i] : desc.restDensity;
+		m_volume[k] = particles.mass[i] / density * kernelScale;
+	}
+
+	// 3. 후보 : 입자가 있는 브릭의 3x3x3 이웃
+	m_candidates.clear();
+	for (int bz = 0; bz < bricks[2]; ++bz)
+	{
+		for (int by = 0; by < bricks[1]; ++by)
+		{
+			for (int bx = 0; bx < bricks[0]; ++bx)
+			{
+				const size_t b = (static_cast<size_t>(bz) * bricks[1] + by) * bricks[0] + bx;
+				if (m_brickStart[b] == m_brickStart[b + 1]) continue;
+				for (int z = std::max(bz - 1, 0); z <= std::min(bz + 1, bricks[2] - 1); ++z)
+					for (int y = std::max(by - 1, 0); y <= std::min(by + 1, bricks[1] - 1); ++y)
+						for (int x = std::max(bx - 1, 0); x <= std::min(bx + 1, bricks[0] - 1); ++x)
+						{
+							const size_t n = (static_cast<size_t>(z) * bricks[1] + y) * bricks[0] + x;
+							if (m_brickState[n] & kCandidate) continue;
+							m_brickState[n] |= kCandidate;
+							m_candidates.push_back(static_cast<uint32_t>(n));
+						}
+			}
+		}
+	}
+
+	auto brickCoord = [&](size_t b, int& bx, int& by, int& bz) {
+		bx = static_cast<int>(b % bricks[0]);
+		by = static_cast<int>((b / bricks[0]) % bricks[1]);
+		bz = static_cast<int>(b / (static_cast<size_t>(bricks[0]) * bricks[1]));
+	};
+	auto fillBrick = [&](size_t b, float value) {
+		int bx, by, bz;
+		brickCoord(b, bx, by, bz);
+		const int x0 = bx * kBrick, y0 = by * kBrick, z0 = bz * kBrick;
+		const int nx = std::min(kBrick, size[0] - x0), ny = std::min(kBrick, size[1] - y0), nz = std::min(kBrick, size[2] - z0);
+		float row[kBrick];
+		std::fill(row, row + kBrick, value);
+		for (int z = 0; z < nz; ++z)
+			for (int y = 0; y < ny; ++y)
+				field.writeRow(y0 + y, z0 + z, x0, nx, row);
+	};
+
+	// 4. 후보 브릭별 누적 (gather) -> 필드 기록
+	m_writtenNow.assign(m_candidates.size(), 0);
+	ThreadPool::Get().ParallelFor(0, m_candidates.size(), 1, [&](size_t begin, size_t end) {
+		alignas(32) float accum[kBrick * kBrick * kBrick];
+		for (size_t c = begin; c < end; ++c)
+		{
+			const size_t b = m_candidates[c];
+			int bx, by, bz;
+			brickCoord(b, bx, by, bz);
+			const float base[3] = { static_cast<float>(bx * kBrick), static_cast<float>(by * kBrick), static_cast<float>(bz * kBrick) };
+
+			const int brickMin[3] = { bx * kBrick, by * kBrick, bz * kBrick };
+#if defined(__AVX2__)
+			const __m256i brickMin8[3] = { _mm256_set1_epi32(brickMin[0]), _mm256_set1_epi32(brickMin[1]), _mm256_set1_epi32(brickMin[2]) };
+			const __m256i brickMax8[3] = { _mm256_set1_epi32(brickMin[0] + kBrick - 1), _mm256_set1_epi32(brickMin[1] + kBrick - 1), _mm256_set1_epi32(brickMin[2] + kBrick - 1) };
+#endif
+
+			std::fill(accum, accum + kBrick * kBrick * kBrick, 0.0f);
+			bool touched = false;
+			// 입자 k 를 이 브릭 로컬 버퍼에 누적 (반경 안 샘플 범위가 브릭과 겹칠 때만 호출)
+			auto splat = [&](uint32_t k) {
+				touched = true;
+				// 브릭 로컬 샘플 좌표
+				const float lx = m_px[k] - base[0], ly = m_py[k] - base[1], lz = m_pz[k] - base[2];
+				const int y0 = std::max(m_boundMin[1][k] - brickMin[1], 0), y1 = std::min(m_boundMax[1][k] - brickMin[1], kBrick - 1);
+				const int z0 = std::max(m_boundMin[2][k] - brickMin[2], 0), z1 = std::min(m_boundMax[2][k] - brickMin[2], kBrick - 1);
+				const float volume = m_volume[k];
+#if defined(__AVX2__)
+				const __m256 dx = _mm256_sub_ps(_mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_ps(lx));
+				const __m256 dx2 = _mm256_mul_ps(dx, dx);
+				const __m256 volume8 = _mm256_set1_ps(volume);
+#endif
+				for (int sz = z0; sz <= z1; ++sz)
+				{
+					const float dz = sz - lz;
+					for (int sy = y0; sy <= y1; ++sy)
+					{
+						const float dy = sy - ly;
+						const float remain = rs2 - dy * dy - dz * dz;	// 이 행에서 x 방향으로 남은 반경^2
+						if (remain <= 0.0f) continue;
+						float* row = accum + (sz * kBrick + sy) * kBrick;
+#if defined(__AVX2__)
+						const __m256 t = _mm256_max_ps(_mm256_sub_ps(_mm256_set1_ps(remain), dx2), _mm256_setzero_ps());
+						const __m256 w = _mm256_mul_ps(volume8, _mm256_mul_ps(t, _mm256_mul_ps(t, t)));
+						_mm256_store_ps(row, _mm256_add_ps(_mm256_load_ps(row), w));
+#else
+						for (int sx = 0; sx < kBrick; ++sx)
+						{
+							const float t = std::max(remain - (sx - lx) * (sx - lx), 0.0f);
+							row[sx] += volume * t * t * t;
+						}
+#endif
+					}
+				}
+			};
+
+			for (int z = std::max(bz - 1, 0); z <= std::min(bz + 1, bricks[2] - 1); ++z)
+			for (int y = std::max(by - 1, 0); y <= std::min(by + 1, bricks[1] - 1); ++y)
+			for (int x = std::max(bx - 1, 0); x <= std::min(bx + 1, bricks[0] - 1); ++x)
+			{
+				const size_t n = (static_cast<size_t>(z) * bricks[1] + y) * bricks[0] + x;
+				// 반경 안 샘플 범위가 이 브릭과 겹치는 입자만 (8개씩 정수 비교로 걸러냄)
+				const uint32_t first = m_brickStart[n], last = m_brickStart[n + 1];
+				uint32_t k = first;
+#if defined(__AVX2__)
+				for (; k + 8 <= last; k += 8)
+				{
+					__m256i overlap = _mm256_set1_epi32(-1);
+					for (int a = 0; a < 3; ++a)
+					{
+						const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m_boundMin[a].data() + k));
+						const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m_boundMax[a].data() + k));
+						// lo <= brickMax && hi >= brickMin
+						overlap = _mm256_andnot_si256(_mm256_cmpgt_epi32(lo, brickMax8[a]), overlap);
+						overlap = _mm256_andnot_si256(_mm256_cmpgt_epi32(brickMin8[a], hi), overlap);
+					}
+					for (int bits = _mm256_movemask_ps(_mm256_castsi256_ps(overlap)); bits; bits &= bits - 1)
+						splat(k + std::countr_zero(static_cast<unsigned>(bits)));
+				}
+#endif
+				for (; k < last; ++k)
+				{
+					bool overlap = true;
+					for (int a = 0; a < 3; ++a)
+						overlap = overlap && m_boundMin[a][k] <= brickMin[a] + kBrick - 1 && m_boundMax[a][k] >= brickMin[a];
+					if (overlap) splat(k);
+				}
+			}
+
+			if (!touched)
+			{
+				// 반경 안 샘플이 없음 : 직전에 쓴 브릭만 빈 값으로 되돌린다
+				if (m_brickState[b] & kWritten) fillBrick(b, emptyValue);
+				continue;
+			}
+
+			m_writtenNow[c] = 1;
+			const int x0 = bx * kBrick, y0 = by * kBrick, z0 = bz * kBrick;
+			const int nx = std::min(kBrick, size[0] - x0), ny = std::min(kBrick, size[1] - y0), nz = std::min(kBrick, size[2] - z0);
+			float row[kBrick];
+			for (int z = 0; z < nz; ++z)
+			{
+				for (int y = 0; y < ny; ++y)
+				{
+					const float* colors = accum + (z * kBrick + y) * kBrick;
+					for (int x = 0; x < nx; ++x) row[x] = desc.isoValue + (colors[x] - desc.threshold) * desc.valueScale;
+					field.writeRow(y0 + y, z0 + z, x0, nx, row);
+				}
+			}
+		}
+	});
+
+	// 5. 직전에 썼지만 이번 후보가 아닌 브릭은 빈 값으로 (병렬, 브릭끼리 겹치지 않음)
+	ThreadPool::Get().ParallelFor(0, m_written.size(), 16, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+			if (!(m_brickState[m_written[i]] & kCandidate)) fillBrick(m_written[i], emptyValue);
+	});
+
+	// 6. 바뀐 범위 + 상태 갱신
+	Stats stats;
+	stats.particles = inside;
+	stats.candidateBricks = static_cast<uint32_t>(m_candidates.size());
+	int lo[3] = { INT_MAX, INT_MAX, INT_MAX }, hi[3] = { INT_MIN, INT_MIN, INT_MIN };
+	auto include = [&](size_t b) {
+		int bc[3];
+		brickCoord(b, bc[0], bc[1], bc[2]);
+		for (int a = 0; a < 3; ++a)
+		{
+			lo[a] = std::min(lo[a], bc[a] * kBrick);
+			hi[a] = std::max(hi[a], std::min(bc[a] * kBrick + kBrick - 1, size[a] - 1));
+		}
+	};
+
+	for (uint32_t b : m_written)
+	{
+		if (!(m_brickState[b] & kCandidate)) ++stats.clearedBricks;
+		include(b);	// 후보였다면 다시 썼거나 되돌렸으므로 어느 쪽이든 바뀐 범위
+		m_brickState[b] &= ~kWritten;
+	}
+	m_written.clear();
+	for (size_t c = 0; c < m_candidates.size(); ++c)
+	{
+		const uint32_t b = m_candidates[c];
+		m_brickState[b] &= ~kCandidate;
+		if (!m_writtenNow[c]) continue;
+		++stats.writtenBricks;
+		include(b);
+		m_brickState[b] |= kWritten;
+		m_written.push_back(b);
+	}
+	if (outStats) *outStats = stats;
+
+	if (fullReset)
+	{
+		outSampleMin = { 0, 0, 0 };
+		outSampleMax = { size[0] - 1, size[1] - 1, size[2] - 1 };
+		return true;
+	}
+	if (lo[0] > hi[0]) return false;
+	outSampleMin = { lo[0], lo[1], lo[2] };
+	outSampleMax = { hi[0], hi[1], hi[2] };
+	return true;
+}
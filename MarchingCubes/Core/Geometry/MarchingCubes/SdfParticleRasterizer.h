@@ -0,0 +1,68 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/ITerrainBackend.h"
+#include "Core/Geometry/FluidSystem.h"
+
+/*
+* 유체 입자 -> SdfField 래스터화 (유체 표면 메싱용)
+* - 입자 좌표는 격자 로컬 공간 (샘플 s 위치 = grid.origin + s * cellsize). 지형과 같은 GridDesc 의 별도 필드에 쓴다
+* - 값 : 매끈한 색 필드 c(x) = sum_j (m_j / rho_j) W(|x - x_j|, R) (W : 반경 R 로 정규화한 Poly6)
+*   필드 값 = isoValue + (c - threshold) * valueScale -> 지형과 같은 규약 (내부 > isoValue)
+* - 8^3 샘플 브릭 단위 : 입자를 브릭으로 카운팅 정렬하고, 입자가 있는 브릭의 3x3x3 이웃 브릭만 후보로
+*   후보 브릭마다 주변 27 브릭 입자를 모아 로컬 버퍼에 누적 (gather 방식 -> 원자 연산/쓰기 충돌 없음, 공용 ThreadPool 병렬)
+*   브릭의 x 행이 8샘플이라 입자 하나가 행 하나를 AVX2 한 번으로 누적
+* - 이전 호출에 값을 쓴 브릭 중 이번에 닿지 않은 브릭은 빈 값으로 되돌린다. 나머지 필드는 건드리지 않음
+*   (필드 크기가 바뀌거나 처음 호출하면 전체를 빈 값으로 채움)
+* - 결과 범위 (이번에 쓴 브릭 + 되돌린 브릭) 를 ITerrainBackend::notifyFieldEdited 로 넘기면 그 영역만 재메싱
+* - R 은 브릭 폭 (8 * cellsize) 이하로 클램프 (3x3x3 브릭 이웃으로 충분하도록)
+*/
+class SdfParticleRasterizer
+{
+public:
+	struct Desc
+	{
+		float radius = 0.0f;			// 입자 영향 반경 R (격자 로컬 거리), 0 이하면 2 * cellsize
+		float threshold = 0.5f;			// 표면 색 필드 값
+		float valueScale = 1.0f;
+		float isoValue = 0.0f;
+		float restDensity = 1000.0f;	// 밀도가 아직 없는 입자 (Step 전) 의 부피 계산용
+	};
+
+	struct Stats
+	{
+		uint32_t particles = 0;			// 필드 범위에 닿은 입자 수
+		uint32_t candidateBricks = 0;
+		uint32_t writtenBricks = 0;		// 입자가 닿아 값을 쓴 브릭
+		uint32_t clearedBricks = 0;		// 이전 호출에 썼지만 이번엔 비어 빈 값으로 되돌린 브릭
+	};
+
+	// 빈 공간 값 (c = 0)
+	static float EmptyValue(const Desc& desc) { return desc.isoValue - desc.threshold * desc.valueScale; }
+
+	// 바뀐 샘플 범위 (양 끝 포함) 를 돌려준다. 바뀐 곳이 없으면 false
+	bool Rasterize(const FluidParticleArrays& particles, const Desc& desc, SdfField<float>& field, const GridDesc& grid,
+		DirectX::XMINT3& outSampleMin, DirectX::XMINT3& outSampleMax, Stats* outStats = nullptr);
+
+	// 다음 호출에서 필드 전체를 빈 값으로 다시 채우도록 (외부에서 필드를 덮어썼을 때)
+	void Reset() { m_field = nullptr; }
+
+private:
+	// 브릭 상태 비트
+	static constexpr uint8_t kWritten = 1;		// 직전 호출에서 값을 씀
+	static constexpr uint8_t kCandidate = 2;	// 이번 호출 후보
+
+	const SdfField<float>* m_field = nullptr;	// 마지막으로 채운 필드 (바뀌면 전체 초기화)
+	int m_fieldSize[3] = {};
+	int m_bricks[3] = {};
+
+	std::vector<uint8_t> m_brickState;
+	std::vector<uint32_t> m_brickStart;			// 브릭별 입자 구간 (카운팅 정렬, 브릭 수 + 1)
+	std::vector<uint32_t> m_brickCursor;
+	std::vector<uint32_t> m_particleBrick;		// 입자별 브릭 (범위 밖 = UINT32_MAX)
+	std::vector<uint32_t> m_candidates;
+	std::vector<uint32_t> m_written;			// 직전 호출에서 값을 쓴 브릭
+	std::vector<uint8_t> m_writtenNow;			// 후보별 이번 기록 여부
+
+	// 브릭 순서로 정렬한 입자 (샘플 단위 x, y, z, 커널 계수를 곱한 부피, 반경 안 샘플 범위)
+	std::vector<float> m_px, m_py, m_pz, m_volume;
+	std::vector<int> m_boundMin[3], m_boundMax[3];
+};
@@ -0,0 +1,289 @@
+#include "pch.h"
+#include "SdfRaycast.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+	// 셀 내부를 나누어 검사하는 구간 수 (trilinear는 레이 위에서 3차식이라 양 끝 부호만으로는 근을 놓칠 수 있음)
+	constexpr int kCellSubSteps = 4;
+	constexpr int kBisectIterations = 20;
+
+	inline float Lerp(float a, float b, float t) { return a + (b - a) * t; }
+
+	// MC 코너 순서와 무관한 x-최내부 순서 : c[x + 2y + 4z]
+	struct CellCorners
+	{
+		float c[8];
+
+		void load(const SdfField<float>& field, int x, int y, int z)
+		{
+			for (int k = 0; k < 8; ++k) c[k] = field.at(x + (k & 1), y + ((k >> 1) & 1), z + (k >> 2));
+		}
+
+		float minValue() const { return *std::min_element(c, c + 8); }
+		float maxValue() const { return *std::max_element(c, c + 8); }
+
+		float sample(float u, float v, float w) const
+		{
+			const float x00 = Lerp(c[0], c[1], u);
+			const float x10 = Lerp(c[2], c[3], u);
+			const float x01 = Lerp(c[4], c[5], u);
+			const float x11 = Lerp(c[6], c[7], u);
+			return Lerp(Lerp(x00, x10, v), Lerp(x01, x11, v), w);
+		}
+	};
+}
+
+namespace SdfRaycast
+{
+	float SampleTrilinear(const SdfField<float>& field, float gx, float gy, float gz)
+	{
+		const int dims[3] = { field.sx(), field.sy(), field.sz() };
+		float g[3] = { gx, gy, gz };
+		int i[3];
+		float t[3];
+		for (int a = 0; a < 3; ++a)
+		{
+			g[a] = std::clamp(g[a], 0.0f, static_cast<float>(dims[a] - 1));
+			i[a] = std::min(static_cast<int>(g[a]), std::max(dims[a] - 2, 0));
+			t[a] = g[a] - i[a];
+		}
+
+		CellCorners cell;
+		cell.load(field, i[0], i[1], i[2]);
+		return cell.sample(t[0], t[1], t[2]);
+	}
+
+	float SampleTrilinearGradient(const SdfField<float>& field, float gx, float gy, float gz, DirectX::XMFLOAT3& outGradient)
+	{
+		const int dims[3] = { field.sx(), field.sy(), field.sz() };
+		float g[3] = { gx, gy, gz };
+		int i[3];
+		float t[3];
+		for (int a = 0; a < 3; ++a)
+		{
+			g[a] = std::clamp(g[a], 0.0f, static_cast<float>(dims[a] - 1));
+			i[a] = std::min(static_cast<int>(g[a]), std::max(dims[a] - 2, 0));
+			t[a] = g[a] - i[a];
+		}
+
+		CellCorners cell;
+		cell.load(field, i[0], i[1], i[2]);
+		const float* c = cell.c;
+		const float u = t[0], v = t[1], w = t[2];
+
+		// x 방향 차분을 (y, z) 로 보간, y/z 도 같은 방식
+		const float dx00 = c[1] - c[0], dx10 = c[3] - c[2], dx01 = c[5] - c[4], dx11 = c[7] - c[6];
+		const float x00 = Lerp(c[0], c[1], u), x10 = Lerp(c[2], c[3], u), x01 = Lerp(c[4], c[5], u), x11 = Lerp(c[6], c[7], u);
+		outGradient.x = Lerp(Lerp(dx00, dx10, v), Lerp(dx01, dx11, v), w);
+		outGradient.y = Lerp(x10 - x00, x11 - x01, w);
+		outGradient.z = Lerp(x01, x11, v) - Lerp(x00, x10, v);
+		return Lerp(Lerp(x00, x10, v), Lerp(x01, x11, v), w);
+	}
+
+	bool Raycast(const SdfField<float>& field, const DirectX::XMFLOAT3& origin, float cellsize, float iso,
+		const DirectX::XMFLOAT3& rayOrigin, const DirectX::XMFLOAT3& rayDir, float maxDistance, Hit& outHit,
+		const SdfMipPyramid* mips)
+	{
+		if (field.empty() || cellsize <= 0.0f) return false;
+		const int cells[3] = { field.sx() - 1, field.sy() - 1, field.sz() - 1 };
+		if (cells[0] <= 0 || cells[1] <= 0 || cells[2] <= 0) return false;
+
+		const float len = std::sqrt(rayDir.x * rayDir.x + rayDir.y * rayDir.y + rayDir.z * rayDir.z);
+		if (len <= FLT_EPSILON) return false;
+
+		// 격자 공간 (셀 = 1) : g(t) = ro + rd * t, t는 월드 거리
+		const float invCell = 1.0f / cellsize;
+		const float ro[3] = { (rayOrigin.x - origin.x) * invCell, (rayOrigin.y - origin.y) * invCell, (rayOrigin.z - origin.z) * invCell };
+		const float rd[3] = { rayDir.x / len * invCell, rayDir.y / len * invCell, rayDir.z / len * invCell };
+
+		// 필드 AABB [0, cells] 로 클리핑 (slab)
+		float tEnter = 0.0f;
+		float tLeave = maxDistance;
+		for (int a = 0; a < 3; ++a)
+		{
+			if (std::fabs(rd[a]) < 1e-12f)
+			{
+				if (ro[a] < 0.0f || ro[a] > cells[a]) return false;
+				continue;
+			}
+			float ta = (0.0f - ro[a]) / rd[a];
+			float tb = (cells[a] - ro[a]) / rd[a];
+			if (ta > tb) std::swap(ta, tb);
+			tEnter = std::max(tEnter, ta);
+			tLeave = std::min(tLeave, tb);
+		}
+		if (tEnter > tLeave) return false;
+
+		// DDA 초기화 : 진입점이 속한 셀과 각 축의 다음 경계까지 거리
+		int cell[3], step[3];
+		float tNext[3], tDelta[3];
+		auto enterCell = [&](int a, int c) {
+			cell[a] = c;
+			if (rd[a] > 0.0f)
+			{
+				step[a] = 1;
+				tNext[a] = (cell[a] + 1 - ro[a]) / rd[a];
+				tDelta[a] = 1.0f / rd[a];
+			}
+			else if (rd[a] < 0.0f)
+			{
+				step[a] = -1;
+				tNext[a] = (cell[a] - ro[a]) / rd[a];
+				tDelta[a] = -1.0f / rd[a];
+			}
+			else
+			{
+				step[a] = 0;
+				tNext[a] = FLT_MAX;
+				tDelta[a] = FLT_MAX;
+			}
+		};
+		for (int a = 0; a < 3; ++a)
+		{
+			const float g = ro[a] + rd[a] * tEnter;
+			enterCell(a, std::clamp(static_cast<int>(std::floor(g)), 0, cells[a] - 1));
+		}
+
+		// 빈 블록 건너뛰기 : 셀을 감싸는 레벨 1..N 블록 중 iso를 포함하지 않는 가장 큰 블록 (포함 관계라 아래 레벨부터 검사)
+		const uint32_t mipLevels = (mips && mips->valid()) ? mips->levelCount() : 0;
+		auto emptyLevel = [&]() {
+			uint32_t level = 0;
+			while (level < mipLevels && !mips->blockMayContain(level + 1, cell[0] >> (level + 1), cell[1] >> (level + 1), cell[2] >> (level + 1), iso))
+				++level;
+			return level;
+		};
+
+		CellCorners corners;
+		auto local = [&](float t, float& u, float& v, float& w) {
+			u = std::clamp(ro[0] + rd[0] * t - cell[0], 0.0f, 1.0f);
+			v = std::clamp(ro[1] + rd[1] * t - cell[1], 0.0f, 1.0f);
+			w = std::clamp(ro[2] + rd[2] * t - cell[2], 0.0f, 1.0f);
+		};
+		auto valueAt = [&](float t) {
+			float u, v, w;
+			local(t, u, v, w);
+			return corners.sample(u, v, w) - iso;
+		};
+
+		float t = tEnter;
+		bool found = false;
+		float tHit = 0.0f;
+		while (t <= tLeave)
+		{
+			if (const uint32_t level = emptyLevel(); level > 0)
+			{
+				// 블록 AABB [lo, hi) 의 출구로 이동. 출구 축은 다음 블록의 첫 셀, 나머지 축은 블록 안으로 클램프
+				int lo[3], hi[3];
+				float tBlock = FLT_MAX;
+				int exitAxis = 0;
+				for (int a = 0; a < 3; ++a)
+				{
+					lo[a] = (cell[a] >> level) << level;
+					hi[a] = std::min(lo[a] + (1 << level), cells[a]);
+					const float ta = (step[a] > 0) ? (hi[a] - ro[a]) / rd[a] : (step[a] < 0) ? (lo[a] - ro[a]) / rd[a] : FLT_MAX;
+					if (ta < tBlock)
+					{
+						tBlock = ta;
+						exitAxis = a;
+					}
+				}
+				if (tBlock >= tLeave) break;
+
+				const int next = (step[exitAxis] > 0) ? hi[exitAxis] : lo[exitAxis] - 1;
+				if (next < 0 || next >= cells[exitAxis]) break;
+				t = std::max(tBlock, t);
+				for (int a = 0; a < 3; ++a)
+				{
+					const int c = (a == exitAxis) ? next : std::clamp(static_cast<int>(std::floor(ro[a] + rd[a] * t)), lo[a], hi[a] - 1);
+					enterCell(a, c);
+				}
+				continue;
+			}
+
+			const float tExit = std::min({ tNext[0], tNext[1], tNext[2], tLeave });
+
+			corners.load(field, cell[0], cell[1], cell[2]);
+			if (corners.minValue() <= iso && iso <= corners.maxValue())
+			{
+				// 셀 구간을 나눠 부호 변화 탐색 -> 이분법으로 근 정밀화
+				float ta = t;
+				float fa = valueAt(ta);
+				for (int s = 1; s <= kCellSubSteps && !found; ++s)
+				{
+					const float tb = Lerp(t, tExit, static_cast<float>(s) / kCellSubSteps);
+					const float fb = valueAt(tb);
+					if (fa == 0.0f)
+					{
+						tHit = ta;
+						found = true;
+					}
+					else if ((fa < 0.0f) != (fb < 0.0f))
+					{
+						float lo = ta, hi = tb, flo = fa;
+						for (int it = 0; it < kBisectIterations; ++it)
+						{
+							const float mid = 0.5f * (lo + hi);
+							const float fm = valueAt(mid);
+							if ((fm < 0.0f) == (flo < 0.0f))
+							{
+								lo = mid;
+								flo = fm;
+							}
+							else
+							{
+								hi = mid;
+							}
+						}
+						tHit = 0.5f * (lo + hi);
+						found = true;
+					}
+					ta = tb;
+					fa = fb;
+				}
+				if (found) break;
+			}
+
+			if (tExit >= tLeave) break;
+
+			// 가장 가까운 경계 축으로 다음 셀 이동
+			const int axis = (tNext[0] < tNext[1]) ? (tNext[0] < tNext[2] ? 0 : 2) : (tNext[1] < tNext[2] ? 1 : 2);
+			cell[axis] += step[axis];
+			if (cell[axis] < 0 || cell[axis] >= cells[axis]) break;
+			t = tNext[axis];
+			tNext[axis] += tDelta[axis];
+		}
+
+		if (!found) return false;
+
+		const float gx = ro[0] + rd[0] * tHit;
+		const float gy = ro[1] + rd[1] * tHit;
+		const float gz = ro[2] + rd[2] * tHit;
+
+		// 노말 = -normalize(grad) (중앙 차분, 반 셀 간격)
+		constexpr float h = 0.5f;
+		float nx = SampleTrilinear(field, gx + h, gy, gz) - SampleTrilinear(field, gx - h, gy, gz);
+		float ny = SampleTrilinear(field, gx, gy + h, gz) - SampleTrilinear(field, gx, gy - h, gz);
+		float nz = SampleTrilinear(field, gx, gy, gz + h) - SampleTrilinear(field, gx, gy, gz - h);
+		const float nlen = std::sqrt(nx * nx + ny * ny + nz * nz);
+		if (nlen > FLT_EPSILON)
+		{
+			nx = -nx / nlen;
+			ny = -ny / nlen;
+			nz = -nz / nlen;
+		}
+		else
+		{
+			nx = -rayDir.x / len;
+			ny = -rayDir.y / len;
+			nz = -rayDir.z / len;
+		}
+
+		outHit.position = { origin.x + gx * cellsize, origin.y + gy * cellsize, origin.z + gz * cellsize };
+		outHit.normal = { nx, ny, nz };
+		outHit.distance = tHit;
+		return true;
+	}
+}
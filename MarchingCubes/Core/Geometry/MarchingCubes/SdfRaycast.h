@@ -0,0 +1,33 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/SdfField.h"
+#include "Core/Geometry/MarchingCubes/SdfMipPyramid.h"
+#include <DirectXMath.h>
+
+/*
+* SdfField 직접 레이 추적 (메시 없이 iso 표면 피킹)
+* - 필드 값은 거리로 정규화되어 있지 않으므로(클램프된 밀도) sphere tracing 대신 셀 단위 DDA
+* - 셀 8코너의 min/max가 iso를 포함하지 않으면 건너뜀, 포함하면 셀 구간을 trilinear 보간으로 분할 탐색
+* - 밉 피라미드를 주면 셀을 감싸는 가장 큰 빈 블록(min/max가 iso 미포함)을 찾아 블록 출구까지 한 번에 건너뜀
+* - 부호가 바뀐 구간은 이분법으로 근을 정밀화
+* - 비용은 레이가 지나는 셀 수(최대 sx + sy + sz)에 비례, 메시 크기와 무관
+* - 좌표는 필드 로컬 공간 : 샘플 (x,y,z) 위치 = origin + (x,y,z) * cellsize
+*/
+namespace SdfRaycast
+{
+	struct Hit
+	{
+		DirectX::XMFLOAT3 position{};
+		DirectX::XMFLOAT3 normal{};	// 외부(값 < iso) 방향, 메시 노말과 동일한 규약
+		float distance = 0.0f;
+	};
+
+	// dir은 정규화되지 않아도 됨 (distance는 정규화된 방향 기준). mips는 field와 같은 상태여야 한다 (없으면 셀 단위 DDA만)
+	bool Raycast(const SdfField<float>& field, const DirectX::XMFLOAT3& origin, float cellsize, float iso,
+		const DirectX::XMFLOAT3& rayOrigin, const DirectX::XMFLOAT3& rayDir, float maxDistance, Hit& outHit,
+		const SdfMipPyramid* mips = nullptr);
+
+	// 임의 위치 trilinear 샘플 (필드 밖은 경계로 클램프), 좌표는 격자 인덱스 공간
+	float SampleTrilinear(const SdfField<float>& field, float gx, float gy, float gz);
+	// 값 + 같은 셀의 trilinear 해석 gradient (격자 단위당 변화량, 셀 경계에서 불연속)
+	float SampleTrilinearGradient(const SdfField<float>& field, float gx, float gy, float gz, DirectX::XMFLOAT3& outGradient);
+}
@@ -0,0 +1,248 @@
+#include "pch.h"
+#include "SdfRedistance.h"
+#include "Core/Utils/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+	constexpr float kFar = 1e30f;			// 아직 도달하지 않은 샘플
+	constexpr int kSweepOrders = 8;			// (±x, ±y, ±z) 순서 조합
+
+	struct Region
+	{
+		DirectX::XMINT3 lo{};
+		int nx = 0, ny = 0, nz = 0;
+
+		size_t count() const { return static_cast<size_t>(nx) * ny * nz; }
+		size_t index(int x, int y, int z) const { return (static_cast<size_t>(z) * ny + y) * nx + x; }
+	};
+
+	// Godunov 상류 차분 : 축별 이웃 최솟값 a <= b <= c 로 |grad d| = 1 을 푼다
+	inline float SolveEikonal(float a, float b, float c, float h)
+	{
+		if (a > b) std::swap(a, b);
+		if (b > c) std::swap(b, c);
+		if (a > b) std::swap(a, b);
+		if (a >= kFar) return kFar;
+
+		float u = a + h;
+		if (u <= b) return u;
+
+		u = 0.5f * (a + b + std::sqrt(std::max(2.0f * h * h - (a - b) * (a - b), 0.0f)));
+		if (u <= c) return u;
+
+		const float s = a + b + c;
+		const float q = s * s - 3.0f * (a * a + b * b + c * c - h * h);
+		return (s + std::sqrt(std::max(q, 0.0f))) / 3.0f;
+	}
+
+	// order 비트 0/1/2 = x/y/z 역방향. limit보다 먼 값은 기록하지 않아 band 밖 샘플은 kFar로 남는다 (이웃 갱신도 바로 건너뜀)
+	void Sweep(const Region& r, const std::vector<uint8_t>& frozen, float h, float limit, int order, std::vector<float>& d)
+	{
+		const int dir[3] = { (order & 1) ? -1 : 1, (order & 2) ? -1 : 1, (order & 4) ? -1 : 1 };
+		const int start[3] = { dir[0] > 0 ? 0 : r.nx - 1, dir[1] > 0 ? 0 : r.ny - 1, dir[2] > 0 ? 0 : r.nz - 1 };
+		const size_t strideY = static_cast<size_t>(r.nx);
+		const size_t strideZ = static_cast<size_t>(r.nx) * r.ny;
+
+		for (int iz = 0, z = start[2]; iz < r.nz; ++iz, z += dir[2])
+		{
+			for (int iy = 0, y = start[1]; iy < r.ny; ++iy, y += dir[1])
+			{
+				for (int ix = 0, x = start[0]; ix < r.nx; ++ix, x += dir[0])
+				{
+					const size_t i = r.index(x, y, z);
+					if (frozen[i]) continue;
+
+					const float a = std::min(x > 0 ? d[i - 1] : kFar, x + 1 < r.nx ? d[i + 1] : kFar);
+					const float b = std::min(y > 0 ? d[i - strideY] : kFar, y + 1 < r.ny ? d[i + strideY] : kFar);
+					const float c = std::min(z > 0 ? d[i - strideZ] : kFar, z + 1 < r.nz ? d[i + strideZ] : kFar);
+					const float u = SolveEikonal(a, b, c, h);
+					if (u < d[i] && u <= limit) d[i] = u;
+				}
+			}
+		}
+	}
+}
+
+namespace SdfRedistance
+{
+	bool Redistance(SdfField<float>& field, const DirectX::XMINT3& sampleMin, const DirectX::XMINT3& sampleMax, const Desc& desc, Stats* outStats)
+	{
+		if (field.empty() || desc.cellsize <= 0.0f) return false;
+
+		const int dims[3] = { field.sx(), field.sy(), field.sz() };
+		const int wMin[3] = { std::max(sampleMin.x, 0), std::max(sampleMin.y, 0), std::max(sampleMin.z, 0) };
+		const int wMax[3] = { std::min(sampleMax.x, dims[0] - 1), std::min(sampleMax.y, dims[1] - 1), std::min(sampleMax.z, dims[2] - 1) };
+		if (wMin[0] > wMax[0] || wMin[1] > wMax[1] || wMin[2] > wMax[2]) return false;
+
+		// 계산 영역 = 쓰기 영역 + (band + 1) 샘플
+		const float h = desc.cellsize;
+		const float band = std::max(desc.bandCells, 1.0f) * h;
+		const int margin = static_cast<int>(std::ceil(std::max(desc.bandCells, 1.0f))) + 1;
+		Region r;
+		int hi[3];
+		int lo[3];
+		for (int a = 0; a < 3; ++a)
+		{
+			lo[a] = std::max(wMin[a] - margin, 0);
+			hi[a] = std::min(wMax[a] + margin, dims[a] - 1);
+		}
+		r.lo = { lo[0], lo[1], lo[2] };
+		r.nx = hi[0] - lo[0] + 1;
+		r.ny = hi[1] - lo[1] + 1;
+		r.nz = hi[2] - lo[2] + 1;
+
+		const size_t n = r.count();
+		const size_t strideY = static_cast<size_t>(r.nx);
+		const size_t strideZ = static_cast<size_t>(r.nx) * r.ny;
+		ThreadPool& pool = ThreadPool::Get();
+
+		// 1. phi = f - iso 복사 (행 단위)
+		std::vector<float> phi(n);
+		pool.ParallelForStatic(0, static_cast<size_t>(r.nz), [&](size_t zBegin, size_t zEnd) {
+			for (size_t z = zBegin; z < zEnd; ++z)
+			{
+				for (int y = 0; y < r.ny; ++y)
+				{
+					float* row = phi.data() + r.index(0, y, static_cast<int>(z));
+					field.readRow(lo[1] + y, lo[2] + static_cast<int>(z), lo[0], r.nx, row);
+					for (int x = 0; x < r.nx; ++x) row[x] -= desc.isoValue;
+				}
+			}
+		});
+
+		// 2. 경계면 초기화 + 경계면 gradient 크기 수집 (z 슬랩별)
+		std::vector<float> dist(n, kFar);
+		std::vector<uint8_t> frozen(n, 0);
+		std::vector<std::vector<float>> slabGradients(static_cast<size_t>(r.nz));
+		pool.ParallelFor(0, static_cast<size_t>(r.nz), 1, [&](size_t zBegin, size_t zEnd) {
+			for (size_t zs = zBegin; zs < zEnd; ++zs)
+			{
+				const int z = static_cast<int>(zs);
+				for (int y = 0; y < r.ny; ++y)
+				{
+					for (int x = 0; x < r.nx; ++x)
+					{
+						const size_t i = r.index(x, y, z);
+						const float p = phi[i];
+						const int coord[3] = { x, y, z };
+						const int extent[3] = { r.nx, r.ny, r.nz };
+						const size_t stride[3] = { 1, strideY, strideZ };
+
+						float inv2 = 0.0f;
+						bool crossing = false;
+						for (int a = 0; a < 3; ++a)
+						{
+							float axisDist = kFar;
+							if (coord[a] > 0)
+							{
+								const float q = phi[i - stride[a]];
+								if ((p >= 0.0f) != (q >= 0.0f)) axisDist = std::min(axisDist, p / (p - q) * h);
+							}
+							if (coord[a] + 1 < extent[a])
+							{
+								const float q = phi[i + stride[a]];
+								if ((p >= 0.0f) != (q >= 0.0f)) axisDist = std::min(axisDist, p / (p - q) * h);
+							}
+							if (axisDist < kFar)
+							{
+								crossing = true;
+								const float da = std::max(axisDist, 1e-6f * h);
+								inv2 += 1.0f / (da * da);
+							}
+						}
+						if (!crossing) continue;
+
+						dist[i] = 1.0f / std::sqrt(inv2);
+						frozen[i] = 1;
+
+						// 중앙 차분 (영역 가장자리는 단측)
+						float g2 = 0.0f;
+						for (int a = 0; a < 3; ++a)
+						{
+							const size_t im = (coord[a] > 0) ? i - stride[a] : i;
+							const size_t ip = (coord[a] + 1 < extent[a]) ? i + stride[a] : i;
+							const float span = static_cast<float>((ip != i) + (im != i)) * h;
+							const float g = (span > 0.0f) ? (phi[ip] - phi[im]) / span : 0.0f;
+							g2 += g * g;
+						}
+						slabGradients[zs].push_back(std::sqrt(g2));
+					}
+				}
+			}
+		});
+
+		std::vector<float> gradients;
+		for (auto& s : slabGradients) gradients.insert(gradients.end(), s.begin(), s.end());
+		if (gradients.empty()) return false;	// 영역 안에 표면 없음
+
+		float valueScale = desc.valueScale;
+		if (valueScale <= 0.0f)
+		{
+			auto mid = gradients.begin() + gradients.size() / 2;
+			std::nth_element(gradients.begin(), mid, gradients.end());
+			valueScale = *mid;
+		}
+		if (!(valueScale > 0.0f)) return false;
+
+		// 3. 병렬 fast sweeping : 순서별 복사본 -> 최솟값 병합, 변화가 없으면 종료
+		std::vector<std::vector<float>> work(kSweepOrders);
+		const float tolerance = 1e-4f * h;
+		uint32_t iterations = 0;
+		for (int it = 0; it < std::max(desc.maxIterations, 1); ++it)
+		{
+			++iterations;
+			pool.ParallelFor(0, kSweepOrders, 1, [&](size_t begin, size_t end) {
+				for (size_t k = begin; k < end; ++k)
+				{
+					work[k] = dist;
+					Sweep(r, frozen, h, band + h, static_cast<int>(k), work[k]);
+				}
+			});
+
+			float maxChange = 0.0f;
+			for (size_t i = 0; i < n; ++i)
+			{
+				float m = work[0][i];
+				for (int k = 1; k < kSweepOrders; ++k) m = std::min(m, work[k][i]);
+				if (m < dist[i])
+				{
+					// band 밖 변화는 결과(클램프)에 영향 없음
+					if (m < band) maxChange = std::max(maxChange, std::min(dist[i], band) - m);
+					dist[i] = m;
+				}
+			}
+			if (maxChange <= tolerance) break;
+		}
+
+		// 4. 쓰기 영역에 부호 거리 기록
+		const int writeCount = wMax[0] - wMin[0] + 1;
+		pool.ParallelForStatic(static_cast<size_t>(wMin[2]), static_cast<size_t>(wMax[2]) + 1, [&](size_t zBegin, size_t zEnd) {
+			std::vector<float> row(static_cast<size_t>(writeCount));
+			for (size_t gz = zBegin; gz < zEnd; ++gz)
+			{
+				const int z = static_cast<int>(gz) - lo[2];
+				for (int gy = wMin[1]; gy <= wMax[1]; ++gy)
+				{
+					const size_t base = r.index(wMin[0] - lo[0], gy - lo[1], z);
+					for (int x = 0; x < writeCount; ++x)
+					{
+						const float d = std::min(dist[base + x], band);
+						row[x] = desc.isoValue + ((phi[base + x] >= 0.0f) ? d : -d) * valueScale;
+					}
+					field.writeRow(gy, static_cast<int>(gz), wMin[0], writeCount, row.data());
+				}
+			}
+		});
+
+		if (outStats)
+		{
+			outStats->interfaceSamples = static_cast<uint32_t>(gradients.size());
+			outStats->iterations = iterations;
+			outStats->valueScale = valueScale;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "Core/Geometry/MarchingCubes/SdfField.h"
+#include <DirectXMath.h>
+
+/*
+* SdfField 재거리화 (brush 블렌딩으로 |grad f| 가 흐트러진 영역을 다시 거리장으로 복원)
+* - 경계면 초기화 : 부호가 바뀌는 6-이웃 엣지의 선형 보간 교차점까지 축별 거리를 합성 (d = 1 / sqrt(sum 1/d_a^2))
+* - 나머지 샘플 : Eikonal |grad d| = 1 을 fast sweeping (Godunov 상류 차분) 으로 전파
+*   병렬화는 Zhao(2007) 방식 : 8개 sweep 순서를 각자 복사본에서 동시에 돌리고 최솟값으로 병합, 수렴할 때까지 반복
+* - 쓰기 : f = iso + sign * min(d, band) * valueScale (내부 > iso). 부호는 원래 필드 그대로라 표면 위치는 셀 이하로만 움직인다.
+* - valueScale 을 주지 않으면 경계면 |grad f| 의 중앙값을 써서 영역의 현재 값 스케일을 유지 (영역 밖과 이어지도록)
+* - 계산은 쓰기 영역보다 band + 1 샘플 넓게 읽어서 하므로, 쓰기 영역 안의 band 이내 거리는 영역 경계의 영향을 받지 않는다.
+*/
+namespace SdfRedistance
+{
+	struct Desc
+	{
+		float isoValue = 0.0f;
+		float cellsize = 1.0f;
+		float bandCells = 6.0f;		// 결과 |거리| 상한 (셀 단위), 그 밖은 클램프
+		float valueScale = 0.0f;	// 필드 값 / 월드 거리. 0 이하면 경계면 gradient로 추정
+		int maxIterations = 4;		// 병렬 sweep 반복 상한
+	};
+
+	struct Stats
+	{
+		uint32_t interfaceSamples = 0;
+		uint32_t iterations = 0;
+		float valueScale = 0.0f;
+	};
+
+	// 샘플 범위 [sampleMin, sampleMax] (양 끝 포함) 를 다시 쓴다. 영역 안에 표면이 없으면 아무것도 하지 않고 false
+	bool Redistance(SdfField<float>& field, const DirectX::XMINT3& sampleMin, const DirectX::XMINT3& sampleMax, const Desc& desc, Stats* outStats = nullptr);
+}
@@ -2,11 +2,13 @@
 #include "TerrainSystem.h"
 #include "Core/Geometry/MarchingCubes/GPU/GPUTerrainBackend.h"
 #include "Core/Geometry/MarchingCubes/CPU/MC33/MC33TerrainBackend.h"
+#include "Core/Geometry/MarchingCubes/CPU/MC/MCTerrainBackend.h"
 #include "Core/Geometry/Mesh/MeshChunkRenderer.h"
 #include "Core/Rendering/RenderSystem.h"
 
 TerrainSystem::TerrainSystem(const InitInfo& info) :
 	m_desc(info.desc),
+	m_particleSurface(info.particleSurface),
 	m_descriptorAllocator(info.descriptorAllocator),
 	m_uploadContext(info.uploadContext)
 {
@@ -16,7 +18,7 @@ TerrainSystem::TerrainSystem(const InitInfo& info) :
 	}
 	m_chunkRenderer = std::make_unique<MeshChunkRenderer>();
 	setMode(info.device, info.mode);
-	setField(info.device, info.grid);
+	setField(info.device, m_particleSurface ? makeParticleSurfaceField() : info.grid);
 }
 
 TerrainSystem::TerrainSystem(ID3D12Device* device, std::shared_ptr<SdfField<float>> grid, const GridDesc& desc, TerrainMode mode) :
@@ -41,6 +43,11 @@ void TerrainSystem::setMode(ID3D12Device* device, TerrainMode mode)
 			m_backend = std::make_unique<GPUTerrainBackend>(device, m_desc, initInfo);
 		}
 		break;
+		case TerrainMode::CPU_MC:
+		{
+			m_backend = std::make_unique<MCTerrainBackend>(device, m_desc);
+		}
+		break;
 		case TerrainMode::CPU_MC33:
 		default:
 		{
@@ -49,12 +56,28 @@ void TerrainSystem::setMode(ID3D12Device* device, TerrainMode mode)
 		break;
 	}
 
+	// 백엔드 교체 시 기존 필드/모드 설정 재적용
+	m_backend->setIsoScrub(m_isoScrub);
+	m_backend->setMipPyramid(m_mipPyramid);
+	if (m_lastGRD) m_backend->setFieldPtr(m_lastGRD);
 }
 
 void TerrainSystem::setGridDesc(ID3D12Device* device, const GridDesc& d)
 {
 	m_desc = d;
 	m_backend->setGridDesc(d);
+	// 유체 필드는 샘플 크기가 바뀔 때만 다시 만든다 (크기가 같으면 래스터라이저의 브릭 상태를 그대로 이어 씀)
+	if (m_particleSurface && m_lastGRD &&
+		(m_lastGRD->sx() != int(d.cells.x) + 1 || m_lastGRD->sy() != int(d.cells.y) + 1 || m_lastGRD->sz() != int(d.cells.z) + 1))
+	{
+		setField(device, makeParticleSurfaceField());
+	}
+}
+
+std::shared_ptr<SdfField<float>> TerrainSystem::makeParticleSurfaceField() const
+{
+	// 값은 SdfParticleRasterizer 가 처음 호출될 때 전체를 빈 값으로 채운다 (필드 포인터나 크기가 바뀌면 다시)
+	return std::make_shared<SdfField<float>>(int(m_desc.cells.x) + 1, int(m_desc.cells.y) + 1, int(m_desc.cells.z) + 1);
 }
 
 void TerrainSystem::setField(ID3D12Device* device, std::shared_ptr<SdfField<float>> grid)
@@ -63,6 +86,23 @@ void TerrainSystem::setField(ID3D12Device* device, std::shared_ptr<SdfField<floa
 	if (m_backend && m_lastGRD) m_backend->setFieldPtr(m_lastGRD);
 }
 
+void TerrainSystem::setIsoScrub(bool enable)
+{
+	m_isoScrub = enable;
+	if (m_backend) m_backend->setIsoScrub(enable);
+}
+
+void TerrainSystem::setMipPyramid(bool enable)
+{
+	m_mipPyramid = enable;
+	if (m_backend) m_backend->setMipPyramid(enable);
+}
+
+const SdfMipPyramid* TerrainSystem::getMipPyramid() const
+{
+	return m_backend ? m_backend->getMipPyramid() : nullptr;
+}
+
 void TerrainSystem::requestRemesh(uint32_t frameIndex, const RemeshRequest& r)
 {
 	m_backend->requestRemesh(frameIndex, r);
@@ -87,6 +127,59 @@ void TerrainSystem::requestBrush(uint32_t frameIndex, const BrushRequest& r)
 	m_backend->requestBrush(frameIndex, r);
 }
 
+void TerrainSystem::endStroke(uint32_t frameIndex, float isoValue)
+{
+	if (!m_backend) return;
+	m_backend->endStroke(frameIndex, isoValue);
+}
+
+bool TerrainSystem::canRaycastField() const
+{
+	return m_backend && m_lastGRD && m_backend->isFieldCPUResident();
+}
+
+bool TerrainSystem::raycast(const DirectX::XMFLOAT3& rayOriginLS, const DirectX::XMFLOAT3& rayDirLS, float isoValue, SdfRaycast::Hit& outHit, float maxDistance) const
+{
+	if (!canRaycastField()) return false;
+	return SdfRaycast::Raycast(*m_lastGRD, m_desc.origin, m_desc.cellsize, isoValue, rayOriginLS, rayDirLS, maxDistance, outHit, getMipPyramid());
+}
+
+bool TerrainSystem::getCollisionVolume(float isoValue, SdfCollision::Volume& outVolume) const
+{
+	if (!canRaycastField()) return false;
+	outVolume = SdfCollision::Volume{
+		.field = m_lastGRD.get(),
+		.origin = m_desc.origin,
+		.cellsize = m_desc.cellsize,
+		.isoValue = isoValue
+	};
+	return true;
+}
+
+bool TerrainSystem::stampMesh(uint32_t frameIndex, const TriangleBVH& meshLS, const SdfMeshVoxelizer::Desc& desc, SdfMeshVoxelizer::Stats* outStats)
+{
+	if (!canRaycastField()) return false;
+
+	XMINT3 sampleMin, sampleMax;
+	if (!SdfMeshVoxelizer::ComputeRegion(*m_lastGRD, m_desc, meshLS, desc, sampleMin, sampleMax)) return false;
+
+	SdfMeshVoxelizer::Stamp(*m_lastGRD, m_desc, meshLS, desc, sampleMin, sampleMax, outStats);
+	m_backend->notifyFieldEdited(frameIndex, sampleMin, sampleMax, desc.isoValue);
+	return true;
+}
+
+bool TerrainSystem::rasterizeParticles(uint32_t frameIndex, SdfParticleRasterizer& rasterizer, const FluidParticleArrays& particlesLS,
+	const SdfParticleRasterizer::Desc& desc, SdfParticleRasterizer::Stats* outStats)
+{
+	if (!m_particleSurface || !canRaycastField()) return false;
+
+	XMINT3 sampleMin, sampleMax;
+	if (!rasterizer.Rasterize(particlesLS, desc, *m_lastGRD, m_desc, sampleMin, sampleMax, outStats)) return false;
+
+	m_backend->notifyFieldEdited(frameIndex, sampleMin, sampleMax, desc.isoValue);
+	return true;
+}
+
 void TerrainSystem::tryFetch()
 {
 	if (!m_backend || !m_uploadContext) return;
@@ -94,6 +187,7 @@ void TerrainSystem::tryFetch()
 	std::vector<ChunkUpdate> ups;
 	if (m_backend && m_backend->tryFetch(ups))
 	{
+		// 청크 BVH 는 여기서 만들지 않는다 (메시 피킹이 필요할 때 MeshChunkRenderer::BuildMissingBVHs)
 		m_chunkRenderer->ApplyUpdates(m_uploadContext, ups);
 	}
 }
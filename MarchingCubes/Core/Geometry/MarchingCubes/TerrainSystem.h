@@ -1,5 +1,9 @@
 #pragma once
 #include "ITerrainBackend.h"
+#include "SdfRaycast.h"
+#include "SdfCollision.h"
+#include "SdfMeshVoxelizer.h"
+#include "SdfParticleRasterizer.h"
 #include <any>
 
 // Forward Declaration
@@ -17,6 +21,7 @@ public:
 		std::shared_ptr<SdfField<float>> grid;
 		const GridDesc& desc;
 		TerrainMode mode = TerrainMode::CPU_MC33;
+		bool particleSurface = false;	// 유체 표면 전용 : grid 대신 desc 크기의 빈 필드를 직접 만들고 rasterizeParticles 만 이 필드에 쓴다
 		
 		DescriptorAllocator* descriptorAllocator = nullptr;
 		UploadContext* uploadContext = nullptr;
@@ -30,8 +35,28 @@ public:
 	void setGridDesc(ID3D12Device* deivce, const GridDesc& d);
 	void setField(ID3D12Device* device, std::shared_ptr<SdfField<float>> grid);
 	void requestRemesh(uint32_t frameIndex, const RemeshRequest& r);
-	void requestRemesh(uint32_t frameIndex, float isoValue = 0.0f); // ü Remesh
+	void requestRemesh(uint32_t frameIndex, float isoValue = 0.0f); // 전체 Remesh
 	void requestBrush(uint32_t frameIndex, const BrushRequest& r);
+	void endStroke(uint32_t frameIndex, float isoValue); // 브러시 입력이 끝났을 때 호출 : 스트로크 영역 SDF 재거리화 예약 (CPU 백엔드, 이후 프레임에 나눠 처리)
+	void setIsoScrub(bool enable); // true : iso 변경 시 Span-Space 인덱스로 활성 셀만 재추출
+	bool isIsoScrub() const { return m_isoScrub; }
+	void setMipPyramid(bool enable); // true : CPU 필드 밉 피라미드 유지 (raycast 빈 공간 건너뛰기, 거친 필드 질의)
+	bool isMipPyramid() const { return m_mipPyramid; }
+	bool isParticleSurface() const { return m_particleSurface; }
+	const SdfMipPyramid* getMipPyramid() const; // 필드와 같은 상태의 피라미드 (없으면 nullptr)
+	TerrainMode getMode() const { return m_mode; }
+
+	// 지형 로컬 공간 레이로 SdfField를 직접 추적 (메시/청크 상태와 무관). CPU 필드를 쓰는 백엔드에서만 유효
+	bool canRaycastField() const;
+	bool raycast(const DirectX::XMFLOAT3& rayOriginLS, const DirectX::XMFLOAT3& rayDirLS, float isoValue, SdfRaycast::Hit& outHit, float maxDistance = FLT_MAX) const;
+	// SDF 충돌 질의용 볼륨 (지형 로컬 공간). brush 적용과 같은 스레드에서, 다음 brush 전까지 사용
+	bool getCollisionVolume(float isoValue, SdfCollision::Volume& outVolume) const;
+	// 지형 로컬 공간 BVH 메시를 CPU 필드에 CSG로 찍고 바뀐 영역만 재메싱. CPU 필드를 쓰는 백엔드에서만 유효
+	bool stampMesh(uint32_t frameIndex, const TriangleBVH& meshLS, const SdfMeshVoxelizer::Desc& desc, SdfMeshVoxelizer::Stats* outStats = nullptr);
+	// 유체 입자 (지형 로컬 공간) 를 이 시스템이 가진 유체 필드에 색 필드로 래스터화하고 바뀐 브릭 영역만 재메싱
+	// InitInfo::particleSurface 로 만든 시스템에서만 유효 (지형 필드를 받은 시스템은 false, 필드를 건드리지 않음)
+	bool rasterizeParticles(uint32_t frameIndex, SdfParticleRasterizer& rasterizer, const FluidParticleArrays& particlesLS,
+		const SdfParticleRasterizer::Desc& desc, SdfParticleRasterizer::Stats* outStats = nullptr);
 
 	void tryFetch();
 
@@ -45,10 +70,16 @@ public:
 	void EraseChunk(RenderSystem* renderSystem);
 #endif // _DEBUG
 	
+private:
+	std::shared_ptr<SdfField<float>> makeParticleSurfaceField() const;	// m_desc 샘플 크기 (cells + 1) 의 빈 필드
+
 private:
 	TerrainMode				m_mode{ TerrainMode::GPU_ORIGINAL };
 	std::shared_ptr<SdfField<float>>	m_lastGRD;
 	GridDesc				m_desc{};
+	bool					m_isoScrub = false;
+	bool					m_mipPyramid = false;
+	bool					m_particleSurface = false;	// m_lastGRD 는 이 시스템이 만든 유체 필드
 
 	DescriptorAllocator* m_descriptorAllocator = nullptr;
 	UploadContext* m_uploadContext = nullptr;
@@ -22,7 +22,7 @@ Mesh::Mesh(UploadContext* uploadcontext, const GeometryData& data, const std::ve
 	{
 		if (m_debugName.empty())
 		{
-			//ӽ ̸ 
+			//임시 이름 세팅
 			SetDebugName("MeshInstance");
 		}
 		uploadcontext->UploadGeometry(&m_buffer, m_cpu, m_debugName);
@@ -63,7 +63,7 @@ void Mesh::SetColor(const DirectX::XMFLOAT4& color)
 
 void Mesh::BuildTriBounds()
 {
-	// AABB BroadPhase  Bound 
+	// AABB BroadPhase를 위한 Bound 세팅
 	m_triBounds.clear();
 	m_triBounds.reserve(m_submeshes.size());
 
@@ -71,7 +71,7 @@ void Mesh::BuildTriBounds()
 	const auto& indices = m_cpu.indices;
 	for (const auto& submesh : m_submeshes)
 	{
-		// ȿ  ޽ ó
+		// 유효하지 않은 서브메쉬 처리
 		if (submesh.indexCount == 0)
 		{
 			m_triBounds.emplace_back(BoundingBox());
@@ -91,7 +91,7 @@ void Mesh::BuildTriBounds()
 			}
 		}
 
-		//  Min, Max  AABB 
+		// 계산된 Min, Max를 기반으로 AABB 생성
 		BoundingBox submeshBox;
 		BoundingBox::CreateFromPoints(submeshBox, vMin, vMax);
 
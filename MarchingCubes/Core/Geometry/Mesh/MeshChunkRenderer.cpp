@@ -2,6 +2,7 @@
 #include "MeshChunkRenderer.h"
 #include "Core/Rendering/UploadContext.h"
 #include "Core/Rendering/RenderSystem.h"
+#include "Core/Utils/ThreadPool.h"
 #include <DirectXMath.h>
 #include <DirectXCollision.h>
 
@@ -9,44 +10,74 @@ MeshChunkRenderer::MeshChunkRenderer()
 {
 }
 
-void MeshChunkRenderer::ApplyUpdates(UploadContext* uploadContext, const std::vector<ChunkUpdate>& ups)
+void MeshChunkRenderer::ApplyUpdates(UploadContext* uploadContext, std::vector<ChunkUpdate>& ups)
 {
+	// 삼각형이 참조하는 정점 기준 (브릭 배치 청크는 예비 정점이 섞여 있어 정점 배열 전체로 잡으면 커진다)
+	// 브릭의 빈 인덱스 칸인 (0, 0, 0) degenerate 삼각형은 정점 0을 끌어들이므로 건너뛴다
 	auto buildTriBounds = [](const GeometryData& meshdata, BoundingBox& OutBounds){
 		const auto& vertices = meshdata.vertices;
-		if (vertices.empty())
+		const auto& indices = meshdata.indices;
+		XMVECTOR mn = XMVectorReplicate(FLT_MAX);
+		XMVECTOR mx = XMVectorReplicate(-FLT_MAX);
+		bool any = false;
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			const uint32_t i0 = indices[i], i1 = indices[i + 1], i2 = indices[i + 2];
+			if (i0 == i1 && i1 == i2) continue;
+			for (uint32_t index : { i0, i1, i2 })
+			{
+				const XMVECTOR p = XMLoadFloat3(&vertices[index].pos);
+				mn = XMVectorMin(mn, p);
+				mx = XMVectorMax(mx, p);
+			}
+			any = true;
+		}
+		if (!any)
 		{
 			OutBounds = {};
 			return;
 		}
-
-		BoundingBox::CreateFromPoints(OutBounds, vertices.size(), &vertices[0].pos, sizeof(Vertex));
+		BoundingBox::CreateFromPoints(OutBounds, mn, mx);
 	};
 
 	if (!uploadContext) return;
 
-	for (const auto& u : ups)
+	for (auto& u : ups)
 	{
-		// 1.  ûũų ε  
+		std::string debugName = std::format("Chunk_{}_{}_{}", u.key.x, u.key.y, u.key.z);
+
+		// 1. 부분 갱신 : u.md는 바뀐 구간만 담은 patch이므로 슬롯의 CPU 메쉬에 덮어쓰고 그 구간만 업로드
+		if (!u.ranges.empty())
+		{
+			auto it = m_chunks.find(u.key);
+			if (it == m_chunks.end()) continue;	// 전체 갱신 없이 patch만 온 경우 (배치를 모르므로 무시)
+
+			ChunkSlot& slot = it->second;
+			if (!ApplyGeometryPatch(slot.meshData, u.md, u.ranges)) continue;
+			slot.bvh.reset();
+			buildTriBounds(slot.meshData, slot.bounds);
+			uploadContext->UploadGeometryRanges(&slot.buffer, slot.meshData, u.ranges, debugName);
+			continue;
+		}
+
+		// 2. 빈 청크거나 인덱스가 없으면 삭제
 		if (u.empty || u.md.indices.empty())
 		{
 			m_chunks.erase(u.key);
 			continue;
 		}
 
-		// 2.  Ȯ
+		// 3. 슬롯 확보 (전체 메쉬는 복사 없이 넘겨받는다)
 		ChunkSlot& slot = m_chunks[u.key];
-		slot.meshData = u.md;
-		slot.indexCount = static_cast<uint32_t>(u.md.indices.size());
+		slot.meshData = std::move(u.md);
+		slot.indexCount = static_cast<uint32_t>(slot.meshData.indices.size());
+		slot.bvh.reset();
 
-		// 3. ٿ ڽ 
-		if (!u.md.vertices.empty())
-		{
-			DirectX::BoundingBox::CreateFromPoints(slot.bounds, u.md.vertices.size(), &u.md.vertices[0].pos, sizeof(Vertex));
-		}
+		// 4. 바운딩 박스 계산
+		buildTriBounds(slot.meshData, slot.bounds);
 
-		// 4.  ε û (UploadContext ߺ üũ  Ҵ )
-		std::string debugName = std::format("Chunk_{}_{}_{}", u.key.x, u.key.y, u.key.z);
-		uploadContext->UploadGeometry(&slot.buffer, u.md, debugName);
+		// 5. 버퍼 업로드 요청 (UploadContext가 중복 체크 및 재할당 담당)
+		uploadContext->UploadGeometry(&slot.buffer, slot.meshData, debugName);
 	}
 }
 
@@ -79,6 +110,25 @@ void MeshChunkRenderer::Clear()
 	m_chunks.clear();
 }
 
+void MeshChunkRenderer::BuildMissingBVHs()
+{
+	std::vector<ChunkSlot*> pending;
+	for (auto& [key, slot] : m_chunks)
+	{
+		if (slot.indexCount > 0 && !slot.bvh) pending.push_back(&slot);
+	}
+	if (pending.empty()) return;
+
+	ThreadPool::Get().ParallelFor(0, pending.size(), 1, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+		{
+			auto bvh = std::make_shared<TriangleBVH>();
+			bvh->Build(pending[i]->meshData);
+			pending[i]->bvh = std::move(bvh);
+		}
+	});
+}
+
 std::vector<BoundingBox> MeshChunkRenderer::GetBoundingBox() const
 {
 	std::vector<DirectX::BoundingBox> out;
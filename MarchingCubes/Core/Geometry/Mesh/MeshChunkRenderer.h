@@ -14,6 +14,7 @@ struct ChunkSlot
 	GeometryData meshData;
 	uint32_t indexCount = 0;
 	DirectX::BoundingBox bounds;
+	std::shared_ptr<const TriangleBVH> bvh;	// 메시 피킹용. 재메싱되면 비우고 BuildMissingBVHs 에서 다시 빌드
 };
 
 class MeshChunkRenderer final
@@ -22,9 +23,12 @@ public:
 	MeshChunkRenderer();
 	~MeshChunkRenderer() = default;
 
-	void ApplyUpdates(UploadContext* uploadContext, const std::vector<ChunkUpdate>& ups);
+	// 전체 갱신의 메쉬는 슬롯으로 옮겨 가므로 ups 의 md 는 호출 후 비어 있을 수 있다
+	void ApplyUpdates(UploadContext* uploadContext, std::vector<ChunkUpdate>& ups);
 	void Submit(RenderSystem* renderSystem, const DirectX::XMFLOAT4X4& worldMatrix, const MaterialInstance& material);
 	void Clear();
+	// BVH 가 없는 청크만 빌드 (청크 단위 병렬). 메시 레이캐스트 직전에 호출 (CPU 필드 모드는 SDF 레이캐스트라 필요 없음)
+	void BuildMissingBVHs();
 
 	std::vector<BoundingBox> GetBoundingBox() const;	
 	std::vector<ChunkSlot*> GetChunkSlots();
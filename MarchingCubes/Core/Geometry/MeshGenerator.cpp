@@ -134,7 +134,7 @@ namespace MeshGenerator
 			{
 				for (int k = 0; k < Z; ++k)
 				{
-					//   ù  ε
+					// 이 셀의 첫 정점 인덱스
 					int base = idx(i, j, k);
 					pushMCVertex(i, j, k);
 
@@ -116,7 +116,7 @@ ActionKeyState InputState::GetKeyState(ActionKey action) const
 	return ActionKeyState::NONE;
 }
 
-// TODO : Ű  Ŀ͸¡  ߰ (Ư Ű  ڿ <-> VK  ̺ ߰)
+// TODO : 키 매핑 커스터마이징 기능 추가 (특수 키를 위한 문자열 <-> VK 매핑 테이블 추가)
 void InputState::LoadKeyBindingsFromIni(const std::wstring& filename)
 {
 	const wchar_t* section = L"KeyBindings";
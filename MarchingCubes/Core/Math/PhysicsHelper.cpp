@@ -1,2 +1,157 @@
 ﻿#include "pch.h"
 #include "PhysicsHelper.h"
+#include "Core/Utils/ThreadPool.h"
+#include <algorithm>
+
+namespace PhysicsUtil
+{
+	namespace
+	{
+		using RayPacket = TriangleBVH::RayPacket;
+		constexpr uint32_t kPacketWidth = RayPacket::kWidth;
+		constexpr size_t kPacketGrain = 16;	// ThreadPool 분배 단위 (패킷 수)
+
+		// 레인별 slab 검사 : 교차하는 레인들의 최소 진입 거리 (없으면 FLT_MAX)
+		float PacketEntryDistance(const RayPacket& packet, const BoundingBox& box)
+		{
+			const float bmin[3] = { box.Center.x - box.Extents.x, box.Center.y - box.Extents.y, box.Center.z - box.Extents.z };
+			const float bmax[3] = { box.Center.x + box.Extents.x, box.Center.y + box.Extents.y, box.Center.z + box.Extents.z };
+
+			float entry = FLT_MAX;
+			for (uint32_t l = 0; l < kPacketWidth; ++l)
+			{
+				if (packet.tMax[l] < 0.0f) continue;
+
+				const float o[3] = { packet.ox[l], packet.oy[l], packet.oz[l] };
+				const float d[3] = { packet.dx[l], packet.dy[l], packet.dz[l] };
+				float tNear = 0.0f;
+				float tFar = packet.tMax[l];
+				for (int a = 0; a < 3 && tNear <= tFar; ++a)
+				{
+					if (fabsf(d[a]) < 1e-20f)
+					{
+						if (o[a] < bmin[a] || o[a] > bmax[a]) tNear = FLT_MAX;
+						continue;
+					}
+					float t0 = (bmin[a] - o[a]) / d[a];
+					float t1 = (bmax[a] - o[a]) / d[a];
+					if (t0 > t1) std::swap(t0, t1);
+					tNear = std::max(tNear, t0);
+					tFar = std::min(tFar, t1);
+				}
+				if (tNear <= tFar) entry = std::min(entry, tNear);
+			}
+			return entry;
+		}
+
+		// BVH 없는 타깃 : 레인별 삼각형 전수 검사
+		void RaycastPacketBruteForce(const GeometryData& data, RayPacket& packet)
+		{
+			const auto& vertices = data.vertices;
+			const auto& indices = data.indices;
+			for (uint32_t l = 0; l < kPacketWidth; ++l)
+			{
+				if (packet.tMax[l] < 0.0f) continue;
+
+				const XMVECTOR origin = XMVectorSet(packet.ox[l], packet.oy[l], packet.oz[l], 1.0f);
+				const XMVECTOR dir = XMVectorSet(packet.dx[l], packet.dy[l], packet.dz[l], 0.0f);
+				for (size_t t = 0; t < indices.size() / 3; ++t)
+				{
+					float dist;
+					if (IntersectTriangle(origin, dir,
+						XMLoadFloat3(&vertices[indices[3 * t + 0]].pos),
+						XMLoadFloat3(&vertices[indices[3 * t + 1]].pos),
+						XMLoadFloat3(&vertices[indices[3 * t + 2]].pos), dist) && dist < packet.tMax[l])
+					{
+						packet.tMax[l] = dist;
+						packet.triangle[l] = static_cast<uint32_t>(t);
+					}
+				}
+			}
+		}
+	}
+
+	void RaycastBatch(const std::vector<RaycastTarget>& targets, const std::vector<RayQuery>& rays, std::vector<RayQueryHit>& outHits)
+	{
+		outHits.assign(rays.size(), RayQueryHit{});
+		if (rays.empty() || targets.empty()) return;
+
+		const size_t packetCount = (rays.size() + kPacketWidth - 1) / kPacketWidth;
+		ThreadPool::Get().ParallelFor(0, packetCount, kPacketGrain, [&](size_t packetBegin, size_t packetEnd) {
+			std::vector<std::pair<float, int>> order;
+			order.reserve(targets.size());
+
+			for (size_t p = packetBegin; p < packetEnd; ++p)
+			{
+				// 1. 패킷 구성 (SoA, 방향 정규화, 남는 레인은 비활성)
+				RayPacket packet;
+				const size_t first = p * kPacketWidth;
+				for (uint32_t l = 0; l < kPacketWidth; ++l)
+				{
+					const size_t r = first + l;
+					const RayQuery* ray = (r < rays.size()) ? &rays[r] : nullptr;
+					const float len = ray ? sqrtf(ray->direction.x * ray->direction.x + ray->direction.y * ray->direction.y + ray->direction.z * ray->direction.z) : 0.0f;
+					const bool active = ray && len > 1e-12f;
+					packet.ox[l] = active ? ray->origin.x : 0.0f;
+					packet.oy[l] = active ? ray->origin.y : 0.0f;
+					packet.oz[l] = active ? ray->origin.z : 0.0f;
+					packet.dx[l] = active ? ray->direction.x / len : 0.0f;
+					packet.dy[l] = active ? ray->direction.y / len : 0.0f;
+					packet.dz[l] = active ? ray->direction.z / len : 1.0f;
+					packet.tMax[l] = active ? ray->maxDistance : -1.0f;
+				}
+
+				// 2. 타깃을 패킷 최소 진입 거리 순으로 정렬
+				order.clear();
+				for (int i = 0; i < static_cast<int>(targets.size()); ++i)
+				{
+					if (!targets[i].data) continue;
+					const float entry = PacketEntryDistance(packet, targets[i].bounds);
+					if (entry < FLT_MAX) order.emplace_back(entry, i);
+				}
+				std::sort(order.begin(), order.end());
+
+				// 3. 타깃별 패킷 검사 : 갱신된 레인이 해당 타깃의 최근접 교차
+				int hitTarget[kPacketWidth];
+				uint32_t hitTriangle[kPacketWidth];
+				std::fill(std::begin(hitTarget), std::end(hitTarget), -1);
+				std::fill(std::begin(hitTriangle), std::end(hitTriangle), UINT32_MAX);
+
+				for (const auto& [entry, i] : order)
+				{
+					const float farthest = *std::max_element(std::begin(packet.tMax), std::end(packet.tMax));
+					if (entry >= farthest) break;
+
+					std::fill(std::begin(packet.triangle), std::end(packet.triangle), UINT32_MAX);
+					if (targets[i].bvh) targets[i].bvh->RaycastPacket(packet);
+					else RaycastPacketBruteForce(*targets[i].data, packet);
+
+					for (uint32_t l = 0; l < kPacketWidth; ++l)
+					{
+						if (packet.triangle[l] == UINT32_MAX) continue;
+						hitTarget[l] = i;
+						hitTriangle[l] = packet.triangle[l];
+					}
+				}
+
+				// 4. 결과 기록
+				for (uint32_t l = 0; l < kPacketWidth && first + l < rays.size(); ++l)
+				{
+					if (hitTarget[l] < 0) continue;
+
+					RayQueryHit& out = outHits[first + l];
+					out.hit = true;
+					out.targetIndex = hitTarget[l];
+					out.triangle = hitTriangle[l];
+					out.distance = packet.tMax[l];
+
+					const XMVECTOR hitLocal = XMVectorSet(
+						packet.ox[l] + packet.dx[l] * packet.tMax[l],
+						packet.oy[l] + packet.dy[l] * packet.tMax[l],
+						packet.oz[l] + packet.dz[l] * packet.tMax[l], 1.0f);
+					XMStoreFloat3(&out.position, XMVector3TransformCoord(hitLocal, targets[hitTarget[l]].worldMatrix));
+				}
+			}
+		});
+	}
+}
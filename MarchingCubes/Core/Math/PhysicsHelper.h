@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "Core/Geometry/Mesh/Mesh.h"
+#include "Core/Math/TriangleBVH.h"
 #include <DirectXMath.h>
+#include <algorithm>
 
 namespace PhysicsUtil
 {
@@ -11,6 +13,7 @@ namespace PhysicsUtil
 		const GeometryData* data = nullptr;
 		BoundingBox bounds;
 		const XMMATRIX& worldMatrix;
+		const TriangleBVH* bvh = nullptr;	// 있으면 삼각형 전수 검사 대신 BVH 순회
 	};
 
 	static bool IntersectTriangle(const XMVECTOR& rayOrigin, const XMVECTOR& rayDir, const XMVECTOR& v0, const XMVECTOR& v1, const XMVECTOR& v2, float& outDist)
@@ -108,13 +111,36 @@ namespace PhysicsUtil
 		float closestDist = FLT_MAX;
 		int hitIndex = -1;
 
+		// 상위 단계 : 타깃 AABB 진입 거리 순(front-to-back)으로 정렬, 진입 거리가 현재 최근접보다 멀면 이후 전부 생략
+		std::vector<std::pair<float, int>> order;
+		order.reserve(targets.size());
 		for (int i = 0; i < targets.size(); ++i)
 		{
-			const auto& target = targets[i];
-			if (!target.data) continue;
-
 			float distFromBox;
-			if (!target.bounds.Intersects(rayOriginWorld, rayDirWorld, distFromBox) || distFromBox > closestDist) continue;
+			if (targets[i].data && targets[i].bounds.Intersects(rayOriginWorld, rayDirWorld, distFromBox))
+				order.emplace_back(distFromBox, i);
+		}
+		std::sort(order.begin(), order.end());
+
+		XMFLOAT3 rayOrigin, rayDir;
+		XMStoreFloat3(&rayOrigin, rayOriginWorld);
+		XMStoreFloat3(&rayDir, rayDirWorld);
+
+		for (const auto& [distFromBox, i] : order)
+		{
+			if (distFromBox > closestDist) break;
+
+			const auto& target = targets[i];
+			if (target.bvh)
+			{
+				TriangleBVH::Hit hit;
+				if (target.bvh->Raycast(rayOrigin, rayDir, closestDist, hit))
+				{
+					closestDist = hit.distance;
+					hitIndex = i;
+				}
+				continue;
+			}
 
 			const auto& vertices = target.data->vertices;
 			const auto& indices = target.data->indices;
@@ -144,6 +170,30 @@ namespace PhysicsUtil
 		return true;
 	}
 
+	// 배치 레이 질의 : 레이 N개 -> 결과 N개
+	struct RayQuery
+	{
+		XMFLOAT3 origin{};
+		XMFLOAT3 direction{ 0.0f, 0.0f, 1.0f };	// 정규화되지 않아도 됨 (distance는 정규화된 방향 기준)
+		float maxDistance = FLT_MAX;
+	};
+
+	struct RayQueryHit
+	{
+		bool hit = false;
+		int targetIndex = -1;
+		uint32_t triangle = UINT32_MAX;
+		float distance = FLT_MAX;
+		XMFLOAT3 position{};	// IsHit(targets)와 동일하게 타깃 worldMatrix 적용
+	};
+
+	/*
+	* 레이를 8개 묶음(TriangleBVH::RayPacket)으로 나눠 공용 ThreadPool에서 병렬 처리
+	* - 패킷마다 타깃을 AABB 최소 진입 거리 순으로 검사, BVH가 있는 타깃은 패킷 순회 / 없으면 레인별 삼각형 전수 검사
+	* - 브러시 프리뷰, 시야 판정, 베이킹 등 프레임당 수천 개 레이용. 한두 개는 IsHit가 더 싸다.
+	*/
+	void RaycastBatch(const std::vector<RaycastTarget>& targets, const std::vector<RayQuery>& rays, std::vector<RayQueryHit>& outHits);
+
 	static void MakeRay(const float mouseX, const float mouseY, const float viewportWidth, const float viewportHeight, const DirectX::XMMATRIX& viewproj, XMVECTOR& outRayOrigin, XMVECTOR& outRayDir)
 	{
 		// ScreenSpace -> NDC Space
@@ -0,0 +1,1013 @@
+#include "pch.h"
+#include "TriangleBVH.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <emmintrin.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+struct TriangleBVH::BuildRef
+{
+	DirectX::XMFLOAT3 v0, e1, e2;
+	uint32_t id;
+	float bmin[3];
+	float bmax[3];
+	float centroid[3];
+};
+
+struct TriangleBVH::Range
+{
+	uint32_t begin = 0;
+	uint32_t end = 0;
+	float bmin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+	float bmax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+	uint32_t count() const { return end - begin; }
+	float area() const
+	{
+		const float dx = bmax[0] - bmin[0], dy = bmax[1] - bmin[1], dz = bmax[2] - bmin[2];
+		return (dx < 0.0f) ? 0.0f : 2.0f * (dx * dy + dy * dz + dz * dx);
+	}
+};
+
+namespace
+{
+	struct Aabb
+	{
+		float bmin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+		float bmax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+		void grow(const float* mn, const float* mx)
+		{
+			for (int a = 0; a < 3; ++a)
+			{
+				bmin[a] = std::min(bmin[a], mn[a]);
+				bmax[a] = std::max(bmax[a], mx[a]);
+			}
+		}
+		void grow(const Aabb& o) { grow(o.bmin, o.bmax); }
+		float area() const
+		{
+			const float dx = bmax[0] - bmin[0], dy = bmax[1] - bmin[1], dz = bmax[2] - bmin[2];
+			return (dx < 0.0f) ? 0.0f : 2.0f * (dx * dy + dy * dz + dz * dx);
+		}
+	};
+
+	constexpr float kTriangleEps = 1e-6f;
+
+	// 순회 스택 : 필요한 크기가 지역 배열 안이면 그대로, 아니면 힙 버퍼
+	template <typename T, size_t N>
+	T* AcquireStack(T (&local)[N], std::vector<T>& heap, size_t required)
+	{
+		if (required <= N) return local;
+		heap.resize(required);
+		return heap.data();
+	}
+
+	// Moller-Trumbore (양면, PhysicsUtil::IntersectTriangle과 동일 판정)
+	inline bool IntersectTriangle(const float* o, const float* d, const float* v0, const float* e1, const float* e2, float& outT, float& outU, float& outV)
+	{
+		const float px = d[1] * e2[2] - d[2] * e2[1];
+		const float py = d[2] * e2[0] - d[0] * e2[2];
+		const float pz = d[0] * e2[1] - d[1] * e2[0];
+		const float det = e1[0] * px + e1[1] * py + e1[2] * pz;
+		if (std::fabs(det) < kTriangleEps) return false;
+
+		const float invDet = 1.0f / det;
+		const float tx = o[0] - v0[0], ty = o[1] - v0[1], tz = o[2] - v0[2];
+		const float u = (tx * px + ty * py + tz * pz) * invDet;
+		if (u < 0.0f || u > 1.0f) return false;
+
+		const float qx = ty * e1[2] - tz * e1[1];
+		const float qy = tz * e1[0] - tx * e1[2];
+		const float qz = tx * e1[1] - ty * e1[0];
+		const float v = (d[0] * qx + d[1] * qy + d[2] * qz) * invDet;
+		if (v < 0.0f || u + v > 1.0f) return false;
+
+		const float t = (e2[0] * qx + e2[1] * qy + e2[2] * qz) * invDet;
+		if (t <= kTriangleEps) return false;
+
+		outT = t;
+		outU = u;
+		outV = v;
+		return true;
+	}
+
+	constexpr float kInvFourPi = 0.0795774715f;	// 1 / (4 * pi)
+
+	// 점 - 선분 (a, a + e) 거리 제곱. w = p - a
+	inline float SegmentDistanceSq(const float* w, const float* e)
+	{
+		const float ee = e[0] * e[0] + e[1] * e[1] + e[2] * e[2];
+		const float t = std::clamp((w[0] * e[0] + w[1] * e[1] + w[2] * e[2]) / std::max(ee, 1e-30f), 0.0f, 1.0f);
+		const float dx = w[0] - t * e[0], dy = w[1] - t * e[1], dz = w[2] - t * e[2];
+		return dx * dx + dy * dy + dz * dz;
+	}
+
+	// 점 - 삼각형 거리 제곱 : 평면 투영이 삼각형 안이면 평면 거리, 아니면 세 변 중 가장 가까운 선분 거리
+	// (분기 없는 형태라 AVX2 경로와 같은 식을 쓴다)
+	inline float PointTriangleDistanceSq(const float* p, const float* v0, const float* e1, const float* e2)
+	{
+		const float a[3] = { p[0] - v0[0], p[1] - v0[1], p[2] - v0[2] };
+		const float b[3] = { a[0] - e1[0], a[1] - e1[1], a[2] - e1[2] };
+		const float e3[3] = { e2[0] - e1[0], e2[1] - e1[1], e2[2] - e1[2] };
+		const float edge = std::min({ SegmentDistanceSq(a, e1), SegmentDistanceSq(a, e2), SegmentDistanceSq(b, e3) });
+
+		const float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+		const float n2 = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+		if (n2 <= 1e-30f) return edge;
+
+		auto side = [&n](const float* u, const float* w) {
+			return (u[1] * w[2] - u[2] * w[1]) * n[0] + (u[2] * w[0] - u[0] * w[2]) * n[1] + (u[0] * w[1] - u[1] * w[0]) * n[2];
+		};
+		if (side(e1, a) < 0.0f || side(a, e2) < 0.0f || side(e3, b) < 0.0f) return edge;
+
+		const float an = a[0] * n[0] + a[1] * n[1] + a[2] * n[2];
+		return an * an / n2;
+	}
+
+	// 삼각형 (v0, v0 + e1, v0 + e2) 이 점 p 에서 이루는 입체각 (Van Oosterom-Strackee). 법선이 p 반대쪽을 향하면 양수
+	inline float SolidAngle(const float* p, const float* v0, const float* e1, const float* e2)
+	{
+		const float a[3] = { v0[0] - p[0], v0[1] - p[1], v0[2] - p[2] };
+		const float b[3] = { a[0] + e1[0], a[1] + e1[1], a[2] + e1[2] };
+		const float c[3] = { a[0] + e2[0], a[1] + e2[1], a[2] + e2[2] };
+		const float la = std::sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+		const float lb = std::sqrt(b[0] * b[0] + b[1] * b[1] + b[2] * b[2]);
+		const float lc = std::sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+		const float det = a[0] * (b[1] * c[2] - b[2] * c[1]) + a[1] * (b[2] * c[0] - b[0] * c[2]) + a[2] * (b[0] * c[1] - b[1] * c[0]);
+		const float den = la * lb * lc
+			+ (a[0] * b[0] + a[1] * b[1] + a[2] * b[2]) * lc
+			+ (a[0] * c[0] + a[1] * c[1] + a[2] * c[2]) * lb
+			+ (b[0] * c[0] + b[1] * c[1] + b[2] * c[2]) * la;
+		return 2.0f * std::atan2(det, den);
+	}
+
+	// 0 방향 성분은 아주 작은 값으로 대체 (inf * 0 = NaN 방지)
+	inline float SafeInverse(float v)
+	{
+		return 1.0f / (std::fabs(v) > 1e-20f ? v : std::copysign(1e-20f, v));
+	}
+
+#if defined(__AVX2__)
+	// 8레인 Moller-Trumbore : 레인별 (레이, 삼각형) 쌍을 검사해 교차 & t < tMax 인 레인 마스크 반환
+	inline __m256 IntersectTriangle8(
+		const __m256 ox, const __m256 oy, const __m256 oz, const __m256 dx, const __m256 dy, const __m256 dz,
+		const __m256 v0x, const __m256 v0y, const __m256 v0z,
+		const __m256 e1x, const __m256 e1y, const __m256 e1z,
+		const __m256 e2x, const __m256 e2y, const __m256 e2z,
+		const __m256 tMax, __m256& outT)
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 eps = _mm256_set1_ps(kTriangleEps);
+
+		const __m256 px = _mm256_sub_ps(_mm256_mul_ps(dy, e2z), _mm256_mul_ps(dz, e2y));
+		const __m256 py = _mm256_sub_ps(_mm256_mul_ps(dz, e2x), _mm256_mul_ps(dx, e2z));
+		const __m256 pz = _mm256_sub_ps(_mm256_mul_ps(dx, e2y), _mm256_mul_ps(dy, e2x));
+		const __m256 det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e1x, px), _mm256_mul_ps(e1y, py)), _mm256_mul_ps(e1z, pz));
+		const __m256 absDet = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), det);
+		const __m256 invDet = _mm256_div_ps(one, det);
+
+		const __m256 tx = _mm256_sub_ps(ox, v0x);
+		const __m256 ty = _mm256_sub_ps(oy, v0y);
+		const __m256 tz = _mm256_sub_ps(oz, v0z);
+		const __m256 u = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(tx, px), _mm256_mul_ps(ty, py)), _mm256_mul_ps(tz, pz)), invDet);
+
+		const __m256 qx = _mm256_sub_ps(_mm256_mul_ps(ty, e1z), _mm256_mul_ps(tz, e1y));
+		const __m256 qy = _mm256_sub_ps(_mm256_mul_ps(tz, e1x), _mm256_mul_ps(tx, e1z));
+		const __m256 qz = _mm256_sub_ps(_mm256_mul_ps(tx, e1y), _mm256_mul_ps(ty, e1x));
+		const __m256 v = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, qx), _mm256_mul_ps(dy, qy)), _mm256_mul_ps(dz, qz)), invDet);
+		const __m256 t = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2x, qx), _mm256_mul_ps(e2y, qy)), _mm256_mul_ps(e2z, qz)), invDet);
+
+		__m256 mask = _mm256_cmp_ps(absDet, eps, _CMP_GE_OQ);
+		mask = _mm256_and_ps(mask, _mm256_cmp_ps(u, zero, _CMP_GE_OQ));
+		mask = _mm256_and_ps(mask, _mm256_cmp_ps(u, one, _CMP_LE_OQ));
+		mask = _mm256_and_ps(mask, _mm256_cmp_ps(v, zero, _CMP_GE_OQ));
+		mask = _mm256_and_ps(mask, _mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_LE_OQ));
+		mask = _mm256_and_ps(mask, _mm256_cmp_ps(t, eps, _CMP_GT_OQ));
+		mask = _mm256_and_ps(mask, _mm256_cmp_ps(t, tMax, _CMP_LT_OQ));
+		outT = t;
+		return mask;
+	}
+
+	inline __m256 Dot8(const __m256 ax, const __m256 ay, const __m256 az, const __m256 bx, const __m256 by, const __m256 bz)
+	{
+		return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_mul_ps(az, bz));
+	}
+
+	inline __m256 SegmentDistanceSq8(const __m256 wx, const __m256 wy, const __m256 wz, const __m256 ex, const __m256 ey, const __m256 ez)
+	{
+		const __m256 ee = _mm256_max_ps(Dot8(ex, ey, ez, ex, ey, ez), _mm256_set1_ps(1e-30f));
+		__m256 t = _mm256_div_ps(Dot8(wx, wy, wz, ex, ey, ez), ee);
+		t = _mm256_min_ps(_mm256_max_ps(t, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+		const __m256 dx = _mm256_sub_ps(wx, _mm256_mul_ps(t, ex));
+		const __m256 dy = _mm256_sub_ps(wy, _mm256_mul_ps(t, ey));
+		const __m256 dz = _mm256_sub_ps(wz, _mm256_mul_ps(t, ez));
+		return Dot8(dx, dy, dz, dx, dy, dz);
+	}
+
+	// 8레인 점-삼각형 거리 제곱 (PointTriangleDistanceSq 와 같은 식, 점 하나 x 삼각형 8개)
+	inline __m256 PointTriangleDistanceSq8(const __m256 px, const __m256 py, const __m256 pz,
+		const __m256 v0x, const __m256 v0y, const __m256 v0z,
+		const __m256 e1x, const __m256 e1y, const __m256 e1z,
+		const __m256 e2x, const __m256 e2y, const __m256 e2z)
+	{
+		const __m256 ax = _mm256_sub_ps(px, v0x), ay = _mm256_sub_ps(py, v0y), az = _mm256_sub_ps(pz, v0z);
+		const __m256 bx = _mm256_sub_ps(ax, e1x), by = _mm256_sub_ps(ay, e1y), bz = _mm256_sub_ps(az, e1z);
+		const __m256 e3x = _mm256_sub_ps(e2x, e1x), e3y = _mm256_sub_ps(e2y, e1y), e3z = _mm256_sub_ps(e2z, e1z);
+		const __m256 edge = _mm256_min_ps(_mm256_min_ps(
+			SegmentDistanceSq8(ax, ay, az, e1x, e1y, e1z),
+			SegmentDistanceSq8(ax, ay, az, e2x, e2y, e2z)),
+			SegmentDistanceSq8(bx, by, bz, e3x, e3y, e3z));
+
+		const __m256 nx = _mm256_sub_ps(_mm256_mul_ps(e1y, e2z), _mm256_mul_ps(e1z, e2y));
+		const __m256 ny = _mm256_sub_ps(_mm256_mul_ps(e1z, e2x), _mm256_mul_ps(e1x, e2z));
+		const __m256 nz = _mm256_sub_ps(_mm256_mul_ps(e1x, e2y), _mm256_mul_ps(e1y, e2x));
+		const __m256 n2 = Dot8(nx, ny, nz, nx, ny, nz);
+
+		auto side = [&](const __m256 ux, const __m256 uy, const __m256 uz, const __m256 wx, const __m256 wy, const __m256 wz) {
+			const __m256 cx = _mm256_sub_ps(_mm256_mul_ps(uy, wz), _mm256_mul_ps(uz, wy));
+			const __m256 cy = _mm256_sub_ps(_mm256_mul_ps(uz, wx), _mm256_mul_ps(ux, wz));
+			const __m256 cz = _mm256_sub_ps(_mm256_mul_ps(ux, wy), _mm256_mul_ps(uy, wx));
+			return _mm256_cmp_ps(Dot8(cx, cy, cz, nx, ny, nz), _mm256_setzero_ps(), _CMP_GE_OQ);
+		};
+		__m256 inside = _mm256_cmp_ps(n2, _mm256_set1_ps(1e-30f), _CMP_GT_OQ);
+		inside = _mm256_and_ps(inside, side(e1x, e1y, e1z, ax, ay, az));
+		inside = _mm256_and_ps(inside, side(ax, ay, az, e2x, e2y, e2z));
+		inside = _mm256_and_ps(inside, side(e3x, e3y, e3z, bx, by, bz));
+
+		const __m256 an = Dot8(ax, ay, az, nx, ny, nz);
+		const __m256 plane = _mm256_div_ps(_mm256_mul_ps(an, an), _mm256_max_ps(n2, _mm256_set1_ps(1e-30f)));
+		return _mm256_blendv_ps(edge, plane, inside);
+	}
+#endif
+}
+
+void TriangleBVH::Clear()
+{
+	m_nodes.clear();
+	m_blocks.clear();
+	m_winding.clear();
+	m_triangleCount = 0;
+	m_maxDepth = 0;
+	m_bounds = {};
+}
+
+void TriangleBVH::Build(const GeometryData& meshData)
+{
+	if (meshData.vertices.empty())
+	{
+		Clear();
+		return;
+	}
+	Build(&meshData.vertices[0].pos, sizeof(Vertex), meshData.indices.data(), meshData.indices.size());
+}
+
+void TriangleBVH::Build(const DirectX::XMFLOAT3* positions, size_t positionStride, const uint32_t* indices, size_t indexCount)
+{
+	Clear();
+	const size_t triCount = indexCount / 3;
+	if (!positions || !indices || triCount == 0) return;
+
+	auto position = [&](uint32_t i) -> const DirectX::XMFLOAT3& {
+		return *reinterpret_cast<const DirectX::XMFLOAT3*>(reinterpret_cast<const uint8_t*>(positions) + positionStride * i);
+	};
+
+	std::vector<BuildRef> refs;
+	refs.reserve(triCount);
+	Range root{ .begin = 0, .end = 0 };
+	for (size_t t = 0; t < triCount; ++t)
+	{
+		// 인덱스가 겹치는 degenerate 삼각형 (브릭 배치 청크의 빈 인덱스 칸) 은 제외
+		const uint32_t i0 = indices[3 * t + 0], i1 = indices[3 * t + 1], i2 = indices[3 * t + 2];
+		if (i0 == i1 || i1 == i2 || i0 == i2) continue;
+
+		const DirectX::XMFLOAT3& a = position(i0);
+		const DirectX::XMFLOAT3& b = position(i1);
+		const DirectX::XMFLOAT3& c = position(i2);
+
+		BuildRef ref{};
+		ref.v0 = a;
+		ref.e1 = { b.x - a.x, b.y - a.y, b.z - a.z };
+		ref.e2 = { c.x - a.x, c.y - a.y, c.z - a.z };
+		ref.id = static_cast<uint32_t>(t);
+		const float pa[3] = { a.x, a.y, a.z }, pb[3] = { b.x, b.y, b.z }, pc[3] = { c.x, c.y, c.z };
+		for (int k = 0; k < 3; ++k)
+		{
+			ref.bmin[k] = std::min({ pa[k], pb[k], pc[k] });
+			ref.bmax[k] = std::max({ pa[k], pb[k], pc[k] });
+			ref.centroid[k] = 0.5f * (ref.bmin[k] + ref.bmax[k]);
+			root.bmin[k] = std::min(root.bmin[k], ref.bmin[k]);
+			root.bmax[k] = std::max(root.bmax[k], ref.bmax[k]);
+		}
+		refs.push_back(ref);
+	}
+	root.end = static_cast<uint32_t>(refs.size());
+	if (refs.empty()) return;
+
+	// leaf 블록 수 ~ 삼각형 수 / 4 (블록 평균 점유율 절반 가정), 노드는 그 1/3 정도
+	m_blocks.reserve(triCount / 4 + 1);
+	m_nodes.reserve(triCount / 12 + 1);
+	m_winding.reserve(triCount / 12 + 1);
+	m_triangleCount = refs.size();
+	buildNode(refs, root, 1);
+
+	const DirectX::XMFLOAT3 mn = { root.bmin[0], root.bmin[1], root.bmin[2] };
+	const DirectX::XMFLOAT3 mx = { root.bmax[0], root.bmax[1], root.bmax[2] };
+	m_bounds.Center = { 0.5f * (mn.x + mx.x), 0.5f * (mn.y + mx.y), 0.5f * (mn.z + mx.z) };
+	m_bounds.Extents = { 0.5f * (mx.x - mn.x), 0.5f * (mx.y - mn.y), 0.5f * (mx.z - mn.z) };
+}
+
+bool TriangleBVH::splitRange(std::vector<BuildRef>& refs, const Range& range, bool medianSplit, Range& outLeft, Range& outRight) const
+{
+	if (range.count() < 2) return false;
+
+	Aabb centroidBounds;
+	for (uint32_t i = range.begin; i < range.end; ++i) centroidBounds.grow(refs[i].centroid, refs[i].centroid);
+
+	float bestCost = FLT_MAX;
+	int bestAxis = -1;
+	uint32_t bestSplit = 0;
+
+	uint32_t mid = 0;
+	if (medianSplit)
+	{
+		// 중심점 범위가 가장 긴 축의 개수 중앙값 : 항상 절반씩 나뉜다
+		int axis = 0;
+		for (int a = 1; a < 3; ++a)
+		{
+			if (centroidBounds.bmax[a] - centroidBounds.bmin[a] > centroidBounds.bmax[axis] - centroidBounds.bmin[axis]) axis = a;
+		}
+		mid = range.begin + range.count() / 2;
+		std::nth_element(refs.begin() + range.begin, refs.begin() + mid, refs.begin() + range.end, [axis](const BuildRef& a, const BuildRef& b) {
+			return a.centroid[axis] < b.centroid[axis];
+		});
+	}
+
+	for (int axis = 0; axis < 3 && !medianSplit; ++axis)
+	{
+		const float lo = centroidBounds.bmin[axis];
+		const float extent = centroidBounds.bmax[axis] - lo;
+		if (extent <= 1e-12f) continue;
+		const float scale = kBinCount / extent;
+
+		Aabb bins[kBinCount];
+		uint32_t counts[kBinCount] = {};
+		for (uint32_t i = range.begin; i < range.end; ++i)
+		{
+			const uint32_t b = std::min(static_cast<uint32_t>((refs[i].centroid[axis] - lo) * scale), kBinCount - 1);
+			bins[b].grow(refs[i].bmin, refs[i].bmax);
+			++counts[b];
+		}
+
+		// 오른쪽 누적 -> 왼쪽 누적하며 SAH = A_L * N_L + A_R * N_R
+		float rightArea[kBinCount];
+		uint32_t rightCount[kBinCount];
+		Aabb acc;
+		uint32_t n = 0;
+		for (int b = kBinCount - 1; b > 0; --b)
+		{
+			acc.grow(bins[b]);
+			n += counts[b];
+			rightArea[b] = acc.area();
+			rightCount[b] = n;
+		}
+
+		acc = {};
+		n = 0;
+		for (uint32_t b = 0; b + 1 < kBinCount; ++b)
+		{
+			acc.grow(bins[b]);
+			n += counts[b];
+			if (n == 0 || rightCount[b + 1] == 0) continue;
+			const float cost = acc.area() * n + rightArea[b + 1] * rightCount[b + 1];
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestAxis = axis;
+				bestSplit = b + 1;
+			}
+		}
+	}
+
+	if (bestAxis >= 0)
+	{
+		const float lo = centroidBounds.bmin[bestAxis];
+		const float scale = kBinCount / (centroidBounds.bmax[bestAxis] - lo);
+		auto it = std::partition(refs.begin() + range.begin, refs.begin() + range.end, [&](const BuildRef& r) {
+			return std::min(static_cast<uint32_t>((r.centroid[bestAxis] - lo) * scale), kBinCount - 1) < bestSplit;
+		});
+		mid = static_cast<uint32_t>(it - refs.begin());
+	}
+	if (mid <= range.begin || mid >= range.end)
+	{
+		// 중심점이 모두 겹침 : 개수 기준 반분할
+		mid = range.begin + range.count() / 2;
+	}
+
+	auto makeRange = [&](uint32_t b, uint32_t e) {
+		Range r{ .begin = b, .end = e };
+		for (uint32_t i = b; i < e; ++i)
+		{
+			for (int k = 0; k < 3; ++k)
+			{
+				r.bmin[k] = std::min(r.bmin[k], refs[i].bmin[k]);
+				r.bmax[k] = std::max(r.bmax[k], refs[i].bmax[k]);
+			}
+		}
+		return r;
+	};
+	outLeft = makeRange(range.begin, mid);
+	outRight = makeRange(mid, range.end);
+	return true;
+}
+
+uint32_t TriangleBVH::buildNode(std::vector<BuildRef>& refs, const Range& range, uint32_t depth)
+{
+	m_maxDepth = std::max(m_maxDepth, depth);
+	const bool medianSplit = depth > kMaxSahDepth;
+	const uint32_t nodeIndex = static_cast<uint32_t>(m_nodes.size());
+	m_nodes.emplace_back();
+	m_winding.emplace_back();
+
+	// 이분할을 반복해 최대 4자식으로 펼침 (표면적이 가장 큰 자식부터)
+	Range children[4];
+	uint32_t childCount = 1;
+	children[0] = range;
+	while (childCount < 4)
+	{
+		int widest = -1;
+		float widestArea = -1.0f;
+		for (uint32_t i = 0; i < childCount; ++i)
+		{
+			if (children[i].count() > kLeafSize && children[i].area() > widestArea)
+			{
+				widest = static_cast<int>(i);
+				widestArea = children[i].area();
+			}
+		}
+		if (widest < 0) break;
+
+		Range left, right;
+		if (!splitRange(refs, children[widest], medianSplit, left, right)) break;
+		children[widest] = left;
+		children[childCount++] = right;
+	}
+
+	uint32_t childIndex[4] = { kEmptyChild, kEmptyChild, kEmptyChild, kEmptyChild };
+	uint32_t leafCount[4] = {};
+	for (uint32_t i = 0; i < childCount; ++i)
+	{
+		if (children[i].count() <= kLeafSize)
+		{
+			childIndex[i] = static_cast<uint32_t>(m_blocks.size());
+			leafCount[i] = children[i].count();
+
+			TriangleBlock& block = m_blocks.emplace_back();
+			std::memset(&block, 0, sizeof(block));
+			for (uint32_t k = 0; k < leafCount[i]; ++k)
+			{
+				const BuildRef& ref = refs[children[i].begin + k];
+				block.v0x[k] = ref.v0.x; block.v0y[k] = ref.v0.y; block.v0z[k] = ref.v0.z;
+				block.e1x[k] = ref.e1.x; block.e1y[k] = ref.e1.y; block.e1z[k] = ref.e1.z;
+				block.e2x[k] = ref.e2.x; block.e2y[k] = ref.e2.y; block.e2z[k] = ref.e2.z;
+				block.id[k] = ref.id;
+			}
+		}
+		else
+		{
+			childIndex[i] = buildNode(refs, children[i], depth + 1);
+		}
+	}
+
+	// 재귀 중 m_nodes 재할당 가능 : 인덱스로 다시 접근
+	Node& node = m_nodes[nodeIndex];
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		const bool used = i < childCount;
+		node.minX[i] = used ? children[i].bmin[0] : FLT_MAX;
+		node.minY[i] = used ? children[i].bmin[1] : FLT_MAX;
+		node.minZ[i] = used ? children[i].bmin[2] : FLT_MAX;
+		node.maxX[i] = used ? children[i].bmax[0] : -FLT_MAX;
+		node.maxY[i] = used ? children[i].bmax[1] : -FLT_MAX;
+		node.maxZ[i] = used ? children[i].bmax[2] : -FLT_MAX;
+		node.child[i] = childIndex[i];
+		node.count[i] = leafCount[i];
+	}
+
+	// winding 근사용 슬롯 요약 : leaf는 삼각형에서, 내부 노드는 이미 채워진 자식 노드의 4슬롯에서 합친다
+	WindingNode& wn = m_winding[nodeIndex];
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		float n[3] = {}, c[3] = {}, area = 0.0f, radius = 0.0f;
+		if (i < childCount && leafCount[i] > 0)
+		{
+			for (uint32_t k = children[i].begin; k < children[i].end; ++k)
+			{
+				const BuildRef& ref = refs[k];
+				const float an[3] = {
+					0.5f * (ref.e1.y * ref.e2.z - ref.e1.z * ref.e2.y),
+					0.5f * (ref.e1.z * ref.e2.x - ref.e1.x * ref.e2.z),
+					0.5f * (ref.e1.x * ref.e2.y - ref.e1.y * ref.e2.x)
+				};
+				const float a = std::sqrt(an[0] * an[0] + an[1] * an[1] + an[2] * an[2]) + 1e-30f;
+				const float centroid[3] = { ref.v0.x + (ref.e1.x + ref.e2.x) / 3.0f, ref.v0.y + (ref.e1.y + ref.e2.y) / 3.0f, ref.v0.z + (ref.e1.z + ref.e2.z) / 3.0f };
+				for (int d = 0; d < 3; ++d)
+				{
+					n[d] += an[d];
+					c[d] += a * centroid[d];
+				}
+				area += a;
+			}
+			for (int d = 0; d < 3; ++d) c[d] /= area;
+			for (uint32_t k = children[i].begin; k < children[i].end; ++k)
+			{
+				const BuildRef& ref = refs[k];
+				const float a[3] = { ref.v0.x - c[0], ref.v0.y - c[1], ref.v0.z - c[2] };
+				const float b[3] = { a[0] + ref.e1.x, a[1] + ref.e1.y, a[2] + ref.e1.z };
+				const float d[3] = { a[0] + ref.e2.x, a[1] + ref.e2.y, a[2] + ref.e2.z };
+				radius = std::max({ radius,
+					a[0] * a[0] + a[1] * a[1] + a[2] * a[2],
+					b[0] * b[0] + b[1] * b[1] + b[2] * b[2],
+					d[0] * d[0] + d[1] * d[1] + d[2] * d[2] });
+			}
+			radius = std::sqrt(radius);
+		}
+		else if (i < childCount)
+		{
+			const WindingNode& sub = m_winding[childIndex[i]];
+			const Node& subNode = m_nodes[childIndex[i]];
+			for (uint32_t k = 0; k < 4; ++k)
+			{
+				if (subNode.child[k] == kEmptyChild) continue;
+				n[0] += sub.nx[k]; n[1] += sub.ny[k]; n[2] += sub.nz[k];
+				c[0] += sub.area[k] * sub.cx[k]; c[1] += sub.area[k] * sub.cy[k]; c[2] += sub.area[k] * sub.cz[k];
+				area += sub.area[k];
+			}
+			for (int d = 0; d < 3; ++d) c[d] /= area;
+			for (uint32_t k = 0; k < 4; ++k)
+			{
+				if (subNode.child[k] == kEmptyChild) continue;
+				const float dx = sub.cx[k] - c[0], dy = sub.cy[k] - c[1], dz = sub.cz[k] - c[2];
+				radius = std::max(radius, std::sqrt(dx * dx + dy * dy + dz * dz) + sub.radius[k]);
+			}
+		}
+		wn.nx[i] = n[0]; wn.ny[i] = n[1]; wn.nz[i] = n[2];
+		wn.cx[i] = c[0]; wn.cy[i] = c[1]; wn.cz[i] = c[2];
+		wn.radius[i] = radius;
+		wn.area[i] = area;
+	}
+	return nodeIndex;
+}
+
+
+bool TriangleBVH::Raycast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dir, float maxDistance, Hit& outHit) const
+{
+	if (m_nodes.empty()) return false;
+
+	const float o[3] = { origin.x, origin.y, origin.z };
+	const float d[3] = { dir.x, dir.y, dir.z };
+
+	const __m128 ox = _mm_set1_ps(o[0]), oy = _mm_set1_ps(o[1]), oz = _mm_set1_ps(o[2]);
+	const __m128 ix = _mm_set1_ps(SafeInverse(d[0])), iy = _mm_set1_ps(SafeInverse(d[1])), iz = _mm_set1_ps(SafeInverse(d[2]));
+	const __m128 zero = _mm_setzero_ps();
+
+	struct StackEntry
+	{
+		uint32_t child;
+		uint32_t count;
+		float tNear;
+	};
+	StackEntry localStack[kLocalStackSize];
+	std::vector<StackEntry> heapStack;
+	StackEntry* stack = AcquireStack(localStack, heapStack, traversalStackSize());
+	int sp = 0;
+	stack[sp++] = { 0, 0, 0.0f };
+
+	float closest = maxDistance;
+	Hit best{};
+	bool found = false;
+
+	while (sp > 0)
+	{
+		const StackEntry entry = stack[--sp];
+		if (entry.tNear >= closest) continue;
+
+		if (entry.count > 0)
+		{
+			// leaf : 레이 1개 x 삼각형 블록(최대 8개)
+			const TriangleBlock& block = m_blocks[entry.child];
+#if defined(__AVX2__)
+			__m256 t;
+			const __m256 mask = IntersectTriangle8(
+				_mm256_set1_ps(o[0]), _mm256_set1_ps(o[1]), _mm256_set1_ps(o[2]),
+				_mm256_set1_ps(d[0]), _mm256_set1_ps(d[1]), _mm256_set1_ps(d[2]),
+				_mm256_load_ps(block.v0x), _mm256_load_ps(block.v0y), _mm256_load_ps(block.v0z),
+				_mm256_load_ps(block.e1x), _mm256_load_ps(block.e1y), _mm256_load_ps(block.e1z),
+				_mm256_load_ps(block.e2x), _mm256_load_ps(block.e2y), _mm256_load_ps(block.e2z),
+				_mm256_set1_ps(closest), t);
+			int bits = _mm256_movemask_ps(mask);
+			if (bits)
+			{
+				alignas(32) float tArr[kLeafSize];
+				_mm256_store_ps(tArr, t);
+				int bestLane = -1;
+				for (; bits; bits &= bits - 1)
+				{
+					const int lane = std::countr_zero(static_cast<uint32_t>(bits));
+					if (tArr[lane] < closest)
+					{
+						closest = tArr[lane];
+						bestLane = lane;
+					}
+				}
+				if (bestLane >= 0)
+				{
+					// 무게중심 좌표는 최근접 삼각형만 스칼라로 다시 계산
+					const int k = bestLane;
+					const float v0[3] = { block.v0x[k], block.v0y[k], block.v0z[k] };
+					const float e1[3] = { block.e1x[k], block.e1y[k], block.e1z[k] };
+					const float e2[3] = { block.e2x[k], block.e2y[k], block.e2z[k] };
+					float tt, u = 0.0f, v = 0.0f;
+					IntersectTriangle(o, d, v0, e1, e2, tt, u, v);
+					best = { closest, block.id[k], u, v };
+					found = true;
+				}
+			}
+#else
+			for (uint32_t k = 0; k < entry.count; ++k)
+			{
+				const float v0[3] = { block.v0x[k], block.v0y[k], block.v0z[k] };
+				const float e1[3] = { block.e1x[k], block.e1y[k], block.e1z[k] };
+				const float e2[3] = { block.e2x[k], block.e2y[k], block.e2z[k] };
+				float t, u, v;
+				if (IntersectTriangle(o, d, v0, e1, e2, t, u, v) && t < closest)
+				{
+					closest = t;
+					best = { t, block.id[k], u, v };
+					found = true;
+				}
+			}
+#endif
+			continue;
+		}
+
+		// 4개 자식 AABB slab 검사
+		const Node& node = m_nodes[entry.child];
+		const __m128 tx0 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.minX), ox), ix);
+		const __m128 tx1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.maxX), ox), ix);
+		const __m128 ty0 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.minY), oy), iy);
+		const __m128 ty1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.maxY), oy), iy);
+		const __m128 tz0 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.minZ), oz), iz);
+		const __m128 tz1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.maxZ), oz), iz);
+
+		__m128 tNear = _mm_max_ps(_mm_max_ps(_mm_min_ps(tx0, tx1), _mm_min_ps(ty0, ty1)), _mm_max_ps(_mm_min_ps(tz0, tz1), zero));
+		__m128 tFar = _mm_min_ps(_mm_min_ps(_mm_max_ps(tx0, tx1), _mm_max_ps(ty0, ty1)), _mm_min_ps(_mm_max_ps(tz0, tz1), _mm_set1_ps(closest)));
+		const int mask = _mm_movemask_ps(_mm_cmple_ps(tNear, tFar));
+		if (!mask) continue;
+
+		alignas(16) float nearArr[4];
+		_mm_store_ps(nearArr, tNear);
+
+		// 가까운 자식이 먼저 pop 되도록 먼 순서로 push
+		uint32_t order[4];
+		uint32_t hitCount = 0;
+		for (uint32_t i = 0; i < 4; ++i)
+		{
+			if (!(mask & (1 << i)) || node.child[i] == kEmptyChild) continue;
+			uint32_t k = hitCount++;
+			while (k > 0 && nearArr[order[k - 1]] < nearArr[i])
+			{
+				order[k] = order[k - 1];
+				--k;
+			}
+			order[k] = i;
+		}
+		for (uint32_t k = 0; k < hitCount; ++k)
+		{
+			const uint32_t i = order[k];
+			stack[sp++] = { node.child[i], node.count[i], nearArr[i] };
+		}
+	}
+
+	if (!found) return false;
+	outHit = best;
+	return true;
+}
+
+void TriangleBVH::RaycastPacket(RayPacket& packet) const
+{
+	if (m_nodes.empty()) return;
+
+#if defined(__AVX2__)
+	constexpr uint32_t W = RayPacket::kWidth;
+	alignas(32) float inv[3][W];
+	for (uint32_t l = 0; l < W; ++l)
+	{
+		inv[0][l] = SafeInverse(packet.dx[l]);
+		inv[1][l] = SafeInverse(packet.dy[l]);
+		inv[2][l] = SafeInverse(packet.dz[l]);
+	}
+
+	const __m256 ox = _mm256_load_ps(packet.ox), oy = _mm256_load_ps(packet.oy), oz = _mm256_load_ps(packet.oz);
+	const __m256 dx = _mm256_load_ps(packet.dx), dy = _mm256_load_ps(packet.dy), dz = _mm256_load_ps(packet.dz);
+	const __m256 ix = _mm256_load_ps(inv[0]), iy = _mm256_load_ps(inv[1]), iz = _mm256_load_ps(inv[2]);
+	const __m256 zero = _mm256_setzero_ps();
+	__m256 tMax = _mm256_load_ps(packet.tMax);
+	__m256i triangle = _mm256_load_si256(reinterpret_cast<const __m256i*>(packet.triangle));
+
+	// 패킷 전체에서 가장 먼 tMax (엔트리의 최소 진입 거리가 이보다 멀면 어떤 레인도 갱신 불가)
+	auto maxLane = [](__m256 v) {
+		__m128 m = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+		m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+		m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+		return _mm_cvtss_f32(m);
+	};
+
+	struct StackEntry
+	{
+		uint32_t child;
+		uint32_t count;
+		float tNear;	// 활성 레인 중 최소 진입 거리
+	};
+	StackEntry localStack[kLocalStackSize];
+	std::vector<StackEntry> heapStack;
+	StackEntry* stack = AcquireStack(localStack, heapStack, traversalStackSize());
+	int sp = 0;
+	stack[sp++] = { 0, 0, 0.0f };
+
+	while (sp > 0)
+	{
+		const StackEntry entry = stack[--sp];
+		if (entry.tNear >= maxLane(tMax)) continue;
+
+		if (entry.count > 0)
+		{
+			// leaf : 삼각형 하나씩 브로드캐스트해 레이 8개와 검사
+			const TriangleBlock& block = m_blocks[entry.child];
+			for (uint32_t k = 0; k < entry.count; ++k)
+			{
+				__m256 t;
+				const __m256 mask = IntersectTriangle8(ox, oy, oz, dx, dy, dz,
+					_mm256_set1_ps(block.v0x[k]), _mm256_set1_ps(block.v0y[k]), _mm256_set1_ps(block.v0z[k]),
+					_mm256_set1_ps(block.e1x[k]), _mm256_set1_ps(block.e1y[k]), _mm256_set1_ps(block.e1z[k]),
+					_mm256_set1_ps(block.e2x[k]), _mm256_set1_ps(block.e2y[k]), _mm256_set1_ps(block.e2z[k]),
+					tMax, t);
+				tMax = _mm256_blendv_ps(tMax, t, mask);
+				triangle = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(triangle), _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(block.id[k]))), mask));
+			}
+			continue;
+		}
+
+		// 자식 박스 4개 각각을 레이 8개와 검사
+		const Node& node = m_nodes[entry.child];
+		uint32_t order[4];
+		float orderNear[4];
+		uint32_t hitCount = 0;
+		for (uint32_t i = 0; i < 4; ++i)
+		{
+			if (node.child[i] == kEmptyChild) continue;
+
+			const __m256 tx0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.minX[i]), ox), ix);
+			const __m256 tx1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.maxX[i]), ox), ix);
+			const __m256 ty0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.minY[i]), oy), iy);
+			const __m256 ty1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.maxY[i]), oy), iy);
+			const __m256 tz0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.minZ[i]), oz), iz);
+			const __m256 tz1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.maxZ[i]), oz), iz);
+
+			const __m256 tNear = _mm256_max_ps(_mm256_max_ps(_mm256_min_ps(tx0, tx1), _mm256_min_ps(ty0, ty1)), _mm256_max_ps(_mm256_min_ps(tz0, tz1), zero));
+			const __m256 tFar = _mm256_min_ps(_mm256_min_ps(_mm256_max_ps(tx0, tx1), _mm256_max_ps(ty0, ty1)), _mm256_min_ps(_mm256_max_ps(tz0, tz1), tMax));
+			int bits = _mm256_movemask_ps(_mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ));
+			if (!bits) continue;
+
+			alignas(32) float nearArr[W];
+			_mm256_store_ps(nearArr, tNear);
+			float minNear = FLT_MAX;
+			for (; bits; bits &= bits - 1) minNear = std::min(minNear, nearArr[std::countr_zero(static_cast<uint32_t>(bits))]);
+
+			uint32_t k = hitCount++;
+			while (k > 0 && orderNear[k - 1] < minNear)
+			{
+				order[k] = order[k - 1];
+				orderNear[k] = orderNear[k - 1];
+				--k;
+			}
+			order[k] = i;
+			orderNear[k] = minNear;
+		}
+		for (uint32_t k = 0; k < hitCount; ++k)
+		{
+			const uint32_t i = order[k];
+			stack[sp++] = { node.child[i], node.count[i], orderNear[k] };
+		}
+	}
+
+	_mm256_store_ps(packet.tMax, tMax);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(packet.triangle), triangle);
+#else
+	// AVX2 미지원 : 레인별 단일 레이 순회
+	for (uint32_t l = 0; l < RayPacket::kWidth; ++l)
+	{
+		if (packet.tMax[l] < 0.0f) continue;
+		Hit hit;
+		if (Raycast({ packet.ox[l], packet.oy[l], packet.oz[l] }, { packet.dx[l], packet.dy[l], packet.dz[l] }, packet.tMax[l], hit))
+		{
+			packet.tMax[l] = hit.distance;
+			packet.triangle[l] = hit.triangle;
+		}
+	}
+#endif
+}
+
+bool TriangleBVH::ClosestPoint(const DirectX::XMFLOAT3& point, float maxDistance, ClosestHit& outHit) const
+{
+	if (m_nodes.empty() || !(maxDistance > 0.0f)) return false;
+
+	const float p[3] = { point.x, point.y, point.z };
+	const __m128 px = _mm_set1_ps(p[0]), py = _mm_set1_ps(p[1]), pz = _mm_set1_ps(p[2]);
+	const __m128 zero = _mm_setzero_ps();
+
+	struct StackEntry
+	{
+		uint32_t child;
+		uint32_t count;
+		float distSq;
+	};
+	StackEntry localStack[kLocalStackSize];
+	std::vector<StackEntry> heapStack;
+	StackEntry* stack = AcquireStack(localStack, heapStack, traversalStackSize());
+	int sp = 0;
+	stack[sp++] = { 0, 0, 0.0f };
+
+	// 거리 제곱으로 비교 (maxDistance = FLT_MAX 도 허용)
+	float closestSq = (maxDistance < 1e18f) ? maxDistance * maxDistance : FLT_MAX;
+	ClosestHit best{};
+	bool found = false;
+
+#if defined(__AVX2__)
+	const __m256 p8x = _mm256_set1_ps(p[0]), p8y = _mm256_set1_ps(p[1]), p8z = _mm256_set1_ps(p[2]);
+	const __m256i laneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+#endif
+
+	while (sp > 0)
+	{
+		const StackEntry entry = stack[--sp];
+		if (entry.distSq >= closestSq) continue;
+
+		if (entry.count > 0)
+		{
+			const TriangleBlock& block = m_blocks[entry.child];
+#if defined(__AVX2__)
+			const __m256 d2 = PointTriangleDistanceSq8(p8x, p8y, p8z,
+				_mm256_load_ps(block.v0x), _mm256_load_ps(block.v0y), _mm256_load_ps(block.v0z),
+				_mm256_load_ps(block.e1x), _mm256_load_ps(block.e1y), _mm256_load_ps(block.e1z),
+				_mm256_load_ps(block.e2x), _mm256_load_ps(block.e2y), _mm256_load_ps(block.e2z));
+			// 빈 레인 (k >= count) 은 원점 삼각형이라 제외
+			const __m256 used = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(entry.count)), laneIndex));
+			int bits = _mm256_movemask_ps(_mm256_and_ps(used, _mm256_cmp_ps(d2, _mm256_set1_ps(closestSq), _CMP_LT_OQ)));
+			if (bits)
+			{
+				alignas(32) float d2Arr[kLeafSize];
+				_mm256_store_ps(d2Arr, d2);
+				for (; bits; bits &= bits - 1)
+				{
+					const int lane = std::countr_zero(static_cast<uint32_t>(bits));
+					if (d2Arr[lane] < closestSq)
+					{
+						closestSq = d2Arr[lane];
+						best.triangle = block.id[lane];
+						found = true;
+					}
+				}
+			}
+#else
+			for (uint32_t k = 0; k < entry.count; ++k)
+			{
+				const float v0[3] = { block.v0x[k], block.v0y[k], block.v0z[k] };
+				const float e1[3] = { block.e1x[k], block.e1y[k], block.e1z[k] };
+				const float e2[3] = { block.e2x[k], block.e2y[k], block.e2z[k] };
+				const float d2 = PointTriangleDistanceSq(p, v0, e1, e2);
+				if (d2 < closestSq)
+				{
+					closestSq = d2;
+					best.triangle = block.id[k];
+					found = true;
+				}
+			}
+#endif
+			continue;
+		}
+
+		// 점-박스 거리 제곱 4개
+		const Node& node = m_nodes[entry.child];
+		const __m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_load_ps(node.minX), px), _mm_sub_ps(px, _mm_load_ps(node.maxX))), zero);
+		const __m128 dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_load_ps(node.minY), py), _mm_sub_ps(py, _mm_load_ps(node.maxY))), zero);
+		const __m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_load_ps(node.minZ), pz), _mm_sub_ps(pz, _mm_load_ps(node.maxZ))), zero);
+		const __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+		const int mask = _mm_movemask_ps(_mm_cmplt_ps(d2, _mm_set1_ps(closestSq)));
+		if (!mask) continue;
+
+		alignas(16) float d2Arr[4];
+		_mm_store_ps(d2Arr, d2);
+
+		// 가까운 자식이 먼저 pop 되도록 먼 순서로 push
+		uint32_t order[4];
+		uint32_t hitCount = 0;
+		for (uint32_t i = 0; i < 4; ++i)
+		{
+			if (!(mask & (1 << i)) || node.child[i] == kEmptyChild) continue;
+			uint32_t k = hitCount++;
+			while (k > 0 && d2Arr[order[k - 1]] < d2Arr[i])
+			{
+				order[k] = order[k - 1];
+				--k;
+			}
+			order[k] = i;
+		}
+		for (uint32_t k = 0; k < hitCount; ++k)
+		{
+			const uint32_t i = order[k];
+			stack[sp++] = { node.child[i], node.count[i], d2Arr[i] };
+		}
+	}
+
+	if (!found) return false;
+	best.distance = std::sqrt(closestSq);
+	outHit = best;
+	return true;
+}
+
+float TriangleBVH::WindingNumber(const DirectX::XMFLOAT3& point, float accuracy) const
+{
+	if (m_nodes.empty()) return 0.0f;
+
+	const float p[3] = { point.x, point.y, point.z };
+	const __m128 px = _mm_set1_ps(p[0]), py = _mm_set1_ps(p[1]), pz = _mm_set1_ps(p[2]);
+	const __m128 accuracySq = _mm_set1_ps(accuracy * accuracy);
+	const __m128i emptyChild = _mm_set1_epi32(static_cast<int>(kEmptyChild));
+
+	uint32_t localStack[kLocalStackSize];
+	std::vector<uint32_t> heapStack;
+	uint32_t* stack = AcquireStack(localStack, heapStack, traversalStackSize());
+	int sp = 0;
+	stack[sp++] = 0;
+
+	// 입체각 합 (4 pi 로 나누기 전)
+	float omega = 0.0f;
+
+	while (sp > 0)
+	{
+		const uint32_t nodeIndex = stack[--sp];
+		const Node& node = m_nodes[nodeIndex];
+		const WindingNode& wn = m_winding[nodeIndex];
+
+		// 슬롯 4개 : 중심까지 거리 > accuracy * 반경 이면 쌍극자 항 N . (c - p) / |c - p|^3
+		const __m128 dx = _mm_sub_ps(_mm_load_ps(wn.cx), px);
+		const __m128 dy = _mm_sub_ps(_mm_load_ps(wn.cy), py);
+		const __m128 dz = _mm_sub_ps(_mm_load_ps(wn.cz), pz);
+		const __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+		const __m128 r = _mm_load_ps(wn.radius);
+		const __m128 used = _mm_castsi128_ps(_mm_xor_si128(_mm_cmpeq_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(node.child)), emptyChild), _mm_set1_epi32(-1)));
+		const __m128 far = _mm_and_ps(used, _mm_cmpgt_ps(d2, _mm_mul_ps(accuracySq, _mm_mul_ps(r, r))));
+		const int farMask = _mm_movemask_ps(far);
+		const int nearMask = _mm_movemask_ps(_mm_andnot_ps(far, used));
+
+		if (farMask)
+		{
+			const __m128 dotN = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(wn.nx), dx), _mm_mul_ps(_mm_load_ps(wn.ny), dy)), _mm_mul_ps(_mm_load_ps(wn.nz), dz));
+			// far 레인은 d2 > 0 이 보장됨 (나머지 레인은 마스크로 버린다)
+			const __m128 safeD2 = _mm_max_ps(d2, _mm_set1_ps(1e-30f));
+			const __m128 term = _mm_and_ps(far, _mm_div_ps(dotN, _mm_mul_ps(safeD2, _mm_sqrt_ps(safeD2))));
+			alignas(16) float termArr[4];
+			_mm_store_ps(termArr, term);
+			omega += (termArr[0] + termArr[1]) + (termArr[2] + termArr[3]);
+		}
+
+		for (int bits = nearMask; bits; bits &= bits - 1)
+		{
+			const int i = std::countr_zero(static_cast<uint32_t>(bits));
+			if (node.count[i] == 0)
+			{
+				stack[sp++] = node.child[i];
+				continue;
+			}
+
+			// 가까운 leaf : 삼각형별 정확한 입체각
+			const TriangleBlock& block = m_blocks[node.child[i]];
+			for (uint32_t k = 0; k < node.count[i]; ++k)
+			{
+				const float v0[3] = { block.v0x[k], block.v0y[k], block.v0z[k] };
+				const float e1[3] = { block.e1x[k], block.e1y[k], block.e1z[k] };
+				const float e2[3] = { block.e2x[k], block.e2y[k], block.e2z[k] };
+				omega += SolidAngle(p, v0, e1, e2);
+			}
+		}
+	}
+
+	return omega * kInvFourPi;
+}
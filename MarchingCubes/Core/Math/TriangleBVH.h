@@ -0,0 +1,121 @@
+#pragma once
+#include "Core/DataStructures/Data.h"
+#include <DirectXCollision.h>
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+/*
+* 삼각형 메시 레이캐스트용 4-wide BVH
+* - 빌드 : 중심점 기준 SAH binning (축별 kBinCount 구간) 으로 이분할, 한 노드에서 가장 큰 자식부터 다시 나눠 최대 4자식으로 펼침
+* - 노드 : 4개 자식 AABB를 SoA로 저장해 레이-박스 4개를 SSE 한 번에 검사
+* - leaf : 삼각형 최대 8개를 (v0, e1, e2) SoA 블록 하나로 저장 -> AVX2로 레이 1개 x 삼각형 8개 동시 검사
+* - RaycastPacket : 레이 8개 묶음(SoA)을 함께 순회, 박스/삼각형을 8레인으로 검사 (일관된 레이 다발에 유리)
+* - ClosestPoint : 점-박스 거리로 가까운 자식부터 순회, leaf는 점 1개 x 삼각형 8개 거리를 AVX2로 계산
+* - WindingNumber : 노드마다 면적 벡터 합/중심/반경을 저장해 먼 노드는 쌍극자 근사 (fast winding number), 가까운 leaf만 정확한 입체각
+* - 빌드는 단일 스레드. 여러 메시(청크)는 호출 측에서 병렬로 빌드한다.
+* - 깊이 kMaxSahDepth 아래는 SAH 대신 중심점 개수 중앙값 분할 (한쪽으로 치우친 분할이 반복돼도 깊이가 로그로 묶임)
+*   순회 스택은 빌드 때 기록한 최대 깊이로 크기를 정한다 (보통은 지역 배열, 넘치면 힙)
+*/
+class TriangleBVH
+{
+public:
+	struct Hit
+	{
+		float distance = FLT_MAX;
+		uint32_t triangle = UINT32_MAX;	// 원본 인덱스 버퍼 기준 삼각형 번호 (indices[3 * triangle])
+		float u = 0.0f;					// 무게중심 좌표 (v1, v2 가중치)
+		float v = 0.0f;
+	};
+
+	struct ClosestHit
+	{
+		float distance = FLT_MAX;
+		uint32_t triangle = UINT32_MAX;	// 원본 인덱스 버퍼 기준 삼각형 번호
+	};
+
+	// 레이 8개 SoA 묶음. 방향은 정규화되어 있어야 tMax가 거리 단위가 된다.
+	struct RayPacket
+	{
+		static constexpr uint32_t kWidth = 8;
+
+		alignas(32) float ox[kWidth];
+		alignas(32) float oy[kWidth];
+		alignas(32) float oz[kWidth];
+		alignas(32) float dx[kWidth];
+		alignas(32) float dy[kWidth];
+		alignas(32) float dz[kWidth];
+		alignas(32) float tMax[kWidth];			// 입력 : 최대 거리 (음수 = 비활성 레인) / 출력 : 더 가까운 교차가 있으면 그 거리
+		alignas(32) uint32_t triangle[kWidth];	// 출력 : tMax를 갱신한 삼각형 (갱신 없으면 입력 값 유지)
+	};
+
+public:
+	void Build(const GeometryData& meshData);
+	void Build(const DirectX::XMFLOAT3* positions, size_t positionStride, const uint32_t* indices, size_t indexCount);
+	void Clear();
+
+	// distance < maxDistance 인 가장 가까운 교차. dir은 정규화되어 있어야 distance가 거리 단위가 된다.
+	bool Raycast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dir, float maxDistance, Hit& outHit) const;
+	void RaycastPacket(RayPacket& packet) const;
+
+	// distance < maxDistance 인 가장 가까운 삼각형 (점-삼각형 유클리드 거리)
+	bool ClosestPoint(const DirectX::XMFLOAT3& point, float maxDistance, ClosestHit& outHit) const;
+	// 일반화 winding number : 닫힌 메시 안쪽 ~ +-1 (감김 방향에 따라 부호), 바깥 ~ 0. 구멍 난 메시도 0.5 근처 경계로 안팎 판정 가능
+	// 노드 중심까지 거리가 accuracy * 노드 반경보다 멀면 쌍극자 근사 (클수록 정확, 느림)
+	float WindingNumber(const DirectX::XMFLOAT3& point, float accuracy = 2.0f) const;
+
+	bool IsEmpty() const { return m_blocks.empty(); }
+	const DirectX::BoundingBox& GetBounds() const { return m_bounds; }
+	size_t GetNodeCount() const { return m_nodes.size(); }
+	size_t GetTriangleCount() const { return m_triangleCount; }
+	uint32_t GetMaxDepth() const { return m_maxDepth; }
+
+private:
+	static constexpr uint32_t kLeafSize = 8;
+	static constexpr uint32_t kBinCount = 12;
+	static constexpr uint32_t kEmptyChild = UINT32_MAX;
+	static constexpr uint32_t kMaxSahDepth = 32;
+	static constexpr uint32_t kLocalStackSize = 128;
+
+	// count > 0 : leaf (m_blocks[child] 의 앞 count개) / count == 0 : 내부 노드 인덱스 / child == kEmptyChild : 빈 슬롯
+	struct alignas(16) Node
+	{
+		float minX[4], minY[4], minZ[4];
+		float maxX[4], maxY[4], maxZ[4];
+		uint32_t child[4];
+		uint32_t count[4];
+	};
+
+	// 빈 레인은 e1 = e2 = 0 (det = 0) 이라 교차하지 않는다
+	struct alignas(32) TriangleBlock
+	{
+		float v0x[kLeafSize], v0y[kLeafSize], v0z[kLeafSize];
+		float e1x[kLeafSize], e1y[kLeafSize], e1z[kLeafSize];
+		float e2x[kLeafSize], e2y[kLeafSize], e2z[kLeafSize];
+		uint32_t id[kLeafSize];
+	};
+
+	// m_nodes와 같은 인덱스. 자식 슬롯별 면적 벡터 합 (0.5 * e1 x e2), 면적 가중 중심, 중심에서 삼각형까지 최대 거리, 면적 합
+	struct alignas(16) WindingNode
+	{
+		float nx[4], ny[4], nz[4];
+		float cx[4], cy[4], cz[4];
+		float radius[4];
+		float area[4];
+	};
+
+	struct BuildRef;
+	struct Range;
+	uint32_t buildNode(std::vector<BuildRef>& refs, const Range& range, uint32_t depth);
+	bool splitRange(std::vector<BuildRef>& refs, const Range& range, bool medianSplit, Range& outLeft, Range& outRight) const;
+	// 4자식 노드는 깊이마다 pop 1 / push 최대 4 -> 스택은 깊이당 최대 3씩 늘어난다
+	size_t traversalStackSize() const { return 3 * static_cast<size_t>(m_maxDepth) + 4; }
+
+private:
+	std::vector<Node> m_nodes;
+	std::vector<TriangleBlock> m_blocks;
+	std::vector<WindingNode> m_winding;
+	size_t m_triangleCount = 0;
+	uint32_t m_maxDepth = 0;	// 루트 = 1
+	DirectX::BoundingBox m_bounds{};
+};
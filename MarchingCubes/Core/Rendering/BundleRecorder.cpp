@@ -26,7 +26,7 @@ BundleRecorder::BundleRecorder(ID3D12Device* device, ID3D12RootSignature* rootSi
 	}
 }
 
-//  ε PSOList 缭 Pool 籸
+// 핫 리로드된 PSOList에 맞춰서 Pool 재구성
 bool BundleRecorder::SyncWithPSOList(const PSOList* psoList)
 {
     if (!m_device || !m_rootSignature)
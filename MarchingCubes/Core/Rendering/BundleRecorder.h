@@ -5,7 +5,7 @@
 #include <unordered_set>
 #include <unordered_map>
 
-// TODO : Instancing ߰  .
+// TODO : Instancing 추가 시 수정.
 struct BundleKey
 {
 	MaterialConstants material;
@@ -22,5 +22,5 @@ struct BufferBlock
 	BufferBlock(uint64_t off, uint64_t sz, std::string_view o = "") : offset(off), size(sz), owner(o) {}
 };
 
-static constexpr uint32_t PROMOTE_VB_MIN = 256 * 1024; // VB 256KB ̻  °
-static constexpr uint32_t PROMOTE_IB_MIN = 64 * 1024; // IB 64KB ̻  °
\ No newline at end of file
+static constexpr uint32_t PROMOTE_VB_MIN = 256 * 1024; // VB는 256KB 이상일 경우 승격
+static constexpr uint32_t PROMOTE_IB_MIN = 64 * 1024; // IB는 64KB 이상일 경우 승격
\ No newline at end of file
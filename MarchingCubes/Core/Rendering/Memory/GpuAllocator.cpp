@@ -131,7 +131,7 @@ void GpuAllocator::Alloc(ID3D12Device* device, const AllocDesc& desc, BufferHand
 				return;
 			}
 
-			// °  Ѿٸ °
+			// 승격 기준을 넘었다면 승격
 			if (desc.size >= promoteMin && desc.lifetime == AllocDesc::LifeTime::LONG)
 			{
 				PromoteAndAlloc(device, desc, outHandle, m_promotedResources, m_lastCompletedFenceValue);
@@ -266,7 +266,7 @@ void GpuAllocator::AllocFromFallback(ID3D12Device* device, const AllocDesc& desc
 
 			if (hp.Type != neededType || size > fallback.desc.size) continue;
 
-			// fallbackBuffer Ҵ ϸ   
+			// fallbackBuffer에 할당 가능하면 이 슬롯을 리턴
 			return static_cast<int>(i);
 		}
 		return -1;
@@ -300,7 +300,7 @@ void GpuAllocator::AllocFromFallback(ID3D12Device* device, const AllocDesc& desc
 		Log::Print("GpuAllocator", "New Fallback Slot Allocated slot = %d", slot);
 	}
 
-	// Ҵ
+	// 할당
 	auto& fallbackSlot = m_fallbackUploads[slot];
 	outHandle.res = fallbackSlot.res.Get();
 	outHandle.offset = 0;
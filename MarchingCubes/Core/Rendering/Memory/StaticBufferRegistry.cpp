@@ -68,7 +68,7 @@ void StaticBufferRegistry::Release(uint32_t handle)
 		Log::Print("StaticBufferRegistry", "Invalid ObjectEntry Handle!!!!");
 		return;
 	}
-	// ObjectEntry 
+	// ObjectEntry 해제
 	ObjectEntry& entry = m_objectEntries[handle];
 	if (!entry.bAlive) return;
 
@@ -86,7 +86,7 @@ void StaticBufferRegistry::Release(uint32_t handle)
 
 uint32_t StaticBufferRegistry::CreateStaticVB(ID3D12Device* device, uint32_t vbBytes, uint32_t vertexStride, std::string_view debugName)
 {
-	//     ϰ ƴϸ  ߰
+	// 사용 가능한 슬롯이 있으면 사용하고 아니면 새로 추가
 	uint32_t vbHandle = UINT_MAX;
 	for (uint32_t i = 0; i < m_vbEntries.size(); ++i)
 	{
@@ -105,7 +105,7 @@ uint32_t StaticBufferRegistry::CreateStaticVB(ID3D12Device* device, uint32_t vbB
 
 	VBEntry& entry = m_vbEntries[vbHandle];
     uint64_t offset = AllocFromHeap(m_vbFreeList, vbBytes);
-	// Ҵ ϸ  ũ⸦  ø , ʱ  ũ⸦ ũ    .
+	// 할당이 실패하면 힙 크기를 동적으로 늘릴 지, 초기 힙 크기를 크게 둘 지 선택할 것.
 	assert(offset < UINT64_MAX && "StaticBufferRegistry : VBHeap Overflowed");
     D3D12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(vbBytes);
     ThrowIfFailed(device->CreatePlacedResource(m_VBHeap.Get(), offset, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&entry.res)));
@@ -139,9 +139,9 @@ uint32_t StaticBufferRegistry::CreateStaticIB(ID3D12Device* device, uint32_t ibB
 	}
 
 	IBEntry& entry = m_ibEntries[ibHandle];
-	// FreeBlock ȿ Offset ޾ƿ
+	// FreeBlock에서 유효한 Offset을 받아옴
 	uint64_t offset = AllocFromHeap(m_ibFreeList, ibBytes);
-	// Ҵ ϸ  ũ⸦  ø , ʱ  ũ⸦ ũ    .
+	// 할당이 실패하면 힙 크기를 동적으로 늘릴 지, 초기 힙 크기를 크게 둘 지 선택할 것.
 	assert(offset < UINT64_MAX && "StaticBufferRegistry : IBHeap Overflowed");
 
 	D3D12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(ibBytes);
@@ -166,12 +166,12 @@ uint64_t StaticBufferRegistry::AllocFromHeap(std::vector<BufferBlock>& freeList,
 		const uint64_t blockSize = freeList[i].size;
 		const uint64_t offset = AlignUp64(blockOffset, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
 		uint64_t padding = offset - blockOffset;
-		if (blockSize < padding) continue; //  ķ  free   continue.
+		if (blockSize < padding) continue; // 오프셋 정렬로 인해 free 공간을 벗어나면 continue.
 
-		uint64_t remain = blockSize - padding; //  Ҵ   
-		if (remain < alignedBytes) continue; //  Ȯ
+		uint64_t remain = blockSize - padding; // 실제 할당 가능한 남은 공간
+		if (remain < alignedBytes) continue; // 가용공간 확인
 
-		// free   缳
+		// free 앞 공간 재설정
 		if (padding > 0)
 		{
 			freeList[i].size = padding;
@@ -182,7 +182,7 @@ uint64_t StaticBufferRegistry::AllocFromHeap(std::vector<BufferBlock>& freeList,
 			--i;
 		}
 
-		//   ߰
+		// 뒷 공간 추가
 		uint64_t tailOffset = offset + alignedBytes;
 		uint64_t tailSize = (blockOffset + blockSize) - tailOffset;
 		if (tailSize > 0) freeList.push_back(BufferBlock(tailOffset, tailSize));
@@ -248,7 +248,7 @@ void StaticBufferRegistry::Free(std::vector<BufferBlock>& freeList, uint64_t hea
 {
 	if (size == 0) return;
 
-	//  &  
+	// 경계 & 정렬 보정
 	if (offset >= heapSize) return;
 	if (offset + size > heapSize) size = heapSize - offset;
 	if (size == 0) return;
@@ -270,7 +270,7 @@ void StaticBufferRegistry::Free(std::vector<BufferBlock>& freeList, uint64_t hea
 void StaticBufferRegistry::MergeFree(std::vector<BufferBlock>& freeList)
 {
 	if (freeList.empty()) return;
-	// offset  
+	// offset 순으로 재정렬
 	std::sort(freeList.begin(), freeList.end(), [](auto& a, auto& b) {return a.offset < b.offset; });
 	std::vector<BufferBlock> result;
 	result.reserve(freeList.size());
@@ -14,7 +14,7 @@ UploadRing::UploadRing(ID3D12Device* device, uint64_t totalSize)
 	ThrowIfFailed(device->CreateCommittedResource(&hpUpload, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(m_uploadBuffer.ReleaseAndGetAddressOf())));
 	NAME_D3D12_OBJECT(m_uploadBuffer);
 
-	//   (https://learn.microsoft.com/en-us/windows/win32/api/d3d12/nf-d3d12-id3d12resource-map)
+	// 영구 매핑 (https://learn.microsoft.com/en-us/windows/win32/api/d3d12/nf-d3d12-id3d12resource-map)
 	D3D12_RANGE readRange = { 0, 0 };
 	ThrowIfFailed(m_uploadBuffer->Map(0, &readRange, reinterpret_cast<void**>(&m_mappedPtr)));
 }
@@ -24,10 +24,10 @@ UploadRing::~UploadRing()
 	m_mappedPtr = nullptr;
 }
 
-// ε   Ҵ
+// 업로드 할 공간 할당
 bool UploadRing::Allocate(const uint64_t alignedSize, uint64_t& outOffset, uint8_t*& outPtr)
 {
-	// Ҵ ũⰡ  ü ũ⺸ Ŭ   
+	// 할당 크기가 가능한 전체 크기보다 클 경우 무조건 실패
 	if (alignedSize > m_totalSize)
 	{
 		Log::Print("UploadRing", "Allocated Failed. total : %llu, trying : %llu", m_totalSize, alignedSize);
@@ -35,7 +35,7 @@ bool UploadRing::Allocate(const uint64_t alignedSize, uint64_t& outOffset, uint8
 	}
 
 	uint64_t used = (m_head < m_tail) ? (m_totalSize - m_tail) + m_head : m_head - m_tail;
-	//   Ҵ  üũ
+	// 남은 공간에 할당 가능한지 체크
 	if (alignedSize > m_totalSize - used - 1)
 	{
 		Log::Print("UploadRing", "Allocated Failed. remain : %llu, trying : %llu", m_totalSize - used - 1, alignedSize);
@@ -77,7 +77,7 @@ bool UploadRing::Allocate(const uint64_t alignedSize, uint64_t& outOffset, uint8
 	return true;
 }
 
-// ̹ ӿ Ҵ 鿡  潺  
+// 이번 프레임에 할당된 공간들에 대해 펜스 값을 설정
 void UploadRing::TagFence(uint64_t fenceValue)
 {
 	if (m_unframed.empty()) return;
@@ -28,7 +28,7 @@ private:
     uint64_t m_totalSize = 0;
     uint64_t m_head = 0;
     uint64_t m_tail = 0;
-    std::deque<UploadAllocation> m_inFlight; // Ϸ   
-    std::vector<UploadAllocation> m_unframed; //  ҴǾ fence    
+    std::deque<UploadAllocation> m_inFlight; // 완료 대기 중인 공간들
+    std::vector<UploadAllocation> m_unframed; // 새로 할당되어 fence 값이 지정되지 않은 공간들
 };
 
@@ -4,12 +4,12 @@ class DescriptorRing
 public:
     DescriptorRing(ID3D12Device* device, uint32_t ringCount, uint32_t descriptorsPerFrame, uint32_t staticCount);
 
-    //  GPU Descriptor Handle ġ ε
+    // 동적 GPU Descriptor Handle 위치 인덱싱
     D3D12_GPU_DESCRIPTOR_HANDLE GpuAt(uint32_t frameIdx, uint32_t slot) const;
-    //  GPU Descriptor Handle ġ ε
+    // 정적 GPU Descriptor Handle 위치 인덱싱
     D3D12_GPU_DESCRIPTOR_HANDLE StaticGpuAt(uint32_t index = 0) const;
 
-    //  CPU Descriptor Handle ġ ε
+    // 동적 CPU Descriptor Handle 위치 인덱싱
     D3D12_CPU_DESCRIPTOR_HANDLE CpuAt(uint32_t frameIdx, uint32_t slot) const;
     D3D12_CPU_DESCRIPTOR_HANDLE StaticCpuAt(uint32_t index = 0) const;
 
@@ -7,7 +7,7 @@
 #include <dxgiFormat.h>
 #include <array>
 
-// Է ڿ ȭ: ҹ, / , ھ 
+// 입력 문자열을 정규화: 소문자, 공백/하이픈 제거, 언더스코어 유지
 inline std::string Canonicalize(std::string_view s)
 {
     std::string out; out.reserve(s.size());
@@ -19,7 +19,7 @@ inline std::string Canonicalize(std::string_view s)
     return out;
 }
 
-// ĵ LUT Ž
+// 정렬된 LUT에서 탐색
 template <typename Enum, size_t N>
 constexpr Enum ParseEnum(std::string_view in, const std::array<std::pair<std::string_view, Enum>, N>& LUT, Enum default_value)
 {
@@ -34,7 +34,7 @@ constexpr Enum ParseEnum(std::string_view in, const std::array<std::pair<std::st
 }
 
 // DXGI_FORMAT
-// Ű canonical string: "r8g8b8a8_unorm"  "r8g8b8a8_unorm" (ھ )
+// 키는 canonical string: "r8g8b8a8_unorm" → "r8g8b8a8_unorm" (언더스코어 유지)
 static constexpr auto kDXGIFormatLUT = std::to_array<std::pair<std::string_view, DXGI_FORMAT>>({
     std::pair{"r8g8b8a8_unorm",   DXGI_FORMAT_R8G8B8A8_UNORM},
     std::pair{"r11g11b10_float",  DXGI_FORMAT_R11G11B10_FLOAT},
@@ -63,7 +63,7 @@ static constexpr auto kCullLUT = std::to_array<std::pair<std::string_view, D3D12
     std::pair{"back",  D3D12_CULL_MODE_BACK},
     });
 
-// Depth func (Ī )
+// Depth func (별칭까지 포함)
 static constexpr auto kCmpLUT = std::to_array<std::pair<std::string_view, D3D12_COMPARISON_FUNC>>({
     std::pair{"less",          D3D12_COMPARISON_FUNC_LESS},
     std::pair{"equal",         D3D12_COMPARISON_FUNC_EQUAL},
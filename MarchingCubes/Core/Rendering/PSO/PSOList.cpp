@@ -62,15 +62,15 @@ ComPtr<ID3D12PipelineState> PSOList::CreatePSO_v1(const BuildContext& ctx, const
     d.pRootSignature = ctx.root;
     d.InputLayout = ctx.inputLayout;
 
-    // ̴
+    // 셰이더
     ComPtr<ID3DBlob> VS = s.shaders.vs.empty() ? ComPtr<ID3DBlob>() : LoadFileBlob(s.shaders.vs);
     ComPtr<ID3DBlob> PS = s.shaders.ps.empty() ? ComPtr<ID3DBlob>() : LoadFileBlob(s.shaders.ps);
     ComPtr<ID3DBlob> DS = s.shaders.ds.empty() ? ComPtr<ID3DBlob>() : LoadFileBlob(s.shaders.ds);
     ComPtr<ID3DBlob> HS = s.shaders.hs.empty() ? ComPtr<ID3DBlob>() : LoadFileBlob(s.shaders.hs);
     ComPtr<ID3DBlob> GS = s.shaders.gs.empty() ? ComPtr<ID3DBlob>() : LoadFileBlob(s.shaders.gs);
 
-    if (!s.shaders.vs.empty() && !VS) return nullptr; // ʼ  
-    if (!s.shaders.ps.empty() && !PS && s.topology != "line") return nullptr; // Filled/DebugNormal PS 
+    if (!s.shaders.vs.empty() && !VS) return nullptr; // 필수인 경우 실패
+    if (!s.shaders.ps.empty() && !PS && s.topology != "line") return nullptr; // Filled/DebugNormal은 PS 기대
 
     if (VS) d.VS = { VS->GetBufferPointer(), VS->GetBufferSize() };
     if (PS) d.PS = { PS->GetBufferPointer(), PS->GetBufferSize() };
@@ -78,7 +78,7 @@ ComPtr<ID3D12PipelineState> PSOList::CreatePSO_v1(const BuildContext& ctx, const
     if (HS) d.HS = { HS->GetBufferPointer(), HS->GetBufferSize() };
     if (GS) d.GS = { GS->GetBufferPointer(), GS->GetBufferSize() };
 
-    // ⺻
+    // 기본값
     d.RasterizerState = CD3DX12_RASTERIZER_DESC(D3D12_DEFAULT);
     d.BlendState = CD3DX12_BLEND_DESC(D3D12_DEFAULT);
     d.DepthStencilState = CD3DX12_DEPTH_STENCIL_DESC(D3D12_DEFAULT);
@@ -1,7 +1,7 @@
 #pragma once
 #include <optional>
 
-// ------------ Raw (optional) structs: JSON  "" ------------
+// ------------ Raw (optional) structs: JSON에서 읽은 "원본" ------------
 struct PSOShaderPathsRaw { std::optional<std::string> vs, ps, ds, hs, gs; };
 struct PSORTRaw { std::optional<std::string> format, dsv; std::optional<int> msaa; std::optional<bool> depthOnly; };
 struct PSORasterRaw { std::optional<std::string> fill, cull; std::optional<bool> frontCCW; };
@@ -22,7 +22,7 @@ struct PSOSpecRaw {
     std::optional<std::string> topology; // "triangle" | "line" | "point"
 };
 
-// ------------ Resolved (concrete) structs: /⺻  Ϸ ------------
+// ------------ Resolved (concrete) structs: 상속/기본값 적용 완료 ------------
 struct PSOShaderPaths { std::string vs, ps, ds, hs, gs; };
 struct PSORT { std::string format = "R8G8B8A8_UNORM", dsv = "D32_FLOAT"; int msaa = 1; bool depthOnly = false; };
 struct PSORaster { std::string fill = "solid", cull = "back"; bool frontCCW = false; };
@@ -41,5 +41,5 @@ struct PSOSpec {
     std::string    topology = "triangle";
 };
 
-// JSON ε +  ؼ Ϸ Ʈ ȯ
+// JSON 로드 + 상속 해석까지 완료된 리스트를 반환
 std::vector<PSOSpec> LoadPSOJsonResolved(LPCWSTR path, int* outSchema = nullptr);
\ No newline at end of file
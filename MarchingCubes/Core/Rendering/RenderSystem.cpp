@@ -53,7 +53,7 @@ RenderSystem::~RenderSystem()
 	}
 }
 
-// PSO  CB ε
+// PSO의 공용 CB를 업로드
 void RenderSystem::PrepareRender(_In_ UploadContext* uploadContext, _In_ DescriptorAllocator* descriptorAllocator, const CameraConstants& cameraData, const LightBlobView& lightData, uint32_t frameIndex)
 {
 	uploadContext->UploadContstants(frameIndex, &cameraData, sizeof(CameraConstants), m_cameraBuf);
@@ -70,14 +70,14 @@ void RenderSystem::PrepareRender(_In_ UploadContext* uploadContext, _In_ Descrip
 	m_lightsGpu = descriptorAllocator->GetDynamicGpu(frameIndex, lightsSlot);
 }
 
-//  
+// 렌더링 
 void RenderSystem::RenderFrame(_In_ ID3D12GraphicsCommandList* cmd, _In_ UploadContext* uploadContext)
 {
 	// Bind Common RootCBV
 	cmd->SetGraphicsRootConstantBufferView(0, m_cameraBuf.gpuVA);
 	cmd->SetGraphicsRootDescriptorTable(2, m_lightsGpu);
 
-	// PSO  Draw Command 
+	// PSO 별로 Draw Command 실행
 	for (int i = 0; i < m_psoList->Count(); ++i) 
 	{
 		auto* pso = m_psoList->Get(i);
@@ -86,12 +86,12 @@ void RenderSystem::RenderFrame(_In_ ID3D12GraphicsCommandList* cmd, _In_ UploadC
 		cmd->SetPipelineState(pso);
 		for (auto& item : bucket.renderItems)
 		{
-			// Object CB 
+			// Object CB 세팅
 			ObjectConstants objConsts{
 				.materialIndex = item.materialIndex
 			};
 
-			// row-major -> column-major ȯ
+			// row-major -> column-major 변환
 			XMMATRIX worldMatrix = XMLoadFloat4x4(&item.worldMatrix);
 			XMStoreFloat4x4(&objConsts.worldMatrix, XMMatrixTranspose(worldMatrix));
 			XMStoreFloat4x4(&objConsts.worldInvMatrix, XMMatrixInverse(nullptr, worldMatrix));
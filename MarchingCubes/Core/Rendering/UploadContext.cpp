@@ -2,6 +2,7 @@
 #include "UploadContext.h"
 #include "Memory/GpuAllocator.h"
 #include "Memory/StaticBufferRegistry.h"
+#include <algorithm>
 #include <unordered_map>
 
 UploadContext::UploadContext(ID3D12Device* device, GpuAllocator* allocator, StaticBufferRegistry* staticBufferRegistry, DescriptorAllocator* descriptorAllocator) :
@@ -12,7 +13,7 @@ UploadContext::UploadContext(ID3D12Device* device, GpuAllocator* allocator, Stat
 {
 }
 
-// ε 
+// 업로드 제출
 void UploadContext::Execute(ID3D12GraphicsCommandList* cmd)
 {
 	assert(m_device && "UploadContext::Execute : device is Invalid!!!!");
@@ -25,7 +26,7 @@ void UploadContext::Execute(ID3D12GraphicsCommandList* cmd)
 		if (iter == targets.end()) targets.emplace(res, back);
 		};
 
-	// 1ܰ : COPY_DEST  
+	// 1단계 : COPY_DEST로 상태 전이
 	for (auto& pending : m_pendingUploads)
 	{
 		if (pending.state != PendingUpload::UploadState::Enqueued) continue;
@@ -44,12 +45,24 @@ void UploadContext::Execute(ID3D12GraphicsCommandList* cmd)
 		cmd->ResourceBarrier((uint32_t)barriers.size(), barriers.data());
 	}
 
-	// 2ܰ : Upload -> Default 
+	// 2단계 : Upload -> Default 복사
 	for (auto& pending : m_pendingUploads)
 	{
 		if (pending.state != PendingUpload::UploadState::Enqueued) continue;
 
 		const BufferHandle& staging = pending.stagingHandle;
+		// 부분 업로드 : 바뀐 구간만 복사
+		if (!pending.regions.empty())
+		{
+			for (const CopyRegion& region : pending.regions)
+			{
+				const BufferHandle& dst = region.index ? pending.ibHandle : pending.vbHandle;
+				if (!dst.res) continue;
+				cmd->CopyBufferRegion(dst.res, dst.offset + region.dstOffset, staging.res, staging.offset + region.srcOffset, region.size);
+			}
+			pending.state = PendingUpload::UploadState::Recorded;
+			continue;
+		}
 		// vb
 		if (pending.vbSize && pending.vbHandle.res)
 		{
@@ -64,7 +77,7 @@ void UploadContext::Execute(ID3D12GraphicsCommandList* cmd)
 		pending.state = PendingUpload::UploadState::Recorded;
 	}
 
-	// 3ܰ :  ǵ
+	// 3단계 : 상태 되돌리기
 	if (!targets.empty())
 	{
 		std::vector<D3D12_RESOURCE_BARRIER> barriers;
@@ -77,7 +90,7 @@ void UploadContext::Execute(ID3D12GraphicsCommandList* cmd)
 	}
 }
 
-// GPU  ۾  ͵ ħ   inflight ó
+// GPU 명령 작업이 끝난 것들은 침범할 수 없도록 inflight 처리
 void UploadContext::TrackPendingAllocations(uint64_t submitFenceValue)
 {
 	m_allocator->TagFence(submitFenceValue);
@@ -91,7 +104,7 @@ void UploadContext::TrackPendingAllocations(uint64_t submitFenceValue)
 		}
 	}
 
-	// üߴٸ Free
+	// 교체했다면 Free
 	if (!m_reclaimed.empty())
 	{
 		std::vector<BufferHandle> toFree;
@@ -103,7 +116,7 @@ void UploadContext::TrackPendingAllocations(uint64_t submitFenceValue)
 	}
 }
 
-// GPU    ӿ Ҵ ϵ 
+// GPU 명령이 끝나면 다음 프레임에 할당 가능하도록 세팅
 void UploadContext::Reclaim(uint64_t completedFenceValue)
 {
 	for (auto& pu : m_pendingUploads) {
@@ -121,7 +134,7 @@ void UploadContext::Reclaim(uint64_t completedFenceValue)
 		m_pendingUploads.erase(it, m_pendingUploads.end());
 }
 
-// Object CB ε
+// Object CB 업로드
 void UploadContext::UploadObjectConstants(uint32_t frameIndex, GeometryBuffer* buf, const ObjectConstants& cb)
 {
 	if (!buf) return;
@@ -183,7 +196,7 @@ void UploadContext::ResetCounterUAV(ID3D12GraphicsCommandList* cmd, ID3D12Resour
 		cmd->ResourceBarrier(1, &toCopyDest);
 	}
 
-	// 0 ī ۷ 
+	// 0을 카운터 버퍼로 복사
 	cmd->CopyBufferRegion(counter, 0, m_zeroUintUpload.Get(), 0, sizeof(uint32_t));
 
 	auto toAfter = CD3DX12_RESOURCE_BARRIER::Transition(counter, D3D12_RESOURCE_STATE_COPY_DEST, after);
@@ -194,11 +207,11 @@ void UploadContext::UploadGeometry(GeometryBuffer* buffer, const GeometryData& c
 {
 	const uint64_t vbBytes = cpuData.vertices.size() * sizeof(Vertex);
 	const uint64_t ibBytes = cpuData.indices.size() * sizeof(uint32_t);
-	uint64_t vbAligned = AlignUp64(vbBytes, 4ull); // 4byte 
-	uint64_t ibAligned = AlignUp64(ibBytes, 4ull); // R32_UINT ϹǷ 4bytes 
+	uint64_t vbAligned = AlignUp64(vbBytes, 4ull); // 4byte 정렬
+	uint64_t ibAligned = AlignUp64(ibBytes, 4ull); // R32_UINT 사용하므로 4bytes 정렬
 	uint64_t totalBytes = vbAligned + ibAligned;
 
-	// Default VB/IB εǾִ Ȯϰ  Ҵ޴´.
+	// Default VB/IB 바인딩되어있는지 확인하고 없으면 할당받는다.
 	EnsureDefaultVB(buffer, vbBytes, debugName);
 	EnsureDefaultIB(buffer, ibBytes, debugName);
 
@@ -215,13 +228,17 @@ void UploadContext::UploadGeometry(GeometryBuffer* buffer, const GeometryData& c
 	bool already = false;
 	for (auto& e : m_pendingUploads)
 	{
-		// ̹ copy  ¿ٸ Upload ۸ ü
+		// 이미 copy 대기 상태였다면 Upload 버퍼만 교체 (대기 중이던 부분 업로드도 전체 복사로 바뀐다)
 		if (e.state == PendingUpload::UploadState::Enqueued && e.buffer == buffer)
 		{
 			already = true;
 			e.vbHandle = buffer->GetVBHandle();
 			e.ibHandle = buffer->GetIBHandle();
 			e.stagingHandle = stagingHandle;
+			e.vbSize = vbBytes;
+			e.ibSize = ibBytes;
+			e.vbAligned = vbAligned;
+			e.regions.clear();
 			break;
 		}
 	}
@@ -240,6 +257,84 @@ void UploadContext::UploadGeometry(GeometryBuffer* buffer, const GeometryData& c
 	}
 }
 
+void UploadContext::UploadGeometryRanges(GeometryBuffer* buffer, const GeometryData& cpuData, const std::vector<GeometryRange>& ranges, std::string_view debugName)
+{
+	const uint64_t vbBytes = cpuData.vertices.size() * sizeof(Vertex);
+	const uint64_t ibBytes = cpuData.indices.size() * sizeof(uint32_t);
+
+	bool full = ranges.empty() || buffer->GetVBHandle().size < vbBytes || buffer->GetIBHandle().size < ibBytes;
+	for (const auto& e : m_pendingUploads)
+	{
+		if (e.state == PendingUpload::UploadState::Enqueued && e.buffer == buffer) full = true;
+	}
+	if (full)
+	{
+		UploadGeometry(buffer, cpuData, debugName);
+		return;
+	}
+
+	// 정점/인덱스 구간을 각각 정렬 후 겹치거나 맞닿은 구간 병합 -> CopyBufferRegion 수 최소화
+	using Span = std::pair<uint32_t, uint32_t>;	// [begin, end)
+	auto mergeSpans = [](std::vector<Span>& spans) {
+		std::sort(spans.begin(), spans.end());
+		size_t n = 0;
+		for (const Span& s : spans)
+		{
+			if (n > 0 && s.first <= spans[n - 1].second) spans[n - 1].second = std::max(spans[n - 1].second, s.second);
+			else spans[n++] = s;
+		}
+		spans.resize(n);
+	};
+
+	std::vector<Span> vertexSpans, indexSpans;
+	vertexSpans.reserve(ranges.size());
+	indexSpans.reserve(ranges.size());
+	for (const GeometryRange& r : ranges)
+	{
+		if (r.vertexCount) vertexSpans.emplace_back(r.vertexOffset, std::min<uint32_t>(r.vertexOffset + r.vertexCount, static_cast<uint32_t>(cpuData.vertices.size())));
+		if (r.indexCount) indexSpans.emplace_back(r.indexOffset, std::min<uint32_t>(r.indexOffset + r.indexCount, static_cast<uint32_t>(cpuData.indices.size())));
+	}
+	mergeSpans(vertexSpans);
+	mergeSpans(indexSpans);
+
+	uint64_t vbPatch = 0, ibPatch = 0;
+	for (const Span& s : vertexSpans) vbPatch += uint64_t(s.second - s.first) * sizeof(Vertex);
+	for (const Span& s : indexSpans) ibPatch += uint64_t(s.second - s.first) * sizeof(uint32_t);
+	if (vbPatch + ibPatch == 0) return;
+
+	BufferHandle stagingHandle{};
+	m_allocator->Alloc(m_device, GPUAllocDesc::MakeStagingBufferDesc(vbPatch + ibPatch, 4u, AllocDesc::LifeTime::SHORT, debugName), stagingHandle);
+	uint8_t* ptr = stagingHandle.cpuPtr;
+	assert(ptr && "Staging Handle Pointer is Invalid !!!!");
+
+	PendingUpload pu{};
+	pu.stagingHandle = stagingHandle;
+	pu.vbHandle = buffer->GetVBHandle();
+	pu.ibHandle = buffer->GetIBHandle();
+	pu.state = PendingUpload::UploadState::Enqueued;
+	pu.vbSize = vbPatch;
+	pu.ibSize = ibPatch;
+	pu.buffer = buffer;
+	pu.regions.reserve(vertexSpans.size() + indexSpans.size());
+
+	uint64_t src = 0;
+	for (const Span& s : vertexSpans)
+	{
+		const uint64_t bytes = uint64_t(s.second - s.first) * sizeof(Vertex);
+		memcpy(ptr + src, cpuData.vertices.data() + s.first, bytes);
+		pu.regions.push_back({ .srcOffset = src, .dstOffset = uint64_t(s.first) * sizeof(Vertex), .size = bytes, .index = false });
+		src += bytes;
+	}
+	for (const Span& s : indexSpans)
+	{
+		const uint64_t bytes = uint64_t(s.second - s.first) * sizeof(uint32_t);
+		memcpy(ptr + src, cpuData.indices.data() + s.first, bytes);
+		pu.regions.push_back({ .srcOffset = src, .dstOffset = uint64_t(s.first) * sizeof(uint32_t), .size = bytes, .index = true });
+		src += bytes;
+	}
+	m_pendingUploads.push_back(std::move(pu));
+}
+
 void UploadContext::EnsureDefaultVB(GeometryBuffer* buf, uint64_t neededSize, std::string_view debugName)
 {
 	BufferHandle curVB = buf->GetVBHandle();
@@ -289,7 +384,7 @@ void UploadContext::EnsureZeroUintUpload()
 	ThrowIfFailed(m_device->CreateCommittedResource(&hpUpload, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_zeroUintUpload)));
 	NAME_D3D12_OBJECT(m_zeroUintUpload);
 
-	// 4Ʈ 0 äα
+	// 4바이트 0으로 채워두기
 	void* p = nullptr;
 	D3D12_RANGE range{ 0, 0 }; // write-only
 	ThrowIfFailed(m_zeroUintUpload->Map(0, &range, &p));
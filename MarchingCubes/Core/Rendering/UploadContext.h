@@ -27,6 +27,8 @@ public:
 	void ResetCounterUAV(ID3D12GraphicsCommandList* cmd, ID3D12Resource* counter, D3D12_RESOURCE_STATES before, D3D12_RESOURCE_STATES after, std::string_view debugName = "CounterReset");
 
 	void UploadGeometry(GeometryBuffer* buffer, const GeometryData& cpuData, std::string_view debugName);
+	// cpuData 중 ranges 구간만 기존 VB/IB에 덮어쓴다. 버퍼가 작거나 같은 버퍼의 업로드가 대기 중이면 전체 업로드로 대체
+	void UploadGeometryRanges(GeometryBuffer* buffer, const GeometryData& cpuData, const std::vector<GeometryRange>& ranges, std::string_view debugName);
 
 private:
 	void EnsureDefaultVB(GeometryBuffer* buf, uint64_t neededSize, std::string_view debugName = nullptr);
@@ -41,6 +43,14 @@ private:
 	DescriptorAllocator* m_descriptorAllocator = nullptr;
 	ComPtr<ID3D12Resource> m_zeroUintUpload;
 
+	// 부분 업로드 복사 구간 (staging 기준 src, VB/IB 기준 dst, 바이트 단위)
+	struct CopyRegion {
+		uint64_t srcOffset = 0;
+		uint64_t dstOffset = 0;
+		uint64_t size = 0;
+		bool index = false;
+	};
+
 	struct PendingUpload {
 		BufferHandle stagingHandle;
 		BufferHandle vbHandle;
@@ -58,6 +68,7 @@ private:
 		uint64_t vbAligned = 0;
 		uint64_t fenceValue = 0;
 		GeometryBuffer* buffer = nullptr;
+		std::vector<CopyRegion> regions;	// 비어 있으면 VB/IB 전체 복사
 	};
 	std::vector<PendingUpload> m_pendingUploads;
 
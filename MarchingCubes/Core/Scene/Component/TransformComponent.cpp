@@ -14,7 +14,7 @@ DirectX::XMMATRIX TransformComponent::GetWorldMatrix() const
 
 	XMMATRIX local = S * R * T;
 	
-	//  Transform 
+	// 계층형 Transform 적용
 	while (GameObject* currentAncestor = GetOwner()->GetOwner())
 	{
 		if (auto parentTransform = currentAncestor->GetComponent<TransformComponent>())
@@ -6,13 +6,13 @@
 class GameObject;
 
 /* [TransformComponent]
-* - Definition : Transform   Ʈ
+* - Definition : Transform 정보를 담는 컴포넌트
 * - LifeTime : AddComponent -> Destroy
 * - Inheritence : Component
 * - Access : SceneObject::GetTransformComponent
 * - Responsibility :
-*	- Transform : Ʈ 
-* - Note : ⺻ Local Space, World Space World λ縦 δ.
+*	- Transform : 컴포넌트의 행렬
+* - Note : 기본적으로 Local Space, World Space는 World 접두사를 붙인다.
 */
 class TransformComponent : public Component
 {
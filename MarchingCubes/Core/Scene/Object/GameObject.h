@@ -5,15 +5,15 @@
 class Scene;
 
 /* [GameObject]
-* - Definition : Component GameObject  ĺ  ü
+* - Definition : Component와 GameObject들을 담는 식별 가능한 객체
 * - LifeTime : AddObject -> Destroy
 * - OwnerShip : Scene
 * - Responsibility :
-*	- Component : ϴ Component std::vector 
-*	- GameObject : ڽ GameObject std::vector  + θ GameObject Raw Pointer 
+*	- Component : 소유하는 Component를 std::vector로 관리
+*	- GameObject : 자식 GameObject를 std::vector로 관리 + 부모 GameObject를 Raw Pointer로 관리
 */
 
-//CRTP 
+//CRTP 패턴
 template<typename Derived>
 class GameObjectBase
 {
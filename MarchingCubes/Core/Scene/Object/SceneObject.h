@@ -6,13 +6,13 @@
 class Scene;
 
 /* [SceneObject]
-* - Definition : Scene ġ  Ʈ
+* - Definition : Scene에 배치 가능한 오브젝트
 * - LifeTime : Scene Load -> Scene UnLoad
 * - Inheritence : GameObject
 * - Access : Scene::GetSceneObject
 * - Responsibility :
-*	- TransformComponent : TransformComponent ĳϿ 
-*	- Scene : ش Ʈ  Scene 
+*	- TransformComponent : TransformComponent를 캐싱하여 관리
+*	- Scene : 해당 오브젝트를 소유중인 Scene 참조
 */
 class SceneObject : public GameObject, public GameObjectBase<SceneObject>
 {
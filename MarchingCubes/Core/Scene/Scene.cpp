@@ -20,7 +20,7 @@ Scene::~Scene()
 
 void Scene::Init()
 {
-    // Ʈ GameMode 
+    // 디폴트로 GameMode 생성
     m_gameMode = CreateObject<GameMode>();
 }
 
@@ -129,7 +129,7 @@ void Scene::SetMainCamera(CameraComponent* cameraComp)
 void Scene::RenderSceneGizmoUI()
 {
 #ifdef _DEBUG
-    //  Ʈ  ϴܿ پִ 
+    // 씬 뷰포트 좌측 하단에 붙어있는 기즈모
     ImGuiViewport* mainViewport = ImGui::GetMainViewport();
     float windowScreenX = mainViewport->Pos.x;
     float windowScreenY = mainViewport->Pos.y;
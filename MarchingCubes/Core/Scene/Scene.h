@@ -2,12 +2,12 @@
 #include "Core/Scene/Object/SceneObject.h"
 
 /* [Scene]
-* - Definition :    
+* - Definition : 실행 가능한 장면의 단위
 * - LifeTime : Scene Load Requested -> Scene Transition/Exit Requested
 * - OwnerShip : Engine
 * - Access : Engine::GetCurrentScene() / Engine::GetScene(std::filesystem::path scenePath)
 * - Responsibility : 
-*	- SceneObject : std::vector 
+*	- SceneObject : std::vector로 관리
 *   - 
 */
 class CameraComponent;
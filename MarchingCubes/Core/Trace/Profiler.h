@@ -6,8 +6,8 @@
 #include "Core/Rendering/Memory/CommonMemory.h"
 
 /* -------- Profiler ---------
-* ϸ  ʿ ͸ صδ Ŭ
-* SnapShot Ͽ صΰ UI , α   SnapShot óϴ  å ´.
+* 프로파일링을 위해 필요한 데이터를 저장해두는 클래스
+* SnapShot을 가곧하여 저장해두고 UI 렌더링, 로그 출력 등은 SnapShot을 처리하는 측에서 책임을 갖는다.
 * ----------------------------
 */
 
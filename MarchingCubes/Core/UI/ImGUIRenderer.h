@@ -10,7 +10,7 @@ struct ImGUIInitOptions
 	ID3D12CommandQueue* commandQueue = nullptr;
 	int nums_of_frame = 1;
 	DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM;
-	ComPtr<ID3D12DescriptorHeap> srvHeap; // NOTE :   ȮҰ.
+	ComPtr<ID3D12DescriptorHeap> srvHeap; // NOTE : 정상적인 사용인지 확인할것.
 	D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle{};
 	D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle{};
 	ImGuiConfigFlags configFlags = ImGuiConfigFlags_NavEnableKeyboard;
@@ -19,7 +19,7 @@ struct ImGUIInitOptions
 class ImGUIRenderer : public IUIRenderer
 {
 public:
-	// IUIRenderer()  ӵ
+	// IUIRenderer을(를) 통해 상속됨
 	bool Initialize(const UI::InitContext& context) override;
 	void RenderFrame(ID3D12GraphicsCommandList* commandList) override;
 	void ShutDown() override;
@@ -17,7 +17,7 @@ namespace UI
 	};
 
 	/*
-	* UI  ݹ Լ  ȭ鿡     ϵ Ѵ.
+	* UI 렌더는 콜백 함수 등록으로 화면에 어떻게 렌더링 할 것인지를 결정하도록 한다.
 	*/
 	struct UICallbackOptions
 	{
@@ -30,8 +30,8 @@ namespace UI
 }
 
 /*
-* UIRenderer UI ӿũ ¾ Ŭ  å.
-*   UI ׸ DXAppBase   Ŭ OnUIRender() Լ .
+* UIRenderer는 UI 프레임워크의 셋업과 라이프사이클 관리를 책임진다.
+* 실제로 어떤 UI를 그리는지는 DXAppBase 및 상속 클래스의 OnUIRender() 함수에서 결정함.
 */
 class IUIRenderer
 {
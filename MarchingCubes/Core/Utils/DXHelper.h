@@ -23,13 +23,13 @@ inline std::string UTF16ToUTF8(const wchar_t* wstr)
 {
     if (!wstr || *wstr == L'\0') return {};
 
-    // null  ʿ 
+    // null 포함한 필요 길이
     int sizeNeeded = ::WideCharToMultiByte(CP_UTF8, 0, wstr, -1, nullptr, 0, nullptr, nullptr);
 
-    //  ڿ̰ų 
+    // 빈 문자열이거나 오류
     if (sizeNeeded <= 1) return {};
 
-    std::string result(static_cast<size_t>(sizeNeeded - 1), '\0'); // null  
+    std::string result(static_cast<size_t>(sizeNeeded - 1), '\0'); // null 제외한 길이
     ::WideCharToMultiByte(CP_UTF8, 0, wstr, -1, result.data(), sizeNeeded, nullptr, nullptr);
 
     return result;
@@ -220,13 +220,13 @@ inline XMFLOAT3 ToEulerFromQuat(const XMVECTOR& quat)
 {
     XMFLOAT3 euler;
 
-    // ȸ ķ ȯ
+    // 회전 행렬로 변환
     XMMATRIX R = XMMatrixRotationQuaternion(quat);
 
-    //  row-major 
+    // 행렬을 row-major로 디컴포즈
     float pitch, yaw, roll;
 
-    // : XMMatrix row-major 
+    // 참고: XMMatrix는 row-major 기준임
     pitch = asinf(-R.r[2].m128_f32[1]);  // -m13
     if (cosf(pitch) > 1e-6f)
     {
@@ -235,12 +235,12 @@ inline XMFLOAT3 ToEulerFromQuat(const XMVECTOR& quat)
     }
     else
     {
-        // Gimbal lock ߻ 
+        // Gimbal lock 발생 시
         yaw = 0.0f;
         roll = atan2f(-R.r[1].m128_f32[0], R.r[0].m128_f32[0]); // -m21, m11
     }
 
-    euler = XMFLOAT3(pitch, yaw, roll); //  
+    euler = XMFLOAT3(pitch, yaw, roll); // 라디안 단위
     return euler;
 }
 
@@ -0,0 +1,95 @@
+#include "pch.h"
+#include "ThreadPool.h"
+
+namespace
+{
+	thread_local bool t_insidePool = false;
+}
+
+ThreadPool& ThreadPool::Get()
+{
+	// 호출 스레드가 0번 역할을 하므로 워커는 (하드웨어 스레드 - 1)
+	static ThreadPool s_pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+	return s_pool;
+}
+
+ThreadPool::ThreadPool(uint32_t workerCount)
+{
+	m_workers.reserve(workerCount);
+	for (uint32_t i = 0; i < workerCount; ++i)
+	{
+		m_workers.emplace_back(&ThreadPool::WorkerLoop, this, i + 1);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+	for (auto& worker : m_workers)
+	{
+		if (worker.joinable()) worker.join();
+	}
+}
+
+bool ThreadPool::IsInsidePool()
+{
+	return t_insidePool;
+}
+
+void ThreadPool::Dispatch(const std::function<void(uint32_t threadIndex)>& body)
+{
+	if (m_workers.empty() || t_insidePool)
+	{
+		// 워커가 없거나 중첩 호출 : 모든 인덱스를 호출 스레드에서 순서대로 실행
+		const uint32_t threads = GetThreadCount();
+		for (uint32_t t = 0; t < threads; ++t) body(t);
+		return;
+	}
+
+	std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_body = &body;
+		m_pending = static_cast<uint32_t>(m_workers.size());
+		++m_generation;
+	}
+	m_wake.notify_all();
+
+	t_insidePool = true;
+	body(0);
+	t_insidePool = false;
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this] { return m_pending == 0; });
+	m_body = nullptr;
+}
+
+void ThreadPool::WorkerLoop(uint32_t threadIndex)
+{
+	t_insidePool = true;
+	uint64_t seenGeneration = 0;
+	for (;;)
+	{
+		const std::function<void(uint32_t)>* body = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [&] { return m_stop || m_generation != seenGeneration; });
+			if (m_stop) return;
+			seenGeneration = m_generation;
+			body = m_body;
+		}
+
+		(*body)(threadIndex);
+
+		bool last = false;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			last = (--m_pending == 0);
+		}
+		if (last) m_done.notify_one();
+	}
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+* 공용 스레드 풀 (CPU 벌크 작업용)
+* - Dispatch : 모든 스레드(호출 스레드 = 0번 포함)에서 body(threadIndex)를 한 번씩 실행하고 완료까지 대기
+* - ParallelForStatic : 범위를 스레드 수로 균등 분할, i번째 분할은 항상 i번 스레드가 처리
+*   -> 같은 분할로 first-touch 한 메모리는 이후 처리 스레드와 같은 NUMA 노드에 놓인다.
+* - ParallelFor : grain 단위 동적 분배 (부하 불균형 작업용)
+* - ParallelForIndexed : ParallelFor 와 같은 분배에 실행 스레드 번호를 함께 넘김 (스레드별 scratch 버퍼 선택용)
+* - 풀 내부(작업 실행 중)에서 다시 호출하면 호출 스레드에서 직렬 실행
+*/
+class ThreadPool
+{
+public:
+	static ThreadPool& Get();
+
+	explicit ThreadPool(uint32_t workerCount);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// 호출 스레드 포함 스레드 수
+	uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_workers.size()) + 1; }
+
+	void Dispatch(const std::function<void(uint32_t threadIndex)>& body);
+
+	// fn(begin, end)
+	template <typename F>
+	void ParallelForStatic(size_t begin, size_t end, F&& fn)
+	{
+		if (begin >= end) return;
+		const size_t count = end - begin;
+		const uint32_t threads = static_cast<uint32_t>(std::min<size_t>(GetThreadCount(), count));
+		if (threads <= 1 || IsInsidePool())
+		{
+			fn(begin, end);
+			return;
+		}
+		Dispatch([&](uint32_t t) {
+			if (t >= threads) return;
+			const size_t b = begin + count * t / threads;
+			const size_t e = begin + count * (t + 1) / threads;
+			if (b < e) fn(b, e);
+		});
+	}
+
+	// fn(begin, end), grain 단위로 나눠 먼저 끝난 스레드가 다음 구간을 가져감
+	template <typename F>
+	void ParallelFor(size_t begin, size_t end, size_t grain, F&& fn)
+	{
+		if (begin >= end) return;
+		grain = std::max<size_t>(grain, 1);
+		if (end - begin <= grain || GetThreadCount() <= 1 || IsInsidePool())
+		{
+			fn(begin, end);
+			return;
+		}
+		std::atomic<size_t> next{ begin };
+		Dispatch([&](uint32_t) {
+			for (;;)
+			{
+				const size_t b = next.fetch_add(grain, std::memory_order_relaxed);
+				if (b >= end) break;
+				fn(b, std::min(b + grain, end));
+			}
+		});
+	}
+
+	// fn(threadIndex, begin, end), 분배는 ParallelFor 와 동일. threadIndex < GetThreadCount(), 직렬 실행 시 0
+	// 구간 시작은 항상 begin + k * grain 이므로 (b - begin) / grain 을 결정적인 블록 번호로 쓸 수 있다
+	template <typename F>
+	void ParallelForIndexed(size_t begin, size_t end, size_t grain, F&& fn)
+	{
+		if (begin >= end) return;
+		grain = std::max<size_t>(grain, 1);
+		if (GetThreadCount() <= 1 || IsInsidePool())
+		{
+			for (size_t b = begin; b < end; b += grain) fn(0u, b, std::min(b + grain, end));
+			return;
+		}
+		std::atomic<size_t> next{ begin };
+		Dispatch([&](uint32_t threadIndex) {
+			for (;;)
+			{
+				const size_t b = next.fetch_add(grain, std::memory_order_relaxed);
+				if (b >= end) break;
+				fn(threadIndex, b, std::min(b + grain, end));
+			}
+		});
+	}
+
+	static bool IsInsidePool();
+
+private:
+	void WorkerLoop(uint32_t threadIndex);
+
+private:
+	std::vector<std::thread> m_workers;
+
+	std::mutex m_dispatchMutex;		// 외부 스레드 간 Dispatch 직렬화
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+
+	const std::function<void(uint32_t)>* m_body = nullptr;
+	uint64_t m_generation = 0;
+	uint32_t m_pending = 0;
+	bool m_stop = false;
+};
@@ -61,7 +61,7 @@ public:
 		}
 	}
 
-	//  Լ (-const/const) ȣ  ε
+	// 멤버 함수 포인터(비-const/const) 호출 편의 오버로드
     template <class C, class R, class... MArgs, class Obj, class... Args>
     static double MeasureMs(R(C::* mf)(MArgs...), Obj&& obj, Args&&... args) {
         return MeasureMs([&] {
@@ -0,0 +1,164 @@
+#include "pch.h"
+#include "VirtualMemory.h"
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	inline size_t AlignUpSize(size_t v, size_t a) { return (v + a - 1) / a * a; }
+
+#if defined(_WIN32)
+	// MEM_LARGE_PAGES는 SeLockMemoryPrivilege가 필요. 계정에 권한이 부여된 경우에만 활성화된다.
+	bool EnableLockMemoryPrivilege()
+	{
+		HANDLE token = nullptr;
+		if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token)) return false;
+
+		TOKEN_PRIVILEGES tp{};
+		tp.PrivilegeCount = 1;
+		tp.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+		bool ok = LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME, &tp.Privileges[0].Luid) &&
+			AdjustTokenPrivileges(token, FALSE, &tp, 0, nullptr, nullptr) &&
+			GetLastError() == ERROR_SUCCESS;
+		CloseHandle(token);
+		return ok;
+	}
+
+	bool LargePagesAvailable()
+	{
+		static std::once_flag s_once;
+		static bool s_available = false;
+		std::call_once(s_once, [] { s_available = (GetLargePageMinimum() != 0) && EnableLockMemoryPrivilege(); });
+		return s_available;
+	}
+#else
+	constexpr size_t kHugePageSize = size_t(2) << 20;
+#endif
+}
+
+namespace VirtualMemory
+{
+	void* Allocate(size_t bytes, size_t alignment, MemoryPolicy policy, MemoryPolicy* outResolved)
+	{
+		if (bytes == 0) return nullptr;
+
+		void* p = nullptr;
+		MemoryPolicy resolved = policy;
+
+		switch (policy)
+		{
+			case MemoryPolicy::LargePages:
+			{
+#if defined(_WIN32)
+				if (LargePagesAvailable())
+				{
+					p = VirtualAlloc(nullptr, AlignUpSize(bytes, GetLargePageMinimum()), MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+				}
+				if (!p)
+				{
+					resolved = MemoryPolicy::Mapped;
+					p = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+				}
+#else
+				// 2MB 경계에 맞춰 매핑해야 THP가 전체 구간에 적용된다 : 여유분을 매핑 후 앞뒤를 잘라냄
+				const size_t length = AlignUpSize(bytes, kHugePageSize);
+				void* raw = mmap(nullptr, length + kHugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (raw != MAP_FAILED)
+				{
+					const uintptr_t begin = reinterpret_cast<uintptr_t>(raw);
+					const uintptr_t aligned = AlignUpSize(begin, kHugePageSize);
+					if (aligned > begin) munmap(raw, aligned - begin);
+					const size_t tail = (begin + length + kHugePageSize) - (aligned + length);
+					if (tail > 0) munmap(reinterpret_cast<void*>(aligned + length), tail);
+
+					p = reinterpret_cast<void*>(aligned);
+#if defined(MADV_HUGEPAGE)
+					madvise(p, length, MADV_HUGEPAGE);
+#endif
+				}
+#endif
+			}
+			break;
+			case MemoryPolicy::Mapped:
+			{
+#if defined(_WIN32)
+				p = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+				p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (p == MAP_FAILED) p = nullptr;
+#endif
+			}
+			break;
+			case MemoryPolicy::Aligned:
+			default:
+			{
+				resolved = MemoryPolicy::Aligned;
+#if defined(_MSC_VER)
+				p = _aligned_malloc(bytes, alignment);
+#else
+				if (posix_memalign(&p, alignment, bytes) != 0) p = nullptr;
+#endif
+			}
+			break;
+		}
+
+		if (!p) throw std::bad_alloc();
+		if (outResolved) *outResolved = resolved;
+		return p;
+	}
+
+	void Free(void* p, size_t bytes, MemoryPolicy resolved) noexcept
+	{
+		if (!p) return;
+
+		switch (resolved)
+		{
+			case MemoryPolicy::LargePages:
+			case MemoryPolicy::Mapped:
+#if defined(_WIN32)
+				VirtualFree(p, 0, MEM_RELEASE);
+#else
+				munmap(p, resolved == MemoryPolicy::LargePages ? AlignUpSize(bytes, kHugePageSize) : bytes);
+#endif
+				break;
+			case MemoryPolicy::Aligned:
+			default:
+#if defined(_MSC_VER)
+				_aligned_free(p);
+#else
+				free(p);
+#endif
+				break;
+		}
+	}
+
+	size_t GetPageSize(MemoryPolicy policy)
+	{
+#if defined(_WIN32)
+		if (policy == MemoryPolicy::LargePages && LargePagesAvailable()) return GetLargePageMinimum();
+		SYSTEM_INFO info{};
+		GetSystemInfo(&info);
+		return info.dwPageSize;
+#else
+		if (policy == MemoryPolicy::LargePages) return kHugePageSize;
+		return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+	}
+
+	const char* ToString(MemoryPolicy policy)
+	{
+		switch (policy)
+		{
+			case MemoryPolicy::Aligned: return "Aligned";
+			case MemoryPolicy::Mapped: return "Mapped";
+			case MemoryPolicy::LargePages: return "LargePages";
+		}
+		return "Unknown";
+	}
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// 대용량 버퍼 할당 정책
+enum class MemoryPolicy : uint8_t
+{
+	Aligned,	// 힙 정렬 할당 (_aligned_malloc / posix_memalign)
+	Mapped,		// OS 가상 메모리 직접 할당 (VirtualAlloc / 익명 mmap). 페이지 정렬, 0 초기화, 실제 페이지는 first-touch 시점에 배치
+	LargePages	// 대형 페이지 (Windows : MEM_LARGE_PAGES, 권한 없으면 Mapped로 대체 / 그 외 : 2MB 정렬 mmap + madvise(MADV_HUGEPAGE)).
+				// Windows 대형 페이지는 할당 시 커밋되므로 first-touch 배치가 없고, 첫 사용 때 토큰 권한(SeLockMemoryPrivilege)을 조정한다
+};
+
+namespace VirtualMemory
+{
+	// outResolved : 실제 적용된 정책 (대형 페이지 실패 시 Mapped). Free에 그대로 전달해야 한다.
+	void* Allocate(size_t bytes, size_t alignment, MemoryPolicy policy, MemoryPolicy* outResolved = nullptr);
+	void Free(void* p, size_t bytes, MemoryPolicy resolved) noexcept;
+
+	size_t GetPageSize(MemoryPolicy policy);
+	const char* ToString(MemoryPolicy policy);
+}
@@ -53,7 +53,7 @@ FBXImporter::ImportSceneData FBXImporter::LoadFile(const std::filesystem::path&
 	importer->Import(scene);
 	importer->Destroy();
 
-	// ǥ ȯ
+	// 좌표계 변환
 	FbxAxisSystem directXSystem(FbxAxisSystem::eYAxis, FbxAxisSystem::eParityOdd, FbxAxisSystem::eRightHanded);
 	directXSystem.ConvertScene(scene);
 
@@ -73,7 +73,7 @@ void FBXImporter::ProcessScene(fbxsdk::FbxScene* scene, ImportSceneData& outData
 	std::vector<FbxNode*> nodes;
 	nodes.push_back(scene->GetRootNode());
 
-	// Scene  Material üũ
+	// Scene에서 사용된 Material 체크
 	size_t head = 0;
 	while (head < nodes.size())
 	{
@@ -91,12 +91,12 @@ void FBXImporter::ProcessScene(fbxsdk::FbxScene* scene, ImportSceneData& outData
 		for (int i = 0; i < curr->GetChildCount(); ++i) nodes.push_back(curr->GetChild(i));
 	}
 
-	// FbxMesh 
+	// FbxMesh 수집
 	std::vector<FbxMesh*> fbxMeshes;
 	CollectMeshes(scene->GetRootNode(), fbxMeshes);
 	outData.geometry.topology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
-	// GeometryData Mesh  
+	// GeometryData에 Mesh 정보 저장
 	for (auto* mesh : fbxMeshes)
 	{
 		PrintLayerInfo(mesh);
@@ -123,7 +123,7 @@ ImportedMaterialDesc FBXImporter::ParseMaterial(const fbxsdk::FbxSurfaceMaterial
 
 	outMatDesc.name = fbxMat->GetName();
 
-	// ؽó   
+	// 텍스처 경로 추출 람다
 	auto extractTexturePath = [](const fbxsdk::FbxSurfaceMaterial* fbxMat, const char* propName) -> std::filesystem::path {
 		FbxProperty prop = fbxMat->FindProperty(propName);
 		if (!prop.IsValid()) return "";
@@ -135,7 +135,7 @@ ImportedMaterialDesc FBXImporter::ParseMaterial(const fbxsdk::FbxSurfaceMaterial
 			FbxFileTexture* fileTex = FbxCast<FbxFileTexture>(tex);
 			if (!fileTex) continue;
 
-			// FBX    (   )
+			// FBX에 저장된 원본 경로 (절대 경로일 수 있음)
 			const char* fileName = fileTex->GetFileName();
 			if (!fileName) continue;
 
@@ -144,7 +144,7 @@ ImportedMaterialDesc FBXImporter::ParseMaterial(const fbxsdk::FbxSurfaceMaterial
 		return "";
 	};
 
-	//   
+	// 색상 추출 람다
 	auto extractColor = [](const fbxsdk::FbxSurfaceMaterial* fbxMat, const char* propName) {
 		FbxProperty prop = fbxMat->FindProperty(propName);
 		if (!prop.IsValid()) return XMFLOAT3(1.0f, 1.0f, 1.0f);
@@ -152,7 +152,7 @@ ImportedMaterialDesc FBXImporter::ParseMaterial(const fbxsdk::FbxSurfaceMaterial
 		return XMFLOAT3((float)c[0], (float)c[1], (float)c[2]);
 	};
 
-	// Ӽ  
+	// 속성 추출 람다
 	auto extractFactor = [](const fbxsdk::FbxSurfaceMaterial* fbxMat, const char* propName, float defVal) {
 		FbxProperty prop = fbxMat->FindProperty(propName);
 		if (!prop.IsValid()) return defVal;
@@ -164,11 +164,11 @@ ImportedMaterialDesc FBXImporter::ParseMaterial(const fbxsdk::FbxSurfaceMaterial
 	// PBR Material
 	if (fbxMat->GetClassId().Is(FbxSurfacePhong::ClassId) || fbxMat->GetClassId().Is(FbxSurfaceLambert::ClassId))
 	{
-		// Phong/Lambert 迭
+		// Phong/Lambert 계열
 		outMatDesc.diffusePath = extractTexturePath(fbxMat, FbxSurfaceMaterial::sDiffuse);
 		outMatDesc.normalPath = extractTexturePath(fbxMat, FbxSurfaceMaterial::sNormalMap);
 		outMatDesc.emissivePath = extractTexturePath(fbxMat, FbxSurfaceMaterial::sEmissive);
-		// SpecularMap  Roughness/Metallic ٻϰų 
+		// SpecularMap 등을 Roughness/Metallic으로 근사하거나 무시
 	}
 	else
 	{
@@ -203,7 +203,7 @@ void FBXImporter::AppendFbxMeshToGeometry(FbxMesh* fbxMesh, const std::unordered
 
 	FbxNode* node = fbxMesh->GetNode();
 
-	//    ޽ 
+	// 현재 진행 중인 서브메시 정보
 	MeshSubmesh currentSubmesh{}; 
 	currentSubmesh.indexOffset = static_cast<uint32_t>(outGeometry.indices.size());
 
@@ -226,28 +226,28 @@ void FBXImporter::AppendFbxMeshToGeometry(FbxMesh* fbxMesh, const std::unordered
 
 		const int localMatIdx = GetLocalMaterialIndex(fbxMesh, polyIdx);
 
-		// Material Ǿų,  ù   ó
+		// Material이 변경되었거나, 루프의 첫 진입 시 처리
 		if (polyIdx == 0 || localMatIdx != prevLocalMatIdx)
 		{
-			if (polyIdx > 0) flushSubmesh(); //  ޽ 
+			if (polyIdx > 0) flushSubmesh(); // 이전 서브메시 저장
 
-			//  ޽ ʱȭ
+			// 새 서브메시 초기화
 			currentSubmesh.indexOffset = static_cast<uint32_t>(outGeometry.indices.size());
 			currentSubmesh.indexCount = 0;
 
-			//  ε ->  ε ȯ
+			// 로컬 인덱스 -> 전역 인덱스 변환
 			FbxSurfaceMaterial* matPtr = node->GetMaterial(localMatIdx);
 			if (matPtr && matPtrToGlobalIndex.contains(matPtr)) {
 				currentGlobalMatIdx = matPtrToGlobalIndex.at(matPtr);
 			}
 			else {
-				currentGlobalMatIdx = UINT32_MAX; // Material 
+				currentGlobalMatIdx = UINT32_MAX; // Material 없음
 			}
 
 			prevLocalMatIdx = localMatIdx;
 		}
 
-		// Vertex 
+		// Vertex 생성
 		for (int vertIdx = 0; vertIdx < polySize; ++vertIdx)
 		{
 			const int ctrlPointIndex = fbxMesh->GetPolygonVertex(polyIdx, vertIdx);
@@ -270,11 +270,11 @@ void FBXImporter::AppendFbxMeshToGeometry(FbxMesh* fbxMesh, const std::unordered
 				FbxVector2 uvValue(0, 0);
 				int uvIndex = -1;
 
-				//  忡  ε   
+				// 매핑 모드에 따라 인덱스 추출 방식 결정
 				switch (vertexUV->GetMappingMode())
 				{
 					case FbxGeometryElement::eByControlPoint:
-						//   ( Ǹ UV )
+						// 제어점 기준 (정점이 공유되면 UV도 공유)
 						if (vertexUV->GetReferenceMode() == FbxGeometryElement::eDirect)
 							uvIndex = ctrlPointIndex;
 						else if (vertexUV->GetReferenceMode() == FbxGeometryElement::eIndexToDirect)
@@ -282,18 +282,18 @@ void FBXImporter::AppendFbxMeshToGeometry(FbxMesh* fbxMesh, const std::unordered
 						break;
 
 					case FbxGeometryElement::eByPolygonVertex:
-						//  ؽ  (UV Seam ִ , ӿ  Ϲ)
-						// FBX SDK ϴ ؽó ε  
+						// 폴리곤 버텍스 기준 (UV Seam이 있는 경우, 게임에서 가장 일반적)
+						// FBX SDK가 제공하는 텍스처 인덱스 헬퍼 사용
 						uvIndex = fbxMesh->GetTextureUVIndex(polyIdx, vertIdx);
 						break;
 				}
 
-				// ε ȿϸ   迭  ȸ
+				// 인덱스가 유효하면 실제 데이터 배열에서 값 조회
 				if (uvIndex != -1)
 				{
 					uvValue = vertexUV->GetDirectArray().GetAt(uvIndex);
 
-					// DirectX ˿  V(Y) 
+					// DirectX 포맷에 맞춰 V(Y) 반전
 					v.texCoord = XMFLOAT2(
 						static_cast<float>(uvValue[0]),
 						1.0f - static_cast<float>(uvValue[1])
@@ -308,7 +308,7 @@ void FBXImporter::AppendFbxMeshToGeometry(FbxMesh* fbxMesh, const std::unordered
 		if (outSubmeshes) currentSubmesh.indexCount += 3;
 	}
 
-	//  ޽ Ȯ
+	// 마지막 서브메시 확정
 	flushSubmesh();
 }
 
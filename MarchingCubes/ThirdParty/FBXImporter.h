@@ -1,12 +1,12 @@
 #pragma once
 #include "Core/DataStructures/Data.h"
-#include "Core/Assets/MeshAsset.h" // ImportedMaterialDesc   
+#include "Core/Assets/MeshAsset.h" // ImportedMaterialDesc 등 정의 포함
 #include <string>
 #include <vector>
 #include <filesystem>
 #include <unordered_map>
 
-// FBX SDK   (  )
+// FBX SDK 전방 선언 (헤더 오염 방지)
 namespace fbxsdk {
 	class FbxManager;
 	class FbxScene;
@@ -17,7 +17,7 @@ namespace fbxsdk {
 
 struct MeshImportOptions
 {
-	float uniformScale = 1.0f;    // ex) 0.01f: cm  m
+	float uniformScale = 1.0f;    // ex) 0.01f: cm → m
 	bool  applyUnitConversion = true;
 };
 
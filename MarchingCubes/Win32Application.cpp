@@ -9,7 +9,7 @@ int Win32Application::Run(DXAppBase* pAppBase, HINSTANCE hInstance, int nCmdShow
 	LPWSTR* argv = CommandLineToArgvW(GetCommandLine(), &argc);
 	pAppBase->ParseCommandLineArgs(argv, argc);
 
-    //CommandLineToArgvW   argv ü LocalFree ؾ. (https://learn.microsoft.com/ko-kr/windows/win32/api/shellapi/nf-shellapi-commandlinetoargvw)
+    //CommandLineToArgvW를 통해 얻은 argv 객체는 LocalFree로 해제해야함. (https://learn.microsoft.com/ko-kr/windows/win32/api/shellapi/nf-shellapi-commandlinetoargvw)
 	LocalFree(argv);
 	
     // CreateUploadBuffer the window class.
@@ -91,7 +91,7 @@ LRESULT Win32Application::WindowProc(HWND hWnd, uint32_t message, WPARAM wParam,
                 return 0;
         }
 
-        // ӿ ޽ ó
+        // 게임용 메시지 처리
         switch (message)
         {
             case WM_KEYDOWN:
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "App/Editor/Interface/EditorApp.h"
+#include "Core/Geometry/FluidBenchmark.h"
 #include <dxgidebug.h>
 
 
@@ -21,6 +22,12 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int nCmdShow)
 #endif // _DEBUG
 
     int exitCode = 0;
+    // -fluidbench : 창 없이 유체 벤치마크만 돌리고 종료 (FluidBenchmark.h)
+    if (FluidBenchmark::RunFromCommandLine(exitCode))
+    {
+        return exitCode;
+    }
+
     {
         EditorApp sample(1280, 720, L"Editor");
         exitCode = Win32Application::Run(&sample, hInstance, nCmdShow);
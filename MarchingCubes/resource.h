@@ -2,7 +2,7 @@
 // Microsoft Visual C++ generated include file.
 // Used by MarchingCubes.rc
 
-//   ü  ⺻Դϴ.
+// 다음은 새 개체에 사용할 기본값입니다.
 // 
 #ifdef APSTUDIO_INVOKED
 #ifndef APSTUDIO_READONLY_SYMBOLS